@@ -343,6 +343,10 @@ def add_item_visible_handler(*, label: str ='', user_data: Any ='', use_internal
 	"""Adds a visible handler."""
 	...
 
+def add_items(items : Any) -> Union[List[int], Tuple[int, ...]]:
+	"""Creates many items under a single lock. Equivalent to calling the add_* command of each entry in order, except that required arguments are passed by name in kwargs and optional positional arguments can't be passed. If an entry fails, the items the batch already created are deleted again. Returns the UUIDs (or aliases) of the new items."""
+	...
+
 def add_key_down_handler(key : int ='', *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', callback: Callable ='', show: bool ='', parent: Union[int, str] ='') -> Union[int, str]:
 	"""Adds a key down handler."""
 	...
@@ -667,7 +671,7 @@ def clear_selected_nodes(node_editor : Union[int, str]) -> None:
 	"""Clears a node editor's selected nodes."""
 	...
 
-def configure_app(*, load_init_file: str ='', docking: bool ='', docking_space: bool ='', docking_shift_only: bool ='', init_file: str ='', auto_save_init_file: bool ='', device: int ='', auto_device: bool ='', allow_alias_overwrites: bool ='', manual_alias_management: bool ='', skip_required_args: bool ='', skip_positional_args: bool ='', skip_keyword_args: bool ='', wait_for_input: bool ='', manual_callback_management: bool ='', keyboard_navigation: bool ='', anti_aliased_lines: bool ='', anti_aliased_lines_use_tex: bool ='', anti_aliased_fill: bool ='', win32_alt_enter_fullscreen: bool ='', **kwargs) -> None:
+def configure_app(*, load_init_file: str ='', docking: bool ='', docking_space: bool ='', docking_shift_only: bool ='', init_file: str ='', auto_save_init_file: bool ='', device: int ='', auto_device: bool ='', allow_alias_overwrites: bool ='', manual_alias_management: bool ='', skip_required_args: bool ='', skip_positional_args: bool ='', skip_keyword_args: bool ='', skip_keyword_validation: bool ='', deferred_deletion_threshold: int ='', deletion_budget: int ='', command_buffer: bool ='', wait_for_input: bool ='', max_idle_interval: float ='', null_renderer: bool ='', manual_callback_management: bool ='', callback_queue_capacity: int ='', callback_queue_policy: int ='', coalesce_callbacks: bool ='', callback_workers: int ='', callback_loop: Any ='', keyboard_navigation: bool ='', anti_aliased_lines: bool ='', anti_aliased_lines_use_tex: bool ='', anti_aliased_fill: bool ='', win32_alt_enter_fullscreen: bool ='', **kwargs) -> None:
 	"""Configures app."""
 	...
 
@@ -675,6 +679,10 @@ def configure_item(item : Union[int, str], **kwargs) -> None:
 	"""Configures an item."""
 	...
 
+def configure_items(items : Union[List[int], Tuple[int, ...]], **kwargs) -> None:
+	"""Configures a list of items with the same keywords."""
+	...
+
 def configure_viewport(item : Union[int, str], **kwargs) -> None:
 	"""Configures a viewport."""
 	...
@@ -711,7 +719,7 @@ def create_translation_matrix(translation : Union[List[float], Tuple[float, ...]
 	"""New in 1.1. Creates a translation matrix."""
 	...
 
-def create_viewport(*, title: str ='', small_icon: str ='', large_icon: str ='', width: int ='', height: int ='', x_pos: int ='', y_pos: int ='', min_width: int ='', max_width: int ='', min_height: int ='', max_height: int ='', resizable: bool ='', vsync: bool ='', always_on_top: bool ='', decorated: bool ='', clear_color: Union[List[float], Tuple[float, ...]] ='', disable_close: bool ='') -> None:
+def create_viewport(*, title: str ='', small_icon: str ='', large_icon: str ='', width: int ='', height: int ='', x_pos: int ='', y_pos: int ='', min_width: int ='', max_width: int ='', min_height: int ='', max_height: int ='', resizable: bool ='', vsync: bool ='', always_on_top: bool ='', decorated: bool ='', clear_color: Union[List[float], Tuple[float, ...]] ='', disable_close: bool ='', max_fps: int ='', fixed_delta_time: float ='', headless: bool ='') -> None:
 	"""Creates a viewport. Viewports are required."""
 	...
 
@@ -719,6 +727,14 @@ def delete_item(item : Union[int, str], *, children_only: bool ='', slot: int ='
 	"""Deletes an item.."""
 	...
 
+def delete_items(items : Union[List[int], Tuple[int, ...]]) -> None:
+	"""Deletes several items at once. Siblings are removed from their parent in a single pass, which is much faster than calling delete_item on each of them."""
+	...
+
+def delete_timer_callback(timer : int) -> None:
+	"""Deletes a timer created by set_timer_callback. A call that's already queued may still run."""
+	...
+
 def destroy_context() -> None:
 	"""Destroys the Dear PyGui context."""
 	...
@@ -819,6 +835,10 @@ def get_all_items() -> Union[List[int], Tuple[int, ...]]:
 	"""Returns all items."""
 	...
 
+def get_allocation_stats(*, trim: bool ='') -> dict:
+	"""Returns item memory pool statistics: how many pool blocks were taken from the heap (pool_allocations) and how many were recycled (pool_reuses) since the start, how many blocks/bytes are currently kept for reuse, and how many times the buffer of a vector value (series columns, float vects, textures) had to grow (value_buffer_allocations). Items and their value storage come from the pools; strings and child lists still use the heap directly. Once an app has warmed up, setting values of unchanged sizes leaves both allocation counters where they are. Pools keep their free blocks until the context is destroyed or trim is set."""
+	...
+
 def get_app_configuration() -> dict:
 	"""Returns app configuration."""
 	...
@@ -831,6 +851,14 @@ def get_callback_queue() -> Any:
 	"""New in 1.2. Returns and clears callback queue."""
 	...
 
+def get_callback_queue_columns(*, senders: Any ='', types: Any ='', values: Any ='') -> Any:
+	"""Columnar alternative to get_callback_queue for manual callback management. Returns (count, senders, types, values, objects, callbacks, user_data): sender ids (u64), sender item types (i32, -1 for frame/timer/viewport callbacks), app_data that is an int or a float (f64, NaN otherwise), a dict of row to app_data for other non-None app_data (bools and ints too large for a double included), and lists of callbacks and user_data. Columns are written into the given buffers if any; if there are more jobs than fit, the rest stay queued, and if the result can't be built, all of them do. This saves the per-job tuples and number objects; the objects dict and the callbacks and user_data lists are still created on every call."""
+	...
+
+def get_callback_queue_stats() -> dict:
+	"""Returns callback queue statistics: number of pending calls, queue capacity, and how many calls have been dropped or coalesced so far."""
+	...
+
 def get_clipboard_text() -> str:
 	"""New in 1.3. Gets the clipboard text."""
 	...
@@ -887,6 +915,10 @@ def get_item_types() -> dict:
 	"""Returns an item types."""
 	...
 
+def get_memory_stats() -> dict:
+	"""Returns memory used by live items. 'types' maps each item type to its count, item_size (in-object bytes per item), number of allocated cold configs (drag and drop/scroll settings), and total bytes. Heap data owned by items (strings, values, children lists) is not included."""
+	...
+
 def get_mouse_drag_delta() -> float:
 	"""Returns mouse drag delta."""
 	...
@@ -895,6 +927,10 @@ def get_mouse_pos(*, local: bool ='') -> Union[List[int], Tuple[int, ...]]:
 	"""Returns mouse position."""
 	...
 
+def get_pending_deletions() -> int:
+	"""Returns the number of deleted items that are still waiting to be destroyed (see deferred_deletion_threshold in configure_app)."""
+	...
+
 def get_platform() -> int:
 	"""New in 1.6. Returns platform constant."""
 	...
@@ -907,6 +943,10 @@ def get_plot_query_rects(plot : Union[int, str]) -> List[List[float]]:
 	"""Returns the query rects of the plot. Returns an array of array containing the top-left coordinates and bottom-right coordinates of the plot area."""
 	...
 
+def get_render_stats() -> dict:
+	"""Returns render loop statistics: the number of frames rendered and of render_dearpygui_frame calls that rendered nothing (the viewport was minimized, or nothing changed with wait_for_input), the smoothed frame time and its jitter in seconds, and the size of the last frame's draw data (draw lists, vertices, indices, draw commands and texture binds)."""
+	...
+
 def get_selected_links(node_editor : Union[int, str]) -> List[List[str]]:
 	"""Returns a node editor's selected links."""
 	...
@@ -923,7 +963,7 @@ def get_total_time() -> float:
 	"""Returns total time since Dear PyGui has started."""
 	...
 
-def get_value(item : Union[int, str]) -> Any:
+def get_value(item : Union[int, str], *, as_buffer: bool ='') -> Any:
 	"""Returns an item's value."""
 	...
 
@@ -1167,10 +1207,18 @@ def set_table_row_color(table : Union[int, str], row : int, color : Union[List[i
 	"""Set table row color."""
 	...
 
+def set_timer_callback(interval : int, callback : Callable, *, repeat: bool ='', user_data: Any ='') -> int:
+	"""Sets a callback to run after a time interval, once or repeatedly. The callback gets the timer as the sender. Timers keep firing when wait_for_input is enabled. Returns the timer."""
+	...
+
 def set_value(item : Union[int, str], value : Any) -> None:
 	"""Set's an item's value."""
 	...
 
+def set_values(items : Union[List[int], Tuple[int, ...]], values : Any) -> None:
+	"""Sets the values of a list of items."""
+	...
+
 def set_viewport_resize_callback(callback : Callable, *, user_data: Any ='') -> str:
 	"""Sets a callback to run on viewport resize."""
 	...
@@ -1439,6 +1487,8 @@ def unstage(item : Union[int, str]) -> None:
 mvScrollDirection_Vertical=0
 mvLoadInd_DottedCircle=0
 mvLoadInd_Ring=0
+mvCallbackQueue_DropNewest=0
+mvCallbackQueue_DropOldest=0
 mvPlatform_Windows=0
 mvPlatform_Apple=0
 mvPlatform_Linux=0
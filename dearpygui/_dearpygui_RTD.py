@@ -79,6 +79,10 @@ def configure_item(item : Union[int, str], **kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_item(item, **kwargs)
 
+def configure_items(items : Union[List[int], Tuple[int, ...]], **kwargs) -> None:
+	"""Configures a list of items with the same keywords."""
+	internal_dpg.configure_items(items, **kwargs)
+
 def configure_app(**kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_app(**kwargs)
@@ -968,6 +972,15 @@ def set_viewport_vsync(value: bool):
     internal_dpg.configure_viewport(0, vsync=value)
 
 
+def set_viewport_max_fps(value: int):
+    """Caps the viewport's frame rate, with or without vsync (0 for no cap).
+
+    Returns:
+        None
+    """
+    internal_dpg.configure_viewport(0, max_fps=value)
+
+
 def set_viewport_decorated(value: bool):
     """Sets the viewport to be decorated.
 
@@ -1109,6 +1122,15 @@ def is_viewport_vsync_on() -> bool:
     return internal_dpg.get_viewport_configuration()["vsync"]
 
 
+def get_viewport_max_fps() -> int:
+    """Gets the viewport's frame rate cap (0 for no cap).
+
+    Returns:
+        int
+    """
+    return internal_dpg.get_viewport_configuration()["max_fps"]
+
+
 def is_viewport_decorated() -> bool:
     """Checks if the viewport is docorated.
 
@@ -5108,6 +5130,17 @@ def add_item_visible_handler(**kwargs):
 
 	return internal_dpg.add_item_visible_handler(**kwargs)
 
+def add_items(items):
+	"""	 Creates many items under a single lock. Equivalent to calling the add_* command of each entry in order, except that required arguments are passed by name in kwargs and optional positional arguments can't be passed. If an entry fails, the items the batch already created are deleted again. Returns the UUIDs (or aliases) of the new items.
+
+	Args:
+		items (Any): Sequence of (type, parent, kwargs) tuples. Type is either the command name (e.g. 'add_button') or a value from get_item_types(). Parent and kwargs may be omitted or None.
+	Returns:
+		Union[List[int], Tuple[int, ...]]
+	"""
+
+	return internal_dpg.add_items(items)
+
 def add_key_down_handler(key=internal_dpg.mvKey_None, **kwargs):
 	"""	 Adds a key down handler.
 
@@ -7225,6 +7258,9 @@ def create_viewport(**kwargs):
 		decorated (bool, optional): Enabled and disabled the decorator bar at the top of the viewport.
 		clear_color (Union[List[float], Tuple[float, ...]], optional): Sets the color of the back of the viewport.
 		disable_close (bool, optional): Disables the viewport close button. can be used with set_exit_callback
+		max_fps (int, optional): Caps the frame rate, with or without vsync (0 for no cap).
+		fixed_delta_time (float, optional): Advances time by this many seconds every frame instead of using the real time (0 for real time).
+		headless (bool, optional): Renders into an offscreen framebuffer instead of a window, without needing a display (Linux only).
 	Returns:
 		None
 	"""
@@ -7244,6 +7280,28 @@ def delete_item(item, **kwargs):
 
 	return internal_dpg.delete_item(item, **kwargs)
 
+def delete_items(items):
+	"""	 Deletes several items at once. Siblings are removed from their parent in a single pass, which is much faster than calling delete_item on each of them.
+
+	Args:
+		items (Union[List[int], Tuple[int, ...]]): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.delete_items(items)
+
+def delete_timer_callback(timer):
+	"""	 Deletes a timer created by set_timer_callback. A call that's already queued may still run.
+
+	Args:
+		timer (int): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.delete_timer_callback(timer)
+
 def destroy_context():
 	"""	 Destroys the Dear PyGui context.
 
@@ -7698,6 +7756,17 @@ def get_all_items():
 
 	return internal_dpg.get_all_items()
 
+def get_allocation_stats(**kwargs):
+	"""	 Returns item memory pool statistics: how many pool blocks were taken from the heap (pool_allocations) and how many were recycled (pool_reuses) since the start, how many blocks/bytes are currently kept for reuse, and how many times the buffer of a vector value (series columns, float vects, textures) had to grow (value_buffer_allocations). Items and their value storage come from the pools; strings and child lists still use the heap directly. Once an app has warmed up, setting values of unchanged sizes leaves both allocation counters where they are. Pools keep their free blocks until the context is destroyed or trim is set.
+
+	Args:
+		trim (bool, optional): Returns the blocks kept for reuse to the heap before gathering the statistics.
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_allocation_stats(**kwargs)
+
 def get_app_configuration():
 	"""	 Returns app configuration.
 
@@ -7729,6 +7798,29 @@ def get_callback_queue():
 
 	return internal_dpg.get_callback_queue()
 
+def get_callback_queue_columns(**kwargs):
+	"""	 Columnar alternative to get_callback_queue for manual callback management. Returns (count, senders, types, values, objects, callbacks, user_data): sender ids (u64), sender item types (i32, -1 for frame/timer/viewport callbacks), app_data that is an int or a float (f64, NaN otherwise), a dict of row to app_data for other non-None app_data (bools and ints too large for a double included), and lists of callbacks and user_data. Columns are written into the given buffers if any; if there are more jobs than fit, the rest stay queued, and if the result can't be built, all of them do. This saves the per-job tuples and number objects; the objects dict and the callbacks and user_data lists are still created on every call.
+
+	Args:
+		senders (Any, optional): Optional writable buffer of format 'Q' (e.g. array('Q')) to fill with sender ids.
+		types (Any, optional): Optional writable buffer of format 'i' (e.g. array('i')) to fill with sender item types.
+		values (Any, optional): Optional writable buffer of format 'd' (e.g. array('d')) to fill with numeric app_data.
+	Returns:
+		Any
+	"""
+
+	return internal_dpg.get_callback_queue_columns(**kwargs)
+
+def get_callback_queue_stats():
+	"""	 Returns callback queue statistics: number of pending calls, queue capacity, and how many calls have been dropped or coalesced so far.
+
+	Args:
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_callback_queue_stats()
+
 def get_clipboard_text():
 	"""	 New in 1.3. Gets the clipboard text.
 
@@ -7876,6 +7968,16 @@ def get_item_types():
 
 	return internal_dpg.get_item_types()
 
+def get_memory_stats():
+	"""	 Returns memory used by live items. 'types' maps each item type to its count, item_size (in-object bytes per item), number of allocated cold configs (drag and drop/scroll settings), and total bytes. Heap data owned by items (strings, values, children lists) is not included.
+
+	Args:
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_memory_stats()
+
 def get_mouse_drag_delta():
 	"""	 Returns mouse drag delta.
 
@@ -7897,6 +7999,16 @@ def get_mouse_pos(**kwargs):
 
 	return internal_dpg.get_mouse_pos(**kwargs)
 
+def get_pending_deletions():
+	"""	 Returns the number of deleted items that are still waiting to be destroyed (see deferred_deletion_threshold in configure_app).
+
+	Args:
+	Returns:
+		int
+	"""
+
+	return internal_dpg.get_pending_deletions()
+
 def get_platform():
 	"""	 New in 1.6. Returns platform constant.
 
@@ -7928,6 +8040,16 @@ def get_plot_query_rects(plot):
 
 	return internal_dpg.get_plot_query_rects(plot)
 
+def get_render_stats():
+	"""	 Returns render loop statistics: the number of frames rendered and of render_dearpygui_frame calls that rendered nothing (the viewport was minimized, or nothing changed with wait_for_input), the smoothed frame time and its jitter in seconds, and the size of the last frame's draw data (draw lists, vertices, indices, draw commands and texture binds).
+
+	Args:
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_render_stats()
+
 def get_selected_links(node_editor):
 	"""	 Returns a node editor's selected links.
 
@@ -7973,16 +8095,17 @@ def get_total_time():
 
 	return internal_dpg.get_total_time()
 
-def get_value(item):
+def get_value(item, **kwargs):
 	"""	 Returns an item's value.
 
 	Args:
 		item (Union[int, str]): 
+		as_buffer (bool, optional): Array values (series, float vectors, textures) are returned as read-only memoryview snapshots instead of lists.
 	Returns:
 		Any
 	"""
 
-	return internal_dpg.get_value(item)
+	return internal_dpg.get_value(item, **kwargs)
 
 def get_values(items):
 	"""	 Returns values of a list of items.
@@ -8680,6 +8803,20 @@ def set_table_row_color(table, row, color):
 
 	return internal_dpg.set_table_row_color(table, row, color)
 
+def set_timer_callback(interval, callback, **kwargs):
+	"""	 Sets a callback to run after a time interval, once or repeatedly. The callback gets the timer as the sender. Timers keep firing when wait_for_input is enabled. Returns the timer.
+
+	Args:
+		interval (int): Milliseconds between calls (or before the only call, if repeat is False).
+		callback (Callable): 
+		repeat (bool, optional): Keep calling the callback every interval until the timer is deleted.
+		user_data (Any, optional): Optional user data to send to the callback
+	Returns:
+		int
+	"""
+
+	return internal_dpg.set_timer_callback(interval, callback, **kwargs)
+
 def set_value(item, value):
 	"""	 Set's an item's value.
 
@@ -8692,6 +8829,18 @@ def set_value(item, value):
 
 	return internal_dpg.set_value(item, value)
 
+def set_values(items, values):
+	"""	 Sets the values of a list of items.
+
+	Args:
+		items (Union[List[int], Tuple[int, ...]]): 
+		values (Any): One value per item. Numeric buffers (e.g. numpy arrays) are written to int, float, double and bool items without creating Python objects.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_values(items, values)
+
 def set_viewport_resize_callback(callback, **kwargs):
 	"""	 Sets a callback to run on viewport resize.
 
@@ -9104,6 +9253,8 @@ def unstage(item):
 mvScrollDirection_Vertical=internal_dpg.mvScrollDirection_Vertical
 mvLoadInd_DottedCircle=internal_dpg.mvLoadInd_DottedCircle
 mvLoadInd_Ring=internal_dpg.mvLoadInd_Ring
+mvCallbackQueue_DropNewest=internal_dpg.mvCallbackQueue_DropNewest
+mvCallbackQueue_DropOldest=internal_dpg.mvCallbackQueue_DropOldest
 mvPlatform_Windows=internal_dpg.mvPlatform_Windows
 mvPlatform_Apple=internal_dpg.mvPlatform_Apple
 mvPlatform_Linux=internal_dpg.mvPlatform_Linux
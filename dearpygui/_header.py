@@ -63,6 +63,10 @@ def configure_item(item : Union[int, str], **kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_item(item, **kwargs)
 
+def configure_items(items : Union[List[int], Tuple[int, ...]], **kwargs) -> None:
+	"""Configures a list of items with the same keywords."""
+	internal_dpg.configure_items(items, **kwargs)
+
 def configure_app(**kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_app(**kwargs)
@@ -952,6 +956,15 @@ def set_viewport_vsync(value: bool):
     internal_dpg.configure_viewport(0, vsync=value)
 
 
+def set_viewport_max_fps(value: int):
+    """Caps the viewport's frame rate, with or without vsync (0 for no cap).
+
+    Returns:
+        None
+    """
+    internal_dpg.configure_viewport(0, max_fps=value)
+
+
 def set_viewport_decorated(value: bool):
     """Sets the viewport to be decorated.
 
@@ -1093,6 +1106,15 @@ def is_viewport_vsync_on() -> bool:
     return internal_dpg.get_viewport_configuration()["vsync"]
 
 
+def get_viewport_max_fps() -> int:
+    """Gets the viewport's frame rate cap (0 for no cap).
+
+    Returns:
+        int
+    """
+    return internal_dpg.get_viewport_configuration()["max_fps"]
+
+
 def is_viewport_decorated() -> bool:
     """Checks if the viewport is docorated.
 
@@ -79,6 +79,10 @@ def configure_item(item : Union[int, str], **kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_item(item, **kwargs)
 
+def configure_items(items : Union[List[int], Tuple[int, ...]], **kwargs) -> None:
+	"""Configures a list of items with the same keywords."""
+	internal_dpg.configure_items(items, **kwargs)
+
 def configure_app(**kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_app(**kwargs)
@@ -968,6 +972,15 @@ def set_viewport_vsync(value: bool):
     internal_dpg.configure_viewport(0, vsync=value)
 
 
+def set_viewport_max_fps(value: int):
+    """Caps the viewport's frame rate, with or without vsync (0 for no cap).
+
+    Returns:
+        None
+    """
+    internal_dpg.configure_viewport(0, max_fps=value)
+
+
 def set_viewport_decorated(value: bool):
     """Sets the viewport to be decorated.
 
@@ -1109,6 +1122,15 @@ def is_viewport_vsync_on() -> bool:
     return internal_dpg.get_viewport_configuration()["vsync"]
 
 
+def get_viewport_max_fps() -> int:
+    """Gets the viewport's frame rate cap (0 for no cap).
+
+    Returns:
+        int
+    """
+    return internal_dpg.get_viewport_configuration()["max_fps"]
+
+
 def is_viewport_decorated() -> bool:
     """Checks if the viewport is docorated.
 
@@ -5738,6 +5760,17 @@ def add_item_visible_handler(*, label: str =None, user_data: Any =None, use_inte
 
 	return internal_dpg.add_item_visible_handler(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, callback=callback, show=show, **kwargs)
 
+def add_items(items : Any, **kwargs) -> Union[List[int], Tuple[int, ...]]:
+	"""	 Creates many items under a single lock. Equivalent to calling the add_* command of each entry in order, except that required arguments are passed by name in kwargs and optional positional arguments can't be passed. If an entry fails, the items the batch already created are deleted again. Returns the UUIDs (or aliases) of the new items.
+
+	Args:
+		items (Any): Sequence of (type, parent, kwargs) tuples. Type is either the command name (e.g. 'add_button') or a value from get_item_types(). Parent and kwargs may be omitted or None.
+	Returns:
+		Union[List[int], Tuple[int, ...]]
+	"""
+
+	return internal_dpg.add_items(items, **kwargs)
+
 def add_key_down_handler(key : int =internal_dpg.mvKey_None, *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, callback: Callable =None, show: bool =True, parent: Union[int, str] =internal_dpg.mvReservedUUID_1, **kwargs) -> Union[int, str]:
 	"""	 Adds a key down handler.
 
@@ -8211,7 +8244,7 @@ def create_translation_matrix(translation : Union[List[float], Tuple[float, ...]
 
 	return internal_dpg.create_translation_matrix(translation, **kwargs)
 
-def create_viewport(*, title: str ='Dear PyGui', small_icon: str ='', large_icon: str ='', width: int =1280, height: int =800, x_pos: int =100, y_pos: int =100, min_width: int =250, max_width: int =10000, min_height: int =250, max_height: int =10000, resizable: bool =True, vsync: bool =True, always_on_top: bool =False, decorated: bool =True, clear_color: Union[List[float], Tuple[float, ...]] =(0, 0, 0, 255), disable_close: bool =False, **kwargs) -> None:
+def create_viewport(*, title: str ='Dear PyGui', small_icon: str ='', large_icon: str ='', width: int =1280, height: int =800, x_pos: int =100, y_pos: int =100, min_width: int =250, max_width: int =10000, min_height: int =250, max_height: int =10000, resizable: bool =True, vsync: bool =True, always_on_top: bool =False, decorated: bool =True, clear_color: Union[List[float], Tuple[float, ...]] =(0, 0, 0, 255), disable_close: bool =False, max_fps: int =0, fixed_delta_time: float =0.0, headless: bool =False, **kwargs) -> None:
 	"""	 Creates a viewport. Viewports are required.
 
 	Args:
@@ -8232,11 +8265,14 @@ def create_viewport(*, title: str ='Dear PyGui', small_icon: str ='', large_icon
 		decorated (bool, optional): Enabled and disabled the decorator bar at the top of the viewport.
 		clear_color (Union[List[float], Tuple[float, ...]], optional): Sets the color of the back of the viewport.
 		disable_close (bool, optional): Disables the viewport close button. can be used with set_exit_callback
+		max_fps (int, optional): Caps the frame rate, with or without vsync (0 for no cap).
+		fixed_delta_time (float, optional): Advances time by this many seconds every frame instead of using the real time (0 for real time).
+		headless (bool, optional): Renders into an offscreen framebuffer instead of a window, without needing a display (Linux only).
 	Returns:
 		None
 	"""
 
-	return internal_dpg.create_viewport(title=title, small_icon=small_icon, large_icon=large_icon, width=width, height=height, x_pos=x_pos, y_pos=y_pos, min_width=min_width, max_width=max_width, min_height=min_height, max_height=max_height, resizable=resizable, vsync=vsync, always_on_top=always_on_top, decorated=decorated, clear_color=clear_color, disable_close=disable_close, **kwargs)
+	return internal_dpg.create_viewport(title=title, small_icon=small_icon, large_icon=large_icon, width=width, height=height, x_pos=x_pos, y_pos=y_pos, min_width=min_width, max_width=max_width, min_height=min_height, max_height=max_height, resizable=resizable, vsync=vsync, always_on_top=always_on_top, decorated=decorated, clear_color=clear_color, disable_close=disable_close, max_fps=max_fps, fixed_delta_time=fixed_delta_time, headless=headless, **kwargs)
 
 def delete_item(item : Union[int, str], *, children_only: bool =False, slot: int =-1, **kwargs) -> None:
 	"""	 Deletes an item..
@@ -8251,6 +8287,28 @@ def delete_item(item : Union[int, str], *, children_only: bool =False, slot: int
 
 	return internal_dpg.delete_item(item, children_only=children_only, slot=slot, **kwargs)
 
+def delete_items(items : Union[List[int], Tuple[int, ...]], **kwargs) -> None:
+	"""	 Deletes several items at once. Siblings are removed from their parent in a single pass, which is much faster than calling delete_item on each of them.
+
+	Args:
+		items (Union[List[int], Tuple[int, ...]]): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.delete_items(items, **kwargs)
+
+def delete_timer_callback(timer : int, **kwargs) -> None:
+	"""	 Deletes a timer created by set_timer_callback. A call that's already queued may still run.
+
+	Args:
+		timer (int): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.delete_timer_callback(timer, **kwargs)
+
 def destroy_context(**kwargs) -> None:
 	"""	 Destroys the Dear PyGui context.
 
@@ -8773,6 +8831,17 @@ def get_all_items(**kwargs) -> Union[List[int], Tuple[int, ...]]:
 
 	return internal_dpg.get_all_items(**kwargs)
 
+def get_allocation_stats(*, trim: bool =False, **kwargs) -> dict:
+	"""	 Returns item memory pool statistics: how many pool blocks were taken from the heap (pool_allocations) and how many were recycled (pool_reuses) since the start, how many blocks/bytes are currently kept for reuse, and how many times the buffer of a vector value (series columns, float vects, textures) had to grow (value_buffer_allocations). Items and their value storage come from the pools; strings and child lists still use the heap directly. Once an app has warmed up, setting values of unchanged sizes leaves both allocation counters where they are. Pools keep their free blocks until the context is destroyed or trim is set.
+
+	Args:
+		trim (bool, optional): Returns the blocks kept for reuse to the heap before gathering the statistics.
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_allocation_stats(trim=trim, **kwargs)
+
 def get_app_configuration(**kwargs) -> dict:
 	"""	 Returns app configuration.
 
@@ -8804,6 +8873,29 @@ def get_callback_queue(**kwargs) -> Any:
 
 	return internal_dpg.get_callback_queue(**kwargs)
 
+def get_callback_queue_columns(*, senders: Any =None, types: Any =None, values: Any =None, **kwargs) -> Any:
+	"""	 Columnar alternative to get_callback_queue for manual callback management. Returns (count, senders, types, values, objects, callbacks, user_data): sender ids (u64), sender item types (i32, -1 for frame/timer/viewport callbacks), app_data that is an int or a float (f64, NaN otherwise), a dict of row to app_data for other non-None app_data (bools and ints too large for a double included), and lists of callbacks and user_data. Columns are written into the given buffers if any; if there are more jobs than fit, the rest stay queued, and if the result can't be built, all of them do. This saves the per-job tuples and number objects; the objects dict and the callbacks and user_data lists are still created on every call.
+
+	Args:
+		senders (Any, optional): Optional writable buffer of format 'Q' (e.g. array('Q')) to fill with sender ids.
+		types (Any, optional): Optional writable buffer of format 'i' (e.g. array('i')) to fill with sender item types.
+		values (Any, optional): Optional writable buffer of format 'd' (e.g. array('d')) to fill with numeric app_data.
+	Returns:
+		Any
+	"""
+
+	return internal_dpg.get_callback_queue_columns(senders=senders, types=types, values=values, **kwargs)
+
+def get_callback_queue_stats(**kwargs) -> dict:
+	"""	 Returns callback queue statistics: number of pending calls, queue capacity, and how many calls have been dropped or coalesced so far.
+
+	Args:
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_callback_queue_stats(**kwargs)
+
 def get_clipboard_text(**kwargs) -> str:
 	"""	 New in 1.3. Gets the clipboard text.
 
@@ -8951,6 +9043,16 @@ def get_item_types(**kwargs) -> dict:
 
 	return internal_dpg.get_item_types(**kwargs)
 
+def get_memory_stats(**kwargs) -> dict:
+	"""	 Returns memory used by live items. 'types' maps each item type to its count, item_size (in-object bytes per item), number of allocated cold configs (drag and drop/scroll settings), and total bytes. Heap data owned by items (strings, values, children lists) is not included.
+
+	Args:
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_memory_stats(**kwargs)
+
 def get_mouse_drag_delta(**kwargs) -> float:
 	"""	 Returns mouse drag delta.
 
@@ -8972,6 +9074,16 @@ def get_mouse_pos(*, local: bool =True, **kwargs) -> Union[List[int], Tuple[int,
 
 	return internal_dpg.get_mouse_pos(local=local, **kwargs)
 
+def get_pending_deletions(**kwargs) -> int:
+	"""	 Returns the number of deleted items that are still waiting to be destroyed (see deferred_deletion_threshold in configure_app).
+
+	Args:
+	Returns:
+		int
+	"""
+
+	return internal_dpg.get_pending_deletions(**kwargs)
+
 def get_platform(**kwargs) -> int:
 	"""	 New in 1.6. Returns platform constant.
 
@@ -9003,6 +9115,16 @@ def get_plot_query_rects(plot : Union[int, str], **kwargs) -> List[List[float]]:
 
 	return internal_dpg.get_plot_query_rects(plot, **kwargs)
 
+def get_render_stats(**kwargs) -> dict:
+	"""	 Returns render loop statistics: the number of frames rendered and of render_dearpygui_frame calls that rendered nothing (the viewport was minimized, or nothing changed with wait_for_input), the smoothed frame time and its jitter in seconds, and the size of the last frame's draw data (draw lists, vertices, indices, draw commands and texture binds).
+
+	Args:
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_render_stats(**kwargs)
+
 def get_selected_links(node_editor : Union[int, str], **kwargs) -> List[List[str]]:
 	"""	 Returns a node editor's selected links.
 
@@ -9048,16 +9170,17 @@ def get_total_time(**kwargs) -> float:
 
 	return internal_dpg.get_total_time(**kwargs)
 
-def get_value(item : Union[int, str], **kwargs) -> Any:
+def get_value(item : Union[int, str], *, as_buffer: bool =False, **kwargs) -> Any:
 	"""	 Returns an item's value.
 
 	Args:
 		item (Union[int, str]): 
+		as_buffer (bool, optional): Array values (series, float vectors, textures) are returned as read-only memoryview snapshots instead of lists.
 	Returns:
 		Any
 	"""
 
-	return internal_dpg.get_value(item, **kwargs)
+	return internal_dpg.get_value(item, as_buffer=as_buffer, **kwargs)
 
 def get_values(items : Union[List[int], Tuple[int, ...]], **kwargs) -> Any:
 	"""	 Returns values of a list of items.
@@ -9755,6 +9878,20 @@ def set_table_row_color(table : Union[int, str], row : int, color : Union[List[i
 
 	return internal_dpg.set_table_row_color(table, row, color, **kwargs)
 
+def set_timer_callback(interval : int, callback : Callable, *, repeat: bool =True, user_data: Any =None, **kwargs) -> int:
+	"""	 Sets a callback to run after a time interval, once or repeatedly. The callback gets the timer as the sender. Timers keep firing when wait_for_input is enabled. Returns the timer.
+
+	Args:
+		interval (int): Milliseconds between calls (or before the only call, if repeat is False).
+		callback (Callable): 
+		repeat (bool, optional): Keep calling the callback every interval until the timer is deleted.
+		user_data (Any, optional): Optional user data to send to the callback
+	Returns:
+		int
+	"""
+
+	return internal_dpg.set_timer_callback(interval, callback, repeat=repeat, user_data=user_data, **kwargs)
+
 def set_value(item : Union[int, str], value : Any, **kwargs) -> None:
 	"""	 Set's an item's value.
 
@@ -9767,6 +9904,18 @@ def set_value(item : Union[int, str], value : Any, **kwargs) -> None:
 
 	return internal_dpg.set_value(item, value, **kwargs)
 
+def set_values(items : Union[List[int], Tuple[int, ...]], values : Any, **kwargs) -> None:
+	"""	 Sets the values of a list of items.
+
+	Args:
+		items (Union[List[int], Tuple[int, ...]]): 
+		values (Any): One value per item. Numeric buffers (e.g. numpy arrays) are written to int, float, double and bool items without creating Python objects.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_values(items, values, **kwargs)
+
 def set_viewport_resize_callback(callback : Callable, *, user_data: Any =None, **kwargs) -> str:
 	"""	 Sets a callback to run on viewport resize.
 
@@ -10197,6 +10346,8 @@ def unstage(item : Union[int, str], **kwargs) -> None:
 mvScrollDirection_Vertical=internal_dpg.mvScrollDirection_Vertical
 mvLoadInd_DottedCircle=internal_dpg.mvLoadInd_DottedCircle
 mvLoadInd_Ring=internal_dpg.mvLoadInd_Ring
+mvCallbackQueue_DropNewest=internal_dpg.mvCallbackQueue_DropNewest
+mvCallbackQueue_DropOldest=internal_dpg.mvCallbackQueue_DropOldest
 mvPlatform_Windows=internal_dpg.mvPlatform_Windows
 mvPlatform_Apple=internal_dpg.mvPlatform_Apple
 mvPlatform_Linux=internal_dpg.mvPlatform_Linux
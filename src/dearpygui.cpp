@@ -17,7 +17,7 @@
 #include <cstdlib>
 #include <stb_image.h>
 
-#define MV_ADD_COMMAND(x) methods.push_back({ #x, (PyCFunction)x, METH_VARARGS | METH_KEYWORDS, GetParsers()[#x].documentation.c_str() });
+#define MV_ADD_COMMAND(x) methods.push_back({ #x, (PyCFunction)x, METH_VARARGS | METH_KEYWORDS, GetCommandParser(mvCommand::x).documentation.c_str() });
 
 const std::map<std::string, mvPythonParser>& 
 GetModuleParsers()
@@ -91,6 +91,9 @@ GetModuleConstants()
 		ModuleConstants.push_back({"mvLoadInd_DottedCircle", mvLoadingIndicator::Style_DottedCircle });
 		ModuleConstants.push_back({"mvLoadInd_Ring", mvLoadingIndicator::Style_Ring });
 
+		ModuleConstants.push_back({"mvCallbackQueue_DropNewest", (long)mvCallbackQueuePolicy::DropNewest });
+		ModuleConstants.push_back({"mvCallbackQueue_DropOldest", (long)mvCallbackQueuePolicy::DropOldest });
+
 		ModuleConstants.push_back({"mvPlatform_Windows", 0L });
 		ModuleConstants.push_back({"mvPlatform_Apple", 1L });
 		ModuleConstants.push_back({"mvPlatform_Linux", 2L });
@@ -472,6 +475,14 @@ GetModuleConstants()
 	return ModuleConstants;
 }
 
+static mvUUID
+ToItemRef(PyObject* item)
+{
+	if (PyUnicode_Check(item))
+		return GetIdFromAlias(*GContext->itemRegistry, ToString(item));
+	return ToUUID(item);
+}
+
 static void
 PreFetchItemInfo(mvUUID* out_name, mvUUID* out_parent, mvUUID* out_before, std::string* out_alias, PyObject* args, PyObject* kwargs)
 {
@@ -479,20 +490,10 @@ PreFetchItemInfo(mvUUID* out_name, mvUUID* out_parent, mvUUID* out_before, std::
 	if (kwargs)
 	{
 		if (PyObject* item = PyDict_GetItemString(kwargs, "parent"))
-		{
-			if (PyUnicode_Check(item))
-				*out_parent = GetIdFromAlias(*GContext->itemRegistry, ToString(item));
-			else
-				*out_parent = ToUUID(item);
-		}
+			*out_parent = ToItemRef(item);
 
 		if (PyObject* item = PyDict_GetItemString(kwargs, "before"))
-		{
-			if (PyUnicode_Check(item))
-				*out_before = GetIdFromAlias(*GContext->itemRegistry, ToString(item));
-			else
-				*out_before = ToUUID(item);
-		}
+			*out_before = ToItemRef(item);
 
 		if (PyObject* item = PyDict_GetItemString(kwargs, "tag"))
 		{
@@ -508,8 +509,8 @@ PreFetchItemInfo(mvUUID* out_name, mvUUID* out_parent, mvUUID* out_before, std::
 	}
 }
 
-static PyObject*
-common_constructor(const char* command, mvAppItemType type, PyObject* self, PyObject* args, PyObject* kwargs)
+std::shared_ptr<mvAppItem>
+ConstructItem(mvAppItemType type, PyObject* args, PyObject* kwargs, PyObject* parentOverride)
 {
 
 	std::shared_ptr<mvAppItem> item = nullptr;
@@ -520,15 +521,21 @@ common_constructor(const char* command, mvAppItemType type, PyObject* self, PyOb
 
 	PreFetchItemInfo(&id, &parent, &before, &alias, args, kwargs);
 
-	// generate id if not specified
+	if (parentOverride)
+		parent = ToItemRef(parentOverride);
+
+	// generate id if not specified; it comes with a slot in the item registry
 	if (id == 0)
-		id = GenerateUUID();
+	{
+		mvPySafeLockGuard lk(GContext->mutex);
+		id = ReserveItemSlot(*GContext->itemRegistry);
+	}
 
 	item = DearPyGui::CreateEntity(type, id);
 
 	i32 flags = DearPyGui::GetEntityDesciptionFlags(type);
 	if (flags & MV_ITEM_DESC_DRAW_CMP)
-		item->drawInfo = std::make_shared<mvAppItemDrawInfo>();
+		item->drawInfo = mvAllocateShared<mvAppItemDrawInfo>();
 
 	// register alias if present
 	if (!alias.empty())
@@ -538,7 +545,7 @@ common_constructor(const char* command, mvAppItemType type, PyObject* self, PyOb
 		AddAlias(*GContext->itemRegistry, item->config.alias, item->uuid);
 	}
 
-	VerifyArgumentCount(GetParsers()[command], args);
+	VerifyArgumentCount(GetItemParser(type), args);
 
 	if(!GContext->IO.skipRequiredArgs)
 		item->handleSpecificRequiredArgs(args);
@@ -547,17 +554,25 @@ common_constructor(const char* command, mvAppItemType type, PyObject* self, PyOb
 		item->handleSpecificPositionalArgs(args);
 
 	if(!GContext->IO.skipKeywordArgs)
-		item->handleKeywordArgs(kwargs, command);
+		item->handleKeywordArgs(kwargs, GetItemParser(type));
 
 	AddItemWithRuntimeChecks((*GContext->itemRegistry), item, parent, before);
 
-	GContext->itemRegistry->allItems[id] = item.get();
+	{
+		mvPySafeLockGuard lk(GContext->mutex);
+		RegisterItem(*GContext->itemRegistry, item.get());
+	}
 
-	// return raw UUID if alias not used
-	if (item->config.alias.empty())
-		return Py_BuildValue("K", id);
+	return item;
+}
 
-	return ToPyString(item->config.alias);
+static PyObject*
+common_constructor(const char* command, mvAppItemType type, PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	std::shared_ptr<mvAppItem> item = ConstructItem(type, args, kwargs, nullptr);
+
+	// return raw UUID if alias not used
+	return ToPyUUID(item.get());
 }
 
 #define X(el) static PyObject* el##_command(PyObject* self, PyObject* args, PyObject* kwargs){return common_constructor(GetEntityCommand(mvAppItemType::el), mvAppItemType::el, self, args, kwargs);}
@@ -571,184 +586,13 @@ PyInit__dearpygui(void)
 	static std::vector<PyMethodDef> methods;
 	methods.clear();
 
-	#define X(el) methods.push_back({GetEntityCommand(mvAppItemType::el), (PyCFunction)el##_command, METH_VARARGS | METH_KEYWORDS, GetParsers()[GetEntityCommand(mvAppItemType::el)].documentation.c_str()});
+	#define X(el) methods.push_back({GetEntityCommand(mvAppItemType::el), (PyCFunction)el##_command, METH_VARARGS | METH_KEYWORDS, GetItemParser(mvAppItemType::el).documentation.c_str()});
 	MV_ITEM_TYPES
 	#undef X
 
-	// color maps
-	MV_ADD_COMMAND(bind_colormap);
-	MV_ADD_COMMAND(sample_colormap);
-	MV_ADD_COMMAND(get_colormap_color);
-
-	// file dialog
-	MV_ADD_COMMAND(get_file_dialog_info);
-
-	// window commands
-	MV_ADD_COMMAND(set_x_scroll);
-	MV_ADD_COMMAND(set_y_scroll);
-	MV_ADD_COMMAND(get_x_scroll);
-	MV_ADD_COMMAND(get_y_scroll);
-	MV_ADD_COMMAND(get_x_scroll_max);
-	MV_ADD_COMMAND(get_y_scroll_max);
-
-	// draw layer
-	MV_ADD_COMMAND(set_clip_space);
-
-	// draw node
-	MV_ADD_COMMAND(apply_transform);
-	MV_ADD_COMMAND(create_rotation_matrix);
-	MV_ADD_COMMAND(create_translation_matrix);
-	MV_ADD_COMMAND(create_scale_matrix);
-	MV_ADD_COMMAND(create_lookat_matrix);
-	MV_ADD_COMMAND(create_perspective_matrix);
-	MV_ADD_COMMAND(create_orthographic_matrix);
-	MV_ADD_COMMAND(create_fps_matrix);
-
-	// fonts
-	MV_ADD_COMMAND(bind_font);
-	MV_ADD_COMMAND(get_text_size);
-	MV_ADD_COMMAND(get_global_font_scale);
-	MV_ADD_COMMAND(set_global_font_scale);
-
-	// node editor
-	MV_ADD_COMMAND(get_selected_nodes);
-	MV_ADD_COMMAND(get_selected_links);
-	MV_ADD_COMMAND(clear_selected_nodes);
-	MV_ADD_COMMAND(clear_selected_links);
-
-	// plots
-	MV_ADD_COMMAND(get_plot_query_rects);
-
-	// plot axes
-	MV_ADD_COMMAND(reset_axis_ticks);
-	MV_ADD_COMMAND(set_axis_ticks);
-	MV_ADD_COMMAND(set_axis_limits_constraints);
-	MV_ADD_COMMAND(reset_axis_limits_constraints);
-	MV_ADD_COMMAND(set_axis_zoom_constraints);
-	MV_ADD_COMMAND(reset_axis_zoom_constraints);
-	MV_ADD_COMMAND(set_axis_limits);
-	MV_ADD_COMMAND(set_axis_limits_auto);
-	MV_ADD_COMMAND(get_axis_limits);
-	MV_ADD_COMMAND(fit_axis_data);
-
-	// tables
-	MV_ADD_COMMAND(highlight_table_column);
-	MV_ADD_COMMAND(unhighlight_table_column);
-	MV_ADD_COMMAND(set_table_row_color);
-	MV_ADD_COMMAND(unset_table_row_color);
-	MV_ADD_COMMAND(highlight_table_cell);
-	MV_ADD_COMMAND(unhighlight_table_cell);
-	MV_ADD_COMMAND(highlight_table_row);
-	MV_ADD_COMMAND(unhighlight_table_row);
-	MV_ADD_COMMAND(is_table_column_highlighted);
-	MV_ADD_COMMAND(is_table_row_highlighted);
-	MV_ADD_COMMAND(is_table_cell_highlighted);
-
-	// themes
-	MV_ADD_COMMAND(bind_theme);
-
-	// tools
-	MV_ADD_COMMAND(show_tool);
-
-	// callback registry
-	MV_ADD_COMMAND(set_frame_callback);
-	MV_ADD_COMMAND(set_exit_callback);
-	MV_ADD_COMMAND(set_viewport_resize_callback);
-
-	// viewport
-	MV_ADD_COMMAND(show_viewport);
-	MV_ADD_COMMAND(create_viewport);
-	MV_ADD_COMMAND(configure_viewport);
-	MV_ADD_COMMAND(maximize_viewport);
-	MV_ADD_COMMAND(minimize_viewport);
-	MV_ADD_COMMAND(get_viewport_configuration);
-	MV_ADD_COMMAND(is_viewport_ok);
-	MV_ADD_COMMAND(toggle_viewport_fullscreen);
-
-	// context
-	MV_ADD_COMMAND(create_context);
-	MV_ADD_COMMAND(destroy_context);
-	MV_ADD_COMMAND(lock_mutex);
-	MV_ADD_COMMAND(unlock_mutex);
-	MV_ADD_COMMAND(setup_dearpygui);
-	MV_ADD_COMMAND(render_dearpygui_frame);
-	MV_ADD_COMMAND(get_delta_time);
-	MV_ADD_COMMAND(get_total_time);
-	MV_ADD_COMMAND(stop_dearpygui);
-	MV_ADD_COMMAND(is_dearpygui_running);
-	MV_ADD_COMMAND(generate_uuid);
-	MV_ADD_COMMAND(save_init_file);
-	MV_ADD_COMMAND(output_frame_buffer);
-	MV_ADD_COMMAND(load_image);
-	MV_ADD_COMMAND(save_image);
-	// MV_ADD_COMMAND(set_decimal_point);
-	MV_ADD_COMMAND(split_frame);
-	MV_ADD_COMMAND(get_frame_count);
-	MV_ADD_COMMAND(get_frame_rate);
-	MV_ADD_COMMAND(get_app_configuration);
-	MV_ADD_COMMAND(configure_app);
-	MV_ADD_COMMAND(get_drawing_mouse_pos);
-	MV_ADD_COMMAND(is_mouse_button_dragging);
-	MV_ADD_COMMAND(is_mouse_button_down);
-	MV_ADD_COMMAND(is_mouse_button_clicked);
-	MV_ADD_COMMAND(is_mouse_button_double_clicked);
-	MV_ADD_COMMAND(is_mouse_button_released);
-	MV_ADD_COMMAND(get_mouse_drag_delta);
-	MV_ADD_COMMAND(get_mouse_pos);
-	MV_ADD_COMMAND(get_plot_mouse_pos);
-	MV_ADD_COMMAND(is_key_pressed);
-	MV_ADD_COMMAND(is_key_released);
-	MV_ADD_COMMAND(is_key_down);
-	MV_ADD_COMMAND(get_callback_queue);
-	MV_ADD_COMMAND(set_clipboard_text);
-	MV_ADD_COMMAND(get_clipboard_text);
-
-	// item registry
-	MV_ADD_COMMAND(focus_item);
-	MV_ADD_COMMAND(get_aliases);
-	MV_ADD_COMMAND(add_alias);
-	MV_ADD_COMMAND(remove_alias);
-	MV_ADD_COMMAND(does_alias_exist);
-	MV_ADD_COMMAND(get_alias_id);
-	MV_ADD_COMMAND(move_item);
-	MV_ADD_COMMAND(delete_item);
-	MV_ADD_COMMAND(does_item_exist);
-	MV_ADD_COMMAND(move_item_down);
-	MV_ADD_COMMAND(move_item_up);
-	MV_ADD_COMMAND(get_windows);
-	MV_ADD_COMMAND(get_all_items);
-	MV_ADD_COMMAND(get_active_window);
-	MV_ADD_COMMAND(get_focused_item);
-	MV_ADD_COMMAND(set_primary_window);
-	MV_ADD_COMMAND(push_container_stack);
-	MV_ADD_COMMAND(pop_container_stack);
-	MV_ADD_COMMAND(top_container_stack);
-	MV_ADD_COMMAND(empty_container_stack);
-	MV_ADD_COMMAND(last_item);
-	MV_ADD_COMMAND(last_container);
-	MV_ADD_COMMAND(last_root);
-	MV_ADD_COMMAND(unstage);
-	MV_ADD_COMMAND(reorder_items);
-	MV_ADD_COMMAND(show_imgui_demo);
-	MV_ADD_COMMAND(show_implot_demo);
-	MV_ADD_COMMAND(show_item_debug);
-	MV_ADD_COMMAND(get_item_info);
-	MV_ADD_COMMAND(set_item_alias);
-	MV_ADD_COMMAND(get_item_alias);
-	MV_ADD_COMMAND(get_item_types);
-	MV_ADD_COMMAND(get_item_configuration);
-	MV_ADD_COMMAND(get_item_state);
-	MV_ADD_COMMAND(configure_item);
-	MV_ADD_COMMAND(get_value);
-	MV_ADD_COMMAND(get_values);
-	MV_ADD_COMMAND(set_value);
-	MV_ADD_COMMAND(reset_pos);
-	MV_ADD_COMMAND(set_item_children);
-	MV_ADD_COMMAND(bind_item_handler_registry);
-	MV_ADD_COMMAND(bind_item_font);
-	MV_ADD_COMMAND(bind_item_theme);
-	MV_ADD_COMMAND(capture_next_item);
-	MV_ADD_COMMAND(get_platform);
+	#define X(el) MV_ADD_COMMAND(el)
+	MV_COMMANDS
+	#undef X
 
 	methods.push_back({ NULL, NULL, 0, NULL });
 
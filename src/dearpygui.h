@@ -2,9 +2,16 @@
 
 #include <map>
 #include <vector>
+#include <memory>
 #include "mvPyUtils.h"
 
+enum class mvAppItemType;
+
 PyMODINIT_FUNC PyInit__dearpygui(void);
 
 const std::map<std::string, mvPythonParser>& GetModuleParsers();
-const std::vector<std::pair<std::string, long>>& GetModuleConstants();
\ No newline at end of file
+const std::vector<std::pair<std::string, long>>& GetModuleConstants();
+
+// Creates, configures and registers an item the way the add_* commands do.
+// `parent`, if not null, takes precedence over the "parent" keyword.
+std::shared_ptr<mvAppItem> ConstructItem(mvAppItemType type, PyObject* args, PyObject* kwargs, PyObject* parent);
\ No newline at end of file
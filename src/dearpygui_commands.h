@@ -23,10 +23,11 @@ bind_colormap(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	PyObject* sourceraw;
 
-	if (!Parse((GetParsers())["bind_colormap"], args, kwargs, __FUNCTION__, &itemraw, &sourceraw))
+	if (!Parse(GetCommandParser(mvCommand::bind_colormap), args, kwargs, __FUNCTION__, &itemraw, &sourceraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvUUID source = GetIDFromPyObject(sourceraw);
@@ -90,6 +91,7 @@ bind_colormap(PyObject* self, PyObject* args, PyObject* kwargs)
 	}
 
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -99,10 +101,11 @@ sample_colormap(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	float t;
 
-	if (!Parse((GetParsers())["sample_colormap"], args, kwargs, __FUNCTION__, &itemraw, &t))
+	if (!Parse(GetCommandParser(mvCommand::sample_colormap), args, kwargs, __FUNCTION__, &itemraw, &t))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -141,10 +144,11 @@ get_colormap_color(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	int index;
 
-	if (!Parse((GetParsers())["get_colormap_color"], args, kwargs, __FUNCTION__, &itemraw, &index))
+	if (!Parse(GetCommandParser(mvCommand::get_colormap_color), args, kwargs, __FUNCTION__, &itemraw, &index))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -176,10 +180,11 @@ get_file_dialog_info(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* file_dialog_raw;
 
-	if (!Parse((GetParsers())["get_file_dialog_info"], args, kwargs, __FUNCTION__, &file_dialog_raw))
+	if (!Parse(GetCommandParser(mvCommand::get_file_dialog_info), args, kwargs, __FUNCTION__, &file_dialog_raw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID file_dialog = GetIDFromPyObject(file_dialog_raw);
 
@@ -209,11 +214,12 @@ set_x_scroll(PyObject* self, PyObject* args, PyObject* kwargs)
 	float value;
 	int when = (int)mvSetScrollFlags_Delayed;
 
-	if (!Parse((GetParsers())["set_x_scroll"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::set_x_scroll), args, kwargs, __FUNCTION__,
 		&itemraw, &value, &when))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -227,8 +233,8 @@ set_x_scroll(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	if (DearPyGui::GetApplicableState(window->type) & MV_STATE_SCROLL)
 	{
-		window->config.scrollX = value;
-		window->config.scrollXFlags = (mvSetScrollFlags)when;
+		window->config.editCold().scrollX = value;
+		window->config.editCold().scrollXFlags = (mvSetScrollFlags)when;
 	}
 	else
 	{
@@ -237,6 +243,7 @@ set_x_scroll(PyObject* self, PyObject* args, PyObject* kwargs)
 		return nullptr;
 	}
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -248,11 +255,12 @@ set_y_scroll(PyObject* self, PyObject* args, PyObject* kwargs)
 	float value;
 	int when = (int)mvSetScrollFlags_Delayed;
 
-	if (!Parse((GetParsers())["set_y_scroll"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::set_y_scroll), args, kwargs, __FUNCTION__,
 		&itemraw, &value, &when))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -266,8 +274,8 @@ set_y_scroll(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	if (DearPyGui::GetApplicableState(window->type) & MV_STATE_SCROLL)
 	{
-		window->config.scrollY = value;
-		window->config.scrollYFlags = (mvSetScrollFlags)when;
+		window->config.editCold().scrollY = value;
+		window->config.editCold().scrollYFlags = (mvSetScrollFlags)when;
 	}
 	else
 	{
@@ -276,6 +284,7 @@ set_y_scroll(PyObject* self, PyObject* args, PyObject* kwargs)
 		return nullptr;
 	}
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -285,11 +294,12 @@ get_x_scroll(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["get_x_scroll"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::get_x_scroll), args, kwargs, __FUNCTION__,
 		&itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -321,11 +331,12 @@ get_y_scroll(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["get_y_scroll"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::get_y_scroll), args, kwargs, __FUNCTION__,
 		&itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -357,11 +368,12 @@ get_x_scroll_max(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["get_x_scroll_max"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::get_x_scroll_max), args, kwargs, __FUNCTION__,
 		&itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -393,11 +405,12 @@ get_y_scroll_max(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["get_y_scroll_max"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::get_y_scroll_max), args, kwargs, __FUNCTION__,
 		&itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -434,11 +447,12 @@ set_clip_space(PyObject* self, PyObject* args, PyObject* kwargs)
 	float mindepth = 0.0f;
 	float maxdepth = 0.0f;
 
-	if (!Parse((GetParsers())["set_clip_space"], args, kwargs, __FUNCTION__, &itemraw,
+	if (!Parse(GetCommandParser(mvCommand::set_clip_space), args, kwargs, __FUNCTION__, &itemraw,
 		&topleftx, &toplefty, &width, &height, &mindepth, &maxdepth))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -476,6 +490,7 @@ set_clip_space(PyObject* self, PyObject* args, PyObject* kwargs)
 	}
 
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -485,10 +500,11 @@ apply_transform(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	PyObject* transform;
 
-	if (!Parse((GetParsers())["apply_transform"], args, kwargs, __FUNCTION__, &itemraw, &transform))
+	if (!Parse(GetCommandParser(mvCommand::apply_transform), args, kwargs, __FUNCTION__, &itemraw, &transform))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -516,6 +532,7 @@ apply_transform(PyObject* self, PyObject* args, PyObject* kwargs)
 	}
 
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -526,7 +543,7 @@ create_rotation_matrix(PyObject* self, PyObject* args, PyObject* kwargs)
 	float angle = 0.0f;
 	PyObject* axis;
 
-	if (!Parse((GetParsers())["create_rotation_matrix"], args, kwargs, __FUNCTION__, &angle, &axis))
+	if (!Parse(GetCommandParser(mvCommand::create_rotation_matrix), args, kwargs, __FUNCTION__, &angle, &axis))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
@@ -551,7 +568,7 @@ create_perspective_matrix(PyObject* self, PyObject* args, PyObject* kwargs)
 	float zNear = 0.0f;
 	float zFar = 0.0f;
 
-	if (!Parse((GetParsers())["create_perspective_matrix"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::create_perspective_matrix), args, kwargs, __FUNCTION__,
 		&fov, &aspect, &zNear, &zFar))
 		return nullptr;
 
@@ -577,7 +594,7 @@ create_orthographic_matrix(PyObject* self, PyObject* args, PyObject* kwargs)
 	float zNear = 0.0f;
 	float zFar = 0.0f;
 
-	if (!Parse((GetParsers())["create_orthographic_matrix"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::create_orthographic_matrix), args, kwargs, __FUNCTION__,
 		&left, &right, &bottom, &top, &zNear, &zFar))
 		return nullptr;
 
@@ -599,7 +616,7 @@ create_translation_matrix(PyObject* self, PyObject* args, PyObject* kwargs)
 	static mvMat4 identity = mvIdentityMat4();
 	PyObject* axis;
 
-	if (!Parse((GetParsers())["create_translation_matrix"], args, kwargs, __FUNCTION__, &axis))
+	if (!Parse(GetCommandParser(mvCommand::create_translation_matrix), args, kwargs, __FUNCTION__, &axis))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
@@ -622,7 +639,7 @@ create_scale_matrix(PyObject* self, PyObject* args, PyObject* kwargs)
 	static mvMat4 identity = mvIdentityMat4();
 	PyObject* axis;
 
-	if (!Parse((GetParsers())["create_scale_matrix"], args, kwargs, __FUNCTION__, &axis))
+	if (!Parse(GetCommandParser(mvCommand::create_scale_matrix), args, kwargs, __FUNCTION__, &axis))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
@@ -647,7 +664,7 @@ create_lookat_matrix(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* center;
 	PyObject* up;
 
-	if (!Parse((GetParsers())["create_lookat_matrix"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::create_lookat_matrix), args, kwargs, __FUNCTION__,
 		&eye, &center, &up))
 		return nullptr;
 
@@ -675,7 +692,7 @@ create_fps_matrix(PyObject* self, PyObject* args, PyObject* kwargs)
 	f32 pitch = 0.0f;
 	f32 yaw = 0.0f;
 
-	if (!Parse((GetParsers())["create_fps_matrix"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::create_fps_matrix), args, kwargs, __FUNCTION__,
 		&eye, &pitch, &yaw))
 		return nullptr;
 
@@ -698,11 +715,12 @@ bind_font(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["bind_font"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::bind_font), args, kwargs, __FUNCTION__,
 		&itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID itemId = GetIDFromPyObject(itemraw);
 
@@ -729,6 +747,7 @@ bind_font(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	mvToolManager::GetFontManager().setDefaultFont(item);
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -740,11 +759,12 @@ get_text_size(PyObject* self, PyObject* args, PyObject* kwargs)
 	float wrap_width = -1.0f;
 	PyObject* fontRaw;
 
-	if (!Parse((GetParsers())["get_text_size"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::get_text_size), args, kwargs, __FUNCTION__,
 		&text, &wrap_width, &fontRaw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID font = GetIDFromPyObject(fontRaw);
 
@@ -796,10 +816,11 @@ get_selected_nodes(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* node_editor_raw;
 
-	if (!Parse((GetParsers())["get_selected_nodes"], args, kwargs, __FUNCTION__, &node_editor_raw))
+	if (!Parse(GetCommandParser(mvCommand::get_selected_nodes), args, kwargs, __FUNCTION__, &node_editor_raw))
 		return ToPyBool(false);
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID node_editor = GetIDFromPyObject(node_editor_raw);
 
@@ -831,10 +852,11 @@ get_selected_links(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* node_editor_raw;
 
-	if (!Parse((GetParsers())["get_selected_links"], args, kwargs, __FUNCTION__, &node_editor_raw))
+	if (!Parse(GetCommandParser(mvCommand::get_selected_links), args, kwargs, __FUNCTION__, &node_editor_raw))
 		return ToPyBool(false);
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID node_editor = GetIDFromPyObject(node_editor_raw);
 
@@ -865,10 +887,11 @@ clear_selected_links(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* node_editor_raw;
 
-	if (!Parse((GetParsers())["clear_selected_links"], args, kwargs, __FUNCTION__, &node_editor_raw))
+	if (!Parse(GetCommandParser(mvCommand::clear_selected_links), args, kwargs, __FUNCTION__, &node_editor_raw))
 		return ToPyBool(false);
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID node_editor = GetIDFromPyObject(node_editor_raw);
 
@@ -899,10 +922,11 @@ clear_selected_nodes(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* node_editor_raw;
 
-	if (!Parse((GetParsers())["clear_selected_nodes"], args, kwargs, __FUNCTION__, &node_editor_raw))
+	if (!Parse(GetCommandParser(mvCommand::clear_selected_nodes), args, kwargs, __FUNCTION__, &node_editor_raw))
 		return ToPyBool(false);
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID node_editor = GetIDFromPyObject(node_editor_raw);
 
@@ -934,10 +958,11 @@ get_plot_query_rects(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* plotraw;
 	auto tag = "get_plot_query_rects";
 
-	if (!Parse((GetParsers())[tag], args, kwargs, __FUNCTION__, &plotraw))
+	if (!Parse(GetCommandParser(mvCommand::get_plot_query_rects), args, kwargs, __FUNCTION__, &plotraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -972,12 +997,13 @@ set_axis_ticks(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* plotraw;
 	PyObject* label_pairs;
 
-	if (!Parse((GetParsers())["set_axis_ticks"], args, kwargs, __FUNCTION__, &plotraw, &label_pairs))
+	if (!Parse(GetCommandParser(mvCommand::set_axis_ticks), args, kwargs, __FUNCTION__, &plotraw, &label_pairs))
 		return nullptr;
 
 	auto mlabel_pairs = ToVectPairStringFloat(label_pairs);
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -1016,6 +1042,7 @@ set_axis_ticks(PyObject* self, PyObject* args, PyObject* kwargs)
 	for (const auto& item : graph->configData.labels)
 		graph->configData.clabels.push_back(item.data());
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1027,10 +1054,11 @@ set_axis_limits_constraints(PyObject* self, PyObject* args, PyObject* kwargs)
 	float vmax;
 	auto tag = "set_axis_limits_constraints";
 
-	if (!Parse((GetParsers())[tag], args, kwargs, __FUNCTION__, &axisraw, &vmin, &vmax))
+	if (!Parse(GetCommandParser(mvCommand::set_axis_limits_constraints), args, kwargs, __FUNCTION__, &axisraw, &vmin, &vmax))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1052,6 +1080,7 @@ set_axis_limits_constraints(PyObject* self, PyObject* args, PyObject* kwargs)
 	mvPlotAxis* graph = static_cast<mvPlotAxis*>(aplot);
 	graph->configData.setLimitsRange = true;
 	graph->configData.constraints_range = ImVec2(vmin, vmax);
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1061,10 +1090,11 @@ reset_axis_limits_constraints(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* axisraw;
 	auto tag = "reset_axis_limits_constraints";
 
-	if (!Parse((GetParsers())[tag], args, kwargs, __FUNCTION__, &axisraw))
+	if (!Parse(GetCommandParser(mvCommand::reset_axis_limits_constraints), args, kwargs, __FUNCTION__, &axisraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1085,6 +1115,7 @@ reset_axis_limits_constraints(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	mvPlotAxis* graph = static_cast<mvPlotAxis*>(aplot);
 	graph->configData.setLimitsRange = false;
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1096,10 +1127,11 @@ set_axis_zoom_constraints(PyObject* self, PyObject* args, PyObject* kwargs)
 	float vmax;
 	auto tag = "set_axis_zoom_constraints";
 
-	if (!Parse((GetParsers())[tag], args, kwargs, __FUNCTION__, &axisraw, &vmin, &vmax))
+	if (!Parse(GetCommandParser(mvCommand::set_axis_zoom_constraints), args, kwargs, __FUNCTION__, &axisraw, &vmin, &vmax))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1121,6 +1153,7 @@ set_axis_zoom_constraints(PyObject* self, PyObject* args, PyObject* kwargs)
 	mvPlotAxis* graph = static_cast<mvPlotAxis*>(aplot);
 	graph->configData.setZoomRange = true;
 	graph->configData.zoom_range = ImVec2(vmin, vmax);
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1131,10 +1164,11 @@ reset_axis_zoom_constraints(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* axisraw;
 	auto tag = "reset_axis_zoom_constraints";
 
-	if (!Parse((GetParsers())[tag], args, kwargs, __FUNCTION__, &axisraw))
+	if (!Parse(GetCommandParser(mvCommand::reset_axis_zoom_constraints), args, kwargs, __FUNCTION__, &axisraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1156,6 +1190,7 @@ reset_axis_zoom_constraints(PyObject* self, PyObject* args, PyObject* kwargs)
 	mvPlotAxis* graph = static_cast<mvPlotAxis*>(aplot);
 	graph->configData.setZoomRange = false;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1166,10 +1201,11 @@ set_axis_limits(PyObject* self, PyObject* args, PyObject* kwargs)
 	float ymin;
 	float ymax;
 
-	if (!Parse((GetParsers())["set_axis_limits"], args, kwargs, __FUNCTION__, &axisraw, &ymin, &ymax))
+	if (!Parse(GetCommandParser(mvCommand::set_axis_limits), args, kwargs, __FUNCTION__, &axisraw, &ymin, &ymax))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1191,6 +1227,7 @@ set_axis_limits(PyObject* self, PyObject* args, PyObject* kwargs)
 	mvPlotAxis* graph = static_cast<mvPlotAxis*>(aplot);
 	graph->configData.setLimits = true;
 	graph->configData.limits = ImVec2(ymin, ymax);
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1199,10 +1236,11 @@ set_axis_limits_auto(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* axisraw;
 
-	if (!Parse((GetParsers())["set_axis_limits_auto"], args, kwargs, __FUNCTION__, &axisraw))
+	if (!Parse(GetCommandParser(mvCommand::set_axis_limits_auto), args, kwargs, __FUNCTION__, &axisraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1225,6 +1263,7 @@ set_axis_limits_auto(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	graph->configData.setLimits = false;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1233,10 +1272,11 @@ fit_axis_data(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* axisraw;
 
-	if (!Parse((GetParsers())["fit_axis_data"], args, kwargs, __FUNCTION__, &axisraw))
+	if (!Parse(GetCommandParser(mvCommand::fit_axis_data), args, kwargs, __FUNCTION__, &axisraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1261,6 +1301,7 @@ fit_axis_data(PyObject* self, PyObject* args, PyObject* kwargs)
 	static_cast<mvPlot*>(graph->info.parentPtr)->configData._fitDirty = true;
 	static_cast<mvPlot*>(graph->info.parentPtr)->configData._axisfitDirty[graph->configData.axis] = true;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1269,10 +1310,11 @@ get_axis_limits(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* plotraw;
 
-	if (!Parse((GetParsers())["get_axis_limits"], args, kwargs, __FUNCTION__, &plotraw))
+	if (!Parse(GetCommandParser(mvCommand::get_axis_limits), args, kwargs, __FUNCTION__, &plotraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -1302,10 +1344,11 @@ reset_axis_ticks(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* plotraw;
 
-	if (!Parse((GetParsers())["reset_axis_ticks"], args, kwargs, __FUNCTION__, &plotraw))
+	if (!Parse(GetCommandParser(mvCommand::reset_axis_ticks), args, kwargs, __FUNCTION__, &plotraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -1330,6 +1373,7 @@ reset_axis_ticks(PyObject* self, PyObject* args, PyObject* kwargs)
 	graph->configData.clabels.clear();
 	graph->configData.labelLocations.clear();
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1340,10 +1384,11 @@ highlight_table_column(PyObject* self, PyObject* args, PyObject* kwargs)
 	int column = 0;
 	PyObject* color;
 
-	if (!Parse((GetParsers())["highlight_table_column"], args, kwargs, __FUNCTION__, &tableraw, &column, &color))
+	if (!Parse(GetCommandParser(mvCommand::highlight_table_column), args, kwargs, __FUNCTION__, &tableraw, &column, &color))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1375,6 +1420,7 @@ highlight_table_column(PyObject* self, PyObject* args, PyObject* kwargs)
 	tablecast->_columnColorsSet[column] = true;
 	tablecast->_columnColors[column] = finalColor;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1384,10 +1430,11 @@ unhighlight_table_column(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* tableraw;
 	int column = 0;
 
-	if (!Parse((GetParsers())["unhighlight_table_column"], args, kwargs, __FUNCTION__, &tableraw, &column))
+	if (!Parse(GetCommandParser(mvCommand::unhighlight_table_column), args, kwargs, __FUNCTION__, &tableraw, &column))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1417,6 +1464,7 @@ unhighlight_table_column(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	tablecast->_columnColorsSet[column] = false;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1427,10 +1475,11 @@ set_table_row_color(PyObject* self, PyObject* args, PyObject* kwargs)
 	int row = 0;
 	PyObject* color;
 
-	if (!Parse((GetParsers())["set_table_row_color"], args, kwargs, __FUNCTION__, &tableraw, &row, &color))
+	if (!Parse(GetCommandParser(mvCommand::set_table_row_color), args, kwargs, __FUNCTION__, &tableraw, &row, &color))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1462,6 +1511,7 @@ set_table_row_color(PyObject* self, PyObject* args, PyObject* kwargs)
 	tablecast->_rowColorsSet[row] = finalColor.a >= 0.0f;
 	tablecast->_rowColors[row] = finalColor;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1471,10 +1521,11 @@ unset_table_row_color(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* tableraw;
 	int row = 0;
 
-	if (!Parse((GetParsers())["unset_table_row_color"], args, kwargs, __FUNCTION__, &tableraw, &row))
+	if (!Parse(GetCommandParser(mvCommand::unset_table_row_color), args, kwargs, __FUNCTION__, &tableraw, &row))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1503,6 +1554,7 @@ unset_table_row_color(PyObject* self, PyObject* args, PyObject* kwargs)
 	}
 
 	tablecast->_rowColorsSet[row] = false;
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1513,10 +1565,11 @@ highlight_table_row(PyObject* self, PyObject* args, PyObject* kwargs)
 	int row = 0;
 	PyObject* color;
 
-	if (!Parse((GetParsers())["highlight_table_row"], args, kwargs, __FUNCTION__, &tableraw, &row, &color))
+	if (!Parse(GetCommandParser(mvCommand::highlight_table_row), args, kwargs, __FUNCTION__, &tableraw, &row, &color))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1548,6 +1601,7 @@ highlight_table_row(PyObject* self, PyObject* args, PyObject* kwargs)
 	tablecast->_rowSelectionColorsSet[row] = true;
 	tablecast->_rowSelectionColors[row] = finalColor;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1557,10 +1611,11 @@ unhighlight_table_row(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* tableraw;
 	int row = 0;
 
-	if (!Parse((GetParsers())["unhighlight_table_row"], args, kwargs, __FUNCTION__, &tableraw, &row))
+	if (!Parse(GetCommandParser(mvCommand::unhighlight_table_row), args, kwargs, __FUNCTION__, &tableraw, &row))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1590,6 +1645,7 @@ unhighlight_table_row(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	tablecast->_rowSelectionColorsSet[row] = false;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1601,10 +1657,11 @@ highlight_table_cell(PyObject* self, PyObject* args, PyObject* kwargs)
 	int column = 0;
 	PyObject* color;
 
-	if (!Parse((GetParsers())["highlight_table_cell"], args, kwargs, __FUNCTION__, &tableraw, &row, &column, &color))
+	if (!Parse(GetCommandParser(mvCommand::highlight_table_cell), args, kwargs, __FUNCTION__, &tableraw, &row, &column, &color))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1636,6 +1693,7 @@ highlight_table_cell(PyObject* self, PyObject* args, PyObject* kwargs)
 	tablecast->_cellColorsSet[row][column] = true;
 	tablecast->_cellColors[row][column] = finalColor;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1646,10 +1704,11 @@ unhighlight_table_cell(PyObject* self, PyObject* args, PyObject* kwargs)
 	int row = 0;
 	int column = 0;
 
-	if (!Parse((GetParsers())["unhighlight_table_cell"], args, kwargs, __FUNCTION__, &tableraw, &row, &column))
+	if (!Parse(GetCommandParser(mvCommand::unhighlight_table_cell), args, kwargs, __FUNCTION__, &tableraw, &row, &column))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1679,6 +1738,7 @@ unhighlight_table_cell(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	tablecast->_cellColorsSet[row][column] = false;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1689,10 +1749,11 @@ is_table_cell_highlighted(PyObject* self, PyObject* args, PyObject* kwargs)
 	int row = 0;
 	int column = 0;
 
-	if (!Parse((GetParsers())["is_table_cell_highlighted"], args, kwargs, __FUNCTION__, &tableraw, &row, &column))
+	if (!Parse(GetCommandParser(mvCommand::is_table_cell_highlighted), args, kwargs, __FUNCTION__, &tableraw, &row, &column))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1736,10 +1797,11 @@ is_table_row_highlighted(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* tableraw;
 	int row = 0;
 
-	if (!Parse((GetParsers())["is_table_row_highlighted"], args, kwargs, __FUNCTION__, &tableraw, &row))
+	if (!Parse(GetCommandParser(mvCommand::is_table_row_highlighted), args, kwargs, __FUNCTION__, &tableraw, &row))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1776,10 +1838,11 @@ is_table_column_highlighted(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* tableraw;
 	int column = 0;
 
-	if (!Parse((GetParsers())["is_table_column_highlighted"], args, kwargs, __FUNCTION__, &tableraw, &column))
+	if (!Parse(GetCommandParser(mvCommand::is_table_column_highlighted), args, kwargs, __FUNCTION__, &tableraw, &column))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1816,11 +1879,12 @@ bind_theme(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["bind_theme"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::bind_theme), args, kwargs, __FUNCTION__,
 		&itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -1852,6 +1916,7 @@ bind_theme(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	graph->config.show = true;
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1860,12 +1925,13 @@ set_global_font_scale(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	float scale;
 
-	if (!Parse((GetParsers())["set_global_font_scale"], args, kwargs, __FUNCTION__, &scale))
+	if (!Parse(GetCommandParser(mvCommand::set_global_font_scale), args, kwargs, __FUNCTION__, &scale))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
 	mvToolManager::GetFontManager().setGlobalFontScale(scale);
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1880,7 +1946,7 @@ show_tool(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* toolraw;
 
-	if (!Parse((GetParsers())["show_tool"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::show_tool), args, kwargs, __FUNCTION__,
 		&toolraw))
 		return nullptr;
 
@@ -1888,6 +1954,7 @@ show_tool(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	mvToolManager::ShowTool(tool);
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -1905,6 +1972,7 @@ set_decimal_point(PyObject* self, PyObject* args, PyObject* kwargs)
 	
 	GContext->IO.decimalPoint = *point;
 	ImGui::GetIO().PlatformLocaleDecimalPoint = GContext->IO.decimalPoint;
+	mvRequestRedraw();
 	return GetPyNone();
 }
 */
@@ -1916,7 +1984,7 @@ set_frame_callback(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* callback;
 	PyObject* user_data=nullptr;
 
-	if (!Parse((GetParsers())["set_frame_callback"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::set_frame_callback), args, kwargs, __FUNCTION__,
 		&frame, &callback, &user_data))
 		return nullptr;
 
@@ -1925,23 +1993,90 @@ set_frame_callback(PyObject* self, PyObject* args, PyObject* kwargs)
 	if (frame > GContext->callbackRegistry->highestFrame)
 		GContext->callbackRegistry->highestFrame = frame;
 
-	GContext->callbackRegistry->frameCallbacks.insert_or_assign(frame, mvPyObject(callback, true));
+	GContext->callbackRegistry->frameCallbacks.insert_or_assign(frame, mvPyCallback(callback, true));
 	GContext->callbackRegistry->frameCallbacksUserData.insert_or_assign(frame, mvPyObject(user_data, true));
 
 	return GetPyNone();
 }
 
+static PyObject*
+set_timer_callback(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	i32 interval = 0;
+	PyObject* callback;
+	b32 repeat = true;
+	PyObject* user_data = nullptr;
+
+	if (!Parse(GetCommandParser(mvCommand::set_timer_callback), args, kwargs, __FUNCTION__,
+		&interval, &callback, &repeat, &user_data))
+		return nullptr;
+
+	if (interval <= 0)
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "set_timer_callback", "Interval must be a positive number of milliseconds.", nullptr);
+		return nullptr;
+	}
+
+	mvPySafeLockGuard lk(GContext->mutex);
+
+	auto& registry = *GContext->callbackRegistry;
+	i32 id = ++registry.lastTimerId;
+
+	mvTimer timer;
+	timer.interval = std::chrono::milliseconds(interval);
+	timer.repeat = repeat;
+	timer.callback = std::make_shared<mvPyCallback>(callback, true);
+	timer.user_data = std::make_shared<mvPyObject>(user_data, true);
+	registry.timers.emplace(id, std::move(timer));
+
+	registry.timerHeap.push_back({ std::chrono::steady_clock::now() + std::chrono::milliseconds(interval), id });
+	std::push_heap(registry.timerHeap.begin(), registry.timerHeap.end());
+
+	// The render loop might be waiting for input with no timeout (or a later one).
+	if (GContext->viewport && GContext->viewport->shown)
+		mvWakeViewport(*GContext->viewport);
+
+	return ToPyInt(id);
+}
+
+static PyObject*
+delete_timer_callback(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	i32 timer = 0;
+
+	if (!Parse(GetCommandParser(mvCommand::delete_timer_callback), args, kwargs, __FUNCTION__, &timer))
+		return nullptr;
+
+	mvPySafeLockGuard lk(GContext->mutex);
+
+	auto& registry = *GContext->callbackRegistry;
+	registry.timers.erase(timer);
+
+	// Its entry in the heap is dropped once it comes up. Entries of timers
+	// with long intervals may take a while to, so once they outnumber the
+	// live ones, they're all dropped at once.
+	auto& heap = registry.timerHeap;
+	if (heap.size() > 2 * registry.timers.size() + 16)
+	{
+		heap.erase(std::remove_if(heap.begin(), heap.end(),
+			[&](const mvTimerDue& due) { return registry.timers.count(due.id) == 0; }), heap.end());
+		std::make_heap(heap.begin(), heap.end());
+	}
+
+	return GetPyNone();
+}
+
 static PyObject*
 set_exit_callback(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* callback;
 	PyObject* user_data = nullptr;
 
-	if (!Parse((GetParsers())["set_exit_callback"], args, kwargs, __FUNCTION__, &callback,
+	if (!Parse(GetCommandParser(mvCommand::set_exit_callback), args, kwargs, __FUNCTION__, &callback,
 		&user_data))
 		return nullptr;
 
-	*GContext->callbackRegistry->onCloseCallback = mvPyObject(callback == Py_None? nullptr : callback, true);
+	*GContext->callbackRegistry->onCloseCallback = mvPyCallback(callback == Py_None? nullptr : callback, true);
 	*GContext->callbackRegistry->onCloseCallbackUserData = mvPyObject(user_data, true);
 
 	return GetPyNone();
@@ -1953,11 +2088,11 @@ set_viewport_resize_callback(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* callback = nullptr;
 	PyObject* user_data = nullptr;
 
-	if (!Parse((GetParsers())["set_viewport_resize_callback"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::set_viewport_resize_callback), args, kwargs, __FUNCTION__,
 		&callback, &user_data))
 		return nullptr;
 
-	*GContext->callbackRegistry->resizeCallback = mvPyObject(callback == Py_None? nullptr : callback, true);
+	*GContext->callbackRegistry->resizeCallback = mvPyCallback(callback == Py_None? nullptr : callback, true);
 	*GContext->callbackRegistry->resizeCallbackUserData = mvPyObject(user_data, true);
 
 	return GetPyNone();
@@ -1990,6 +2125,9 @@ get_viewport_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyDict_SetItemString(pdict, "client_height", mvPyObject(ToPyInt(viewport->clientHeight)));
 	PyDict_SetItemString(pdict, "resizable", mvPyObject(ToPyBool(viewport->resizable)));
 	PyDict_SetItemString(pdict, "vsync", mvPyObject(ToPyBool(viewport->vsync)));
+	PyDict_SetItemString(pdict, "max_fps", mvPyObject(ToPyInt(viewport->maxFps)));
+	PyDict_SetItemString(pdict, "fixed_delta_time", mvPyObject(ToPyFloat(viewport->fixedDeltaTime)));
+	PyDict_SetItemString(pdict, "headless", mvPyObject(ToPyBool(viewport->headless)));
 	PyDict_SetItemString(pdict, "min_width", mvPyObject(ToPyInt(viewport->minwidth)));
 	PyDict_SetItemString(pdict, "max_width", mvPyObject(ToPyInt(viewport->maxwidth)));
 	PyDict_SetItemString(pdict, "min_height", mvPyObject(ToPyInt(viewport->minheight)));
@@ -2037,6 +2175,9 @@ create_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 	b32 always_on_top = false;
 	b32 decorated = true;
 	b32 disable_close = false;
+	i32 max_fps = 0;
+	f32 fixed_delta_time = 0.0f;
+	b32 headless = false;
 
 	PyObject* color = PyList_New(4);
 	PyList_SetItem(color, 0, PyFloat_FromDouble(0.0));
@@ -2045,9 +2186,10 @@ create_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyList_SetItem(color, 3, PyFloat_FromDouble(1.0));
 
 
-	if (!Parse((GetParsers())["create_viewport"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::create_viewport), args, kwargs, __FUNCTION__,
 		&title, &small_icon, &large_icon, &width, &height, &x_pos, &y_pos, &min_width, &max_width, &min_height, &max_height,
-		&resizable, &vsync, &always_on_top, &decorated, &color, &disable_close
+		&resizable, &vsync, &always_on_top, &decorated, &color, &disable_close, &max_fps,
+		&fixed_delta_time, &headless
 	))
 		return nullptr;
 
@@ -2061,6 +2203,9 @@ create_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 	if (PyObject* item = PyDict_GetItemString(kwargs, "height")) { viewport->sizeDirty = true;  viewport->actualHeight = ToInt(item); }
 	if (PyObject* item = PyDict_GetItemString(kwargs, "resizable")) { viewport->modesDirty = true;  viewport->resizable = ToBool(item); }
 	if (PyObject* item = PyDict_GetItemString(kwargs, "vsync")) viewport->vsync = ToBool(item);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "max_fps")) viewport->maxFps = (u32)std::max(ToInt(item), 0);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "fixed_delta_time")) viewport->fixedDeltaTime = std::max(ToFloat(item), 0.0f);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "headless")) viewport->headless = ToBool(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "min_width")) viewport->minwidth = ToInt(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "max_width")) viewport->maxwidth = ToInt(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "min_height")) viewport->minheight = ToInt(item);
@@ -2081,14 +2226,23 @@ show_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 	b32 minimized = false;
 	b32 maximized = false;
 
-	if (!Parse((GetParsers())["show_viewport"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::show_viewport), args, kwargs, __FUNCTION__,
 		&minimized, &maximized))
 		return nullptr;
 
 	mvViewport* viewport = GContext->viewport;
 	if (viewport)
 	{
+#if defined(_WIN32) || defined(__APPLE__)
+		if (viewport->headless)
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "show_viewport", "Headless viewports are only supported on Linux.", nullptr);
+			return nullptr;
+		}
+#endif
 		mvShowViewport(*viewport, minimized, maximized);
+		if (PyErr_Occurred())
+			return nullptr;
 		GContext->graphics = setup_graphics(*viewport);
 		viewport->shown = true;
 	}
@@ -2118,6 +2272,8 @@ configure_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 		if (PyObject* item = PyDict_GetItemString(kwargs, "height")) { viewport->sizeDirty = true;  viewport->actualHeight = ToInt(item); }
 		if (PyObject* item = PyDict_GetItemString(kwargs, "resizable")) { viewport->modesDirty = true;  viewport->resizable = ToBool(item); }
 		if (PyObject* item = PyDict_GetItemString(kwargs, "vsync")) viewport->vsync = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "max_fps")) viewport->maxFps = (u32)std::max(ToInt(item), 0);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "fixed_delta_time")) viewport->fixedDeltaTime = std::max(ToFloat(item), 0.0f);
 		if (PyObject* item = PyDict_GetItemString(kwargs, "min_width")) viewport->minwidth = ToInt(item);
 		if (PyObject* item = PyDict_GetItemString(kwargs, "max_width")) viewport->maxwidth = ToInt(item);
 		if (PyObject* item = PyDict_GetItemString(kwargs, "min_height")) viewport->minheight = ToInt(item);
@@ -2179,7 +2335,7 @@ save_init_file(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	const char* file;
 
-	if (!Parse((GetParsers())["save_init_file"], args, kwargs, __FUNCTION__, &file))
+	if (!Parse(GetCommandParser(mvCommand::save_init_file), args, kwargs, __FUNCTION__, &file))
 		return nullptr;
 
 	if (GContext->started)
@@ -2196,7 +2352,7 @@ save_init_file(PyObject* self, PyObject* args, PyObject* kwargs)
 static PyObject*
 split_frame(PyObject* self, PyObject* args, PyObject* kwargs)
 {
-	if (!Parse((GetParsers())["split_frame"], args, kwargs, __FUNCTION__))
+	if (!Parse(GetCommandParser(mvCommand::split_frame), args, kwargs, __FUNCTION__))
 		return nullptr;
 
 	if (GContext->running)
@@ -2254,7 +2410,7 @@ load_image(PyObject* self, PyObject* args, PyObject* kwargs)
 	f32 gamma = 1.0f;
 	f32 gamma_scale = 1.0f;
 
-	if (!Parse((GetParsers())["load_image"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::load_image), args, kwargs, __FUNCTION__,
 		&file, &gamma, &gamma_scale))
 		return nullptr;
 
@@ -2325,7 +2481,7 @@ save_image(PyObject* self, PyObject* args, PyObject* kwargs)
 	i32 components = 4;
 	i32 quality = 50;
 
-	if (!Parse((GetParsers())["save_image"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::save_image), args, kwargs, __FUNCTION__,
 		&file, &width, &height, &data, &components, &quality))
 		return nullptr;
 
@@ -2437,7 +2593,7 @@ output_frame_buffer(PyObject* self, PyObject* args, PyObject* kwargs)
 	const char* file = "";
 	PyObject* callback = nullptr;
 
-	if (!Parse((GetParsers())["output_frame_buffer"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::output_frame_buffer), args, kwargs, __FUNCTION__,
 		&file, &callback))
 		return nullptr;
 
@@ -2451,7 +2607,7 @@ output_frame_buffer(PyObject* self, PyObject* args, PyObject* kwargs)
 		newbuffer = PyObject_Init((PyObject*)newbufferview, &PymvBufferType);
 
 		// Making an owned ref while we're still holding GIL (can't do this within mvSubmitTask).
-		auto stored_callback = std::make_shared<mvPyObject>(callback, true);
+		auto stored_callback = std::make_shared<mvPyCallback>(callback, true);
 		// We need to schedule this into the rendering thread because OutputFrameBufferArray
 		// accesses the rendering API, which might well have thread-local things in the context.
 		mvSubmitTask([stored_callback, newbuffer, newbufferview]() {
@@ -2534,11 +2690,42 @@ render_dearpygui_frame(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	MV_PROFILE_SCOPE("Frame")
 
+	// set_value/configure_item calls recorded during the last frame,
+	// and children deleted since
+	if (GContext->itemRegistry->pendingItemCommands > 0 || !GContext->itemRegistry->pendingRemovals.empty())
+	{
+		mvPySafeLockGuard lk(GContext->mutex);
+		FlushItemCommands(*GContext->itemRegistry);
+	}
+
+	i64 framesRendered = GContext->framesRendered;
+
 	Py_BEGIN_ALLOW_THREADS;
 	auto window = GContext->viewport;
 	mvRenderFrame();
+	if (GContext->framesRendered != framesRendered)
+		mvPaceFrame(window->maxFps);
 	Py_END_ALLOW_THREADS;
 
+	// minimized, or nothing changed with wait_for_input
+	if (GContext->framesRendered == framesRendered)
+		GContext->framesSkipped++;
+
+	if (GContext->IO.commandBuffer)
+	{
+		mvPySafeLockGuard lk(GContext->mutex);
+		PublishValueSnapshot(*GContext->itemRegistry);
+	}
+
+	// Destroying items may release Python objects, so this needs the GIL
+	if (GContext->itemRegistry->pendingDeletions > 0)
+	{
+		mvPySafeLockGuard lk(GContext->mutex);
+		ReclaimRetiredItems(*GContext->itemRegistry, GContext->IO.deletionBudget);
+		if (GContext->itemRegistry->pendingDeletions > 0 && GContext->viewport->shown)
+			mvWakeViewport(*GContext->viewport);
+	}
+
 	if (GContext->viewport->resized)
 	{
 		mvOnResize();
@@ -2643,6 +2830,8 @@ destroy_context(PyObject* self, PyObject* args, PyObject* kwargs)
 			GContext = nullptr;
 		}
 		delete context_to_delete;
+		// nothing is going to reuse these blocks before the next create_context
+		mvTrimItemPools();
 	}
 
 	return GetPyNone();
@@ -2682,6 +2871,22 @@ get_frame_rate(PyObject* self, PyObject* args, PyObject* kwargs)
 
 }
 
+static PyObject*
+get_render_stats(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* pdict = PyDict_New();
+	PyDict_SetItemString(pdict, "frames_rendered", mvPyObject(PyLong_FromLongLong(GContext->framesRendered)));
+	PyDict_SetItemString(pdict, "frames_skipped", mvPyObject(PyLong_FromLongLong(GContext->framesSkipped)));
+	PyDict_SetItemString(pdict, "frame_time", mvPyObject(ToPyDouble(GContext->pacer.frameTime)));
+	PyDict_SetItemString(pdict, "frame_time_jitter", mvPyObject(ToPyDouble(GContext->pacer.jitter)));
+	PyDict_SetItemString(pdict, "draw_lists", mvPyObject(PyLong_FromLongLong(GContext->drawStats.drawLists)));
+	PyDict_SetItemString(pdict, "vertices", mvPyObject(PyLong_FromLongLong(GContext->drawStats.vertices)));
+	PyDict_SetItemString(pdict, "indices", mvPyObject(PyLong_FromLongLong(GContext->drawStats.indices)));
+	PyDict_SetItemString(pdict, "draw_commands", mvPyObject(PyLong_FromLongLong(GContext->drawStats.drawCommands)));
+	PyDict_SetItemString(pdict, "texture_binds", mvPyObject(PyLong_FromLongLong(GContext->drawStats.textureBinds)));
+	return pdict;
+}
+
 static PyObject*
 generate_uuid(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -2694,7 +2899,7 @@ configure_app(PyObject* self, PyObject* args, PyObject* kwargs)
 	if (kwargs == nullptr)
 		return GetPyNone();
 
-	if (VerifyKeywordArguments(GetParsers()["configure_app"], kwargs))
+	if (VerifyKeywordArguments(GetCommandParser(mvCommand::configure_app), kwargs))
 		return GetPyNone();
 
 	if (PyArg_ValidateKeywordArguments(kwargs) == 0)
@@ -2722,10 +2927,63 @@ configure_app(PyObject* self, PyObject* args, PyObject* kwargs)
 	if (PyObject* item = PyDict_GetItemString(kwargs, "skip_keyword_args")) GContext->IO.skipKeywordArgs = ToBool(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "skip_positional_args")) GContext->IO.skipPositionalArgs = ToBool(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "skip_required_args")) GContext->IO.skipRequiredArgs = ToBool(item);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "skip_keyword_validation")) GContext->IO.skipKeywordValidation = ToBool(item);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "deferred_deletion_threshold")) GContext->IO.deferredDeletionThreshold = std::max(ToInt(item), 0);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "deletion_budget")) GContext->IO.deletionBudget = std::max(ToInt(item), 1);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "command_buffer")) GContext->IO.commandBuffer = ToBool(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "auto_save_init_file")) GContext->IO.autoSaveIniFile = ToBool(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "wait_for_input")) GContext->IO.waitForInput = ToBool(item);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "max_idle_interval")) GContext->IO.maxIdleInterval = std::max(ToFloat(item), 0.0f);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "null_renderer"))
+	{
+		bool nullRenderer = ToBool(item);
+		// textures only have dummy ids so far; the backend has to create them for real
+		if (GContext->IO.nullRenderer && !nullRenderer && GContext->started)
+		{
+			for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+			{
+				if (tex->Status == ImTextureStatus_OK)
+					tex->SetStatus(ImTextureStatus_WantCreate);
+			}
+		}
+		GContext->IO.nullRenderer = nullRenderer;
+	}
 	if (PyObject* item = PyDict_GetItemString(kwargs, "manual_callback_management")) GContext->IO.manualCallbacks = ToBool(item);
 
+	if (PyObject* item = PyDict_GetItemString(kwargs, "callback_queue_capacity"))
+		GContext->callbackRegistry->maxNumberOfCalls = std::clamp(ToInt(item), 1, (i32)mvCallbackRegistry::maxCallQueueCapacity);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "callback_queue_policy"))
+	{
+		i32 policy = ToInt(item);
+		if (policy != (i32)mvCallbackQueuePolicy::DropNewest && policy != (i32)mvCallbackQueuePolicy::DropOldest)
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "configure_app", "Unknown callback_queue_policy. Use mvCallbackQueue_DropNewest or mvCallbackQueue_DropOldest.", nullptr);
+			return nullptr;
+		}
+		GContext->callbackRegistry->queuePolicy = (mvCallbackQueuePolicy)policy;
+	}
+	if (PyObject* item = PyDict_GetItemString(kwargs, "coalesce_callbacks")) GContext->callbackRegistry->coalesceCallbacks = ToBool(item);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "callback_workers"))
+	{
+		if (GContext->started)
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "configure_app", "callback_workers must be set before setup_dearpygui.", nullptr);
+			return nullptr;
+		}
+		GContext->callbackRegistry->callbackWorkers = std::clamp(ToInt(item), 0, mvCallbackRegistry::maxCallbackWorkers);
+	}
+	if (PyObject* item = PyDict_GetItemString(kwargs, "callback_loop"))
+	{
+		auto& registry = *GContext->callbackRegistry;
+		registry.asyncLoop = mvPyObject(item == Py_None? nullptr : item, true);
+		if (registry.asyncLoop.isOk() && !registry.asyncTasks.isOk())
+			registry.asyncTasks = mvPyObject(PySet_New(nullptr));
+		registry.asyncCallbacks = registry.asyncLoop.isOk();
+		// pick up whatever has been collected in manual mode
+		if (registry.asyncCallbacks && !registry.jobs.empty())
+			mvPostAsyncCallbacks();
+	}
+
 	if (PyObject* item = PyDict_GetItemString(kwargs, "init_file")) GContext->IO.iniFile = ToString(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "device_name")) GContext->IO.info_device_name = ToString(item);
 	if (PyObject* item = PyDict_GetItemString(kwargs, "device")) GContext->IO.info_device = ToInt(item);
@@ -2764,9 +3022,20 @@ get_app_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyDict_SetItemString(pdict, "skip_keyword_args", mvPyObject(ToPyBool(GContext->IO.skipKeywordArgs)));
 	PyDict_SetItemString(pdict, "skip_positional_args", mvPyObject(ToPyBool(GContext->IO.skipPositionalArgs)));
 	PyDict_SetItemString(pdict, "skip_required_args", mvPyObject(ToPyBool(GContext->IO.skipRequiredArgs)));
+	PyDict_SetItemString(pdict, "skip_keyword_validation", mvPyObject(ToPyBool(GContext->IO.skipKeywordValidation)));
+	PyDict_SetItemString(pdict, "deferred_deletion_threshold", mvPyObject(ToPyInt(GContext->IO.deferredDeletionThreshold)));
+	PyDict_SetItemString(pdict, "deletion_budget", mvPyObject(ToPyInt(GContext->IO.deletionBudget)));
+	PyDict_SetItemString(pdict, "command_buffer", mvPyObject(ToPyBool(GContext->IO.commandBuffer)));
 	PyDict_SetItemString(pdict, "auto_save_init_file", mvPyObject(ToPyBool(GContext->IO.autoSaveIniFile)));
 	PyDict_SetItemString(pdict, "wait_for_input", mvPyObject(ToPyBool(GContext->IO.waitForInput)));
+	PyDict_SetItemString(pdict, "max_idle_interval", mvPyObject(ToPyFloat(GContext->IO.maxIdleInterval)));
+	PyDict_SetItemString(pdict, "null_renderer", mvPyObject(ToPyBool(GContext->IO.nullRenderer)));
 	PyDict_SetItemString(pdict, "manual_callback_management", mvPyObject(ToPyBool(GContext->IO.manualCallbacks)));
+	PyDict_SetItemString(pdict, "callback_queue_capacity", mvPyObject(ToPyInt(GContext->callbackRegistry->maxNumberOfCalls)));
+	PyDict_SetItemString(pdict, "callback_queue_policy", mvPyObject(ToPyInt((i32)GContext->callbackRegistry->queuePolicy.load())));
+	PyDict_SetItemString(pdict, "coalesce_callbacks", mvPyObject(ToPyBool(GContext->callbackRegistry->coalesceCallbacks)));
+	PyDict_SetItemString(pdict, "callback_workers", mvPyObject(ToPyInt(GContext->callbackRegistry->callbackWorkers)));
+	PyDict_SetItemString(pdict, "callback_loop", GContext->callbackRegistry->asyncLoop.isOk()? (PyObject*)GContext->callbackRegistry->asyncLoop : Py_None);
 	PyDict_SetItemString(pdict, "keyboard_navigation", mvPyObject(ToPyBool(GContext->IO.kbdNavigation)));
 
 	ImGuiStyle& style = ImGui::GetStyle();
@@ -2784,7 +3053,7 @@ get_mouse_pos(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	b32 local = true;
 
-	if (!Parse((GetParsers())["get_mouse_pos"], args, kwargs, __FUNCTION__, &local))
+	if (!Parse(GetCommandParser(mvCommand::get_mouse_pos), args, kwargs, __FUNCTION__, &local))
 		return nullptr;
 
 	auto pos = mvVec2();
@@ -2801,7 +3070,7 @@ static PyObject*
 get_plot_mouse_pos(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 
-	if (!Parse((GetParsers())["get_plot_mouse_pos"], args, kwargs, __FUNCTION__))
+	if (!Parse(GetCommandParser(mvCommand::get_plot_mouse_pos), args, kwargs, __FUNCTION__))
 		return nullptr;
 
 	mvVec2 pos = { (f32)GContext->input.mousePlotPos.x, (f32)GContext->input.mousePlotPos.y };
@@ -2813,7 +3082,7 @@ static PyObject*
 get_drawing_mouse_pos(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 
-	if (!Parse((GetParsers())["get_drawing_mouse_pos"], args, kwargs, __FUNCTION__))
+	if (!Parse(GetCommandParser(mvCommand::get_drawing_mouse_pos), args, kwargs, __FUNCTION__))
 		return nullptr;
 
 	mvVec2 pos = { (f32)GContext->input.mouseDrawingPos.x, (f32)GContext->input.mouseDrawingPos.y };
@@ -2834,7 +3103,7 @@ is_key_pressed(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	ImGuiKey key;
 
-	if (!Parse((GetParsers())["is_key_pressed"], args, kwargs, __FUNCTION__, &key))
+	if (!Parse(GetCommandParser(mvCommand::is_key_pressed), args, kwargs, __FUNCTION__, &key))
 		return nullptr;
 
 	return ToPyBool(ImGui::IsKeyPressed(key));
@@ -2845,7 +3114,7 @@ is_key_released(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	ImGuiKey key;
 
-	if (!Parse((GetParsers())["is_key_released"], args, kwargs, __FUNCTION__, &key))
+	if (!Parse(GetCommandParser(mvCommand::is_key_released), args, kwargs, __FUNCTION__, &key))
 		return nullptr;
 
 	return ToPyBool(ImGui::IsKeyReleased(key));
@@ -2856,7 +3125,7 @@ is_key_down(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	ImGuiKey key;
 
-	if (!Parse((GetParsers())["is_key_down"], args, kwargs, __FUNCTION__, &key))
+	if (!Parse(GetCommandParser(mvCommand::is_key_down), args, kwargs, __FUNCTION__, &key))
 		return nullptr;
 
 	return ToPyBool(ImGui::IsKeyDown(key));
@@ -2868,7 +3137,7 @@ is_mouse_button_dragging(PyObject* self, PyObject* args, PyObject* kwargs)
 	i32 button;
 	f32 threshold;
 
-	if (!Parse((GetParsers())["is_mouse_button_dragging"], args, kwargs, __FUNCTION__, &button, &threshold))
+	if (!Parse(GetCommandParser(mvCommand::is_mouse_button_dragging), args, kwargs, __FUNCTION__, &button, &threshold))
 		return nullptr;
 
 	// TODO: Can this be changed?
@@ -2880,7 +3149,7 @@ is_mouse_button_down(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	i32 button;
 
-	if (!Parse((GetParsers())["is_mouse_button_down"], args, kwargs, __FUNCTION__, &button))
+	if (!Parse(GetCommandParser(mvCommand::is_mouse_button_down), args, kwargs, __FUNCTION__, &button))
 		return nullptr;
 
 	return ToPyBool(ImGui::IsMouseDown(button));
@@ -2891,7 +3160,7 @@ is_mouse_button_clicked(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	i32 button;
 
-	if (!Parse((GetParsers())["is_mouse_button_clicked"], args, kwargs, __FUNCTION__, &button))
+	if (!Parse(GetCommandParser(mvCommand::is_mouse_button_clicked), args, kwargs, __FUNCTION__, &button))
 		return nullptr;
 
 	return ToPyBool(ImGui::IsMouseClicked(button));
@@ -2902,7 +3171,7 @@ is_mouse_button_double_clicked(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	i32 button;
 
-	if (!Parse((GetParsers())["is_mouse_button_double_clicked"], args, kwargs, __FUNCTION__, &button))
+	if (!Parse(GetCommandParser(mvCommand::is_mouse_button_double_clicked), args, kwargs, __FUNCTION__, &button))
 		return nullptr;
 
 	return ToPyBool(ImGui::IsMouseDoubleClicked(button));
@@ -2913,7 +3182,7 @@ is_mouse_button_released(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	i32 button;
 
-	if (!Parse((GetParsers())["is_mouse_button_released"], args, kwargs, __FUNCTION__, &button))
+	if (!Parse(GetCommandParser(mvCommand::is_mouse_button_released), args, kwargs, __FUNCTION__, &button))
 		return nullptr;
 
 	return ToPyBool(ImGui::IsMouseReleased(button));
@@ -2992,10 +3261,11 @@ push_container_stack(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["push_container_stack"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::push_container_stack), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3017,13 +3287,14 @@ set_primary_window(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	i32 value = 1;
 
-	if (!VerifyRequiredArguments(GetParsers()["set_primary_window"], args))
+	if (!VerifyRequiredArguments(GetCommandParser(mvCommand::set_primary_window), args))
 		return GetPyNoneOrError();
 
-	if (!Parse((GetParsers())["set_primary_window"], args, kwargs, __FUNCTION__, &itemraw, &value))
+	if (!Parse(GetCommandParser(mvCommand::set_primary_window), args, kwargs, __FUNCTION__, &itemraw, &value))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3083,6 +3354,7 @@ set_primary_window(PyObject* self, PyObject* args, PyObject* kwargs)
 		old_primary->info.dirty_size = true;
 	}
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -3110,12 +3382,14 @@ move_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* parentraw = nullptr;
 	PyObject* beforeraw = nullptr;
 
-	if (!Parse((GetParsers())["move_item"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::move_item), args, kwargs, __FUNCTION__,
 		&itemraw, &parentraw, &beforeraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
 
+	FlushItemCommands(*GContext->itemRegistry);
+
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvUUID parent = GetIDFromPyObject(parentraw);
 	mvUUID before = GetIDFromPyObject(beforeraw);
@@ -3141,11 +3415,17 @@ delete_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	b32 childrenOnly = false;
 	i32 slot = -1;
 
-	if (!Parse((GetParsers())["delete_item"], args, kwargs, __FUNCTION__, &itemraw, &childrenOnly, &slot))
+	if (!Parse(GetCommandParser(mvCommand::delete_item), args, kwargs, __FUNCTION__, &itemraw, &childrenOnly, &slot))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
 
+	// buffered set_value/configure_item calls may still refer to the item.
+	// Only then, as flushing also ends the batch of sibling deletions that
+	// DeleteItem keeps.
+	if (GContext->itemRegistry->pendingItemCommands > 0)
+		FlushItemCommands(*GContext->itemRegistry);
+
 	mvUUID item = GetIDFromPyObject(itemraw);
 
     if(item != 0)
@@ -3155,16 +3435,45 @@ delete_item(PyObject* self, PyObject* args, PyObject* kwargs)
 
 }
 
+static PyObject*
+delete_items(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+
+	PyObject* itemsraw;
+
+	if (!Parse(GetCommandParser(mvCommand::delete_items), args, kwargs, __FUNCTION__, &itemsraw))
+		return nullptr;
+
+	mvPySafeLockGuard lk(GContext->mutex);
+
+	FlushItemCommands(*GContext->itemRegistry);
+
+	auto items = ToUUIDVect(itemsraw);
+
+	if (!DeleteItems(*GContext->itemRegistry, items))
+		return nullptr;
+
+	return GetPyNone();
+
+}
+
+static PyObject*
+get_pending_deletions(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	return PyLong_FromLongLong(GContext->itemRegistry->pendingDeletions);
+}
+
 static PyObject*
 does_item_exist(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["does_item_exist"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::does_item_exist), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3179,11 +3488,13 @@ move_item_up(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["move_item_up"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::move_item_up), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
 
+	FlushItemCommands(*GContext->itemRegistry);
+
 	mvUUID item = GetIDFromPyObject(itemraw);
 
 	if (!MoveItemUp((*GContext->itemRegistry), item))
@@ -3199,11 +3510,13 @@ move_item_down(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["move_item_down"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::move_item_down), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
 
+	FlushItemCommands(*GContext->itemRegistry);
+
 	mvUUID item = GetIDFromPyObject(itemraw);
 
 	if (!MoveItemDown((*GContext->itemRegistry), item))
@@ -3220,11 +3533,12 @@ reorder_items(PyObject* self, PyObject* args, PyObject* kwargs)
 	i32 slot = 0;
 	PyObject* new_order = nullptr;
 
-	if (!Parse((GetParsers())["reorder_items"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::reorder_items), args, kwargs, __FUNCTION__,
 		&containerraw, &slot, &new_order))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	auto anew_order = ToUUIDVect(new_order);
 	mvUUID container = GetIDFromPyObject(containerraw);
@@ -3241,10 +3555,11 @@ unstage(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw = nullptr;
 
-	if (!Parse((GetParsers())["unstage"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::unstage), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3280,10 +3595,11 @@ show_item_debug(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	PyObject* itemraw = nullptr;
 
-	if (!Parse((GetParsers())["show_item_debug"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::show_item_debug), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3300,6 +3616,7 @@ show_item_debug(PyObject* self, PyObject* args, PyObject* kwargs)
 		return nullptr;
 	}
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -3348,6 +3665,7 @@ get_all_items(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	std::vector<mvUUID> childList;
 
@@ -3393,6 +3711,7 @@ get_windows(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	std::vector<mvUUID> childList;
 	for (auto& root : GContext->itemRegistry->colormapRoots) childList.emplace_back(root->uuid);
@@ -3419,10 +3738,11 @@ add_alias(PyObject* self, PyObject* args, PyObject* kwargs)
 	const char* alias;
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["add_alias"], args, kwargs, __FUNCTION__, &alias, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::add_alias), args, kwargs, __FUNCTION__, &alias, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3438,10 +3758,11 @@ remove_alias(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	const char* alias;
 
-	if (!Parse((GetParsers())["remove_alias"], args, kwargs, __FUNCTION__, &alias))
+	if (!Parse(GetCommandParser(mvCommand::remove_alias), args, kwargs, __FUNCTION__, &alias))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	RemoveAlias((*GContext->itemRegistry), alias);
 
@@ -3455,10 +3776,11 @@ does_alias_exist(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	const char* alias;
 
-	if (!Parse((GetParsers())["does_alias_exist"], args, kwargs, __FUNCTION__, &alias))
+	if (!Parse(GetCommandParser(mvCommand::does_alias_exist), args, kwargs, __FUNCTION__, &alias))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	bool result = GContext->itemRegistry->aliases.count(alias) != 0;
 
@@ -3471,10 +3793,11 @@ get_alias_id(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	const char* alias;
 
-	if (!Parse((GetParsers())["get_alias_id"], args, kwargs, __FUNCTION__, &alias))
+	if (!Parse(GetCommandParser(mvCommand::get_alias_id), args, kwargs, __FUNCTION__, &alias))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID result = GetIdFromAlias((*GContext->itemRegistry), alias);
 
@@ -3486,6 +3809,7 @@ get_aliases(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	std::vector<std::string> aliases;
 
@@ -3500,10 +3824,11 @@ focus_item(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["focus_item"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::focus_item), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3536,6 +3861,7 @@ focus_item(PyObject* self, PyObject* args, PyObject* kwargs)
 		return nullptr;
 	}
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -3576,10 +3902,11 @@ get_item_info(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["get_item_info"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::get_item_info), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3646,10 +3973,11 @@ get_item_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["get_item_configuration"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::get_item_configuration), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3665,7 +3993,7 @@ get_item_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	// config py objects
 	mvPyObject py_filter_key = ToPyString(appitem->config.filter);
-	mvPyObject py_payload_type = ToPyString(appitem->config.payloadType);
+	mvPyObject py_payload_type = ToPyString(appitem->config.cold().payloadType);
 	mvPyObject py_label = ToPyString(appitem->config.specifiedLabel);
 	mvPyObject py_use_internal_label = ToPyBool(appitem->config.useInternalLabel);
 	mvPyObject py_source = PyUUIDFromItem(appitem->config.source);
@@ -3693,10 +4021,10 @@ get_item_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* callback = appitem->config.callback;
 	PyDict_SetItemString(pdict, "callback", callback? callback : Py_None);
 
-	PyObject* dropCallback = appitem->config.dropCallback;
+	PyObject* dropCallback = appitem->config.cold().dropCallback;
 	PyDict_SetItemString(pdict, "drop_callback", dropCallback? dropCallback : Py_None);
 
-	PyObject* dragCallback = appitem->config.dragCallback;
+	PyObject* dragCallback = appitem->config.cold().dragCallback;
 	PyDict_SetItemString(pdict, "drag_callback", dragCallback? dragCallback : Py_None);
 
 	PyObject* user_data = *(appitem->config.user_data);
@@ -3714,11 +4042,12 @@ set_item_children(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* sourceraw;
 	i32 slot;
 
-	if (!Parse((GetParsers())["set_item_children"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::set_item_children), args, kwargs, __FUNCTION__,
 		&itemraw, &sourceraw, &slot))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvUUID source = GetIDFromPyObject(sourceraw);
@@ -3779,6 +4108,7 @@ set_item_children(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	DeleteItem(*GContext->itemRegistry, source);
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -3788,11 +4118,12 @@ bind_item_font(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	PyObject* fontraw;
 
-	if (!Parse((GetParsers())["bind_item_font"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::bind_item_font), args, kwargs, __FUNCTION__,
 		&itemraw, &fontraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvUUID font = GetIDFromPyObject(fontraw);
@@ -3801,6 +4132,8 @@ bind_item_font(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	if (appitem)
 	{
+		mvRequestRedraw();
+
 		if (font == 0)
 		{
 			appitem->font = nullptr;
@@ -3831,11 +4164,12 @@ bind_item_theme(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	PyObject* themeraw;
 
-	if (!Parse((GetParsers())["bind_item_theme"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::bind_item_theme), args, kwargs, __FUNCTION__,
 		&itemraw, &themeraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvUUID theme = GetIDFromPyObject(themeraw);
@@ -3843,6 +4177,8 @@ bind_item_theme(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	if (appitem)
 	{
+		mvRequestRedraw();
+
 		if (theme == 0)
 		{
 			appitem->theme = nullptr;
@@ -3879,11 +4215,12 @@ bind_item_handler_registry(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	PyObject* regraw;
 
-	if (!Parse((GetParsers())["bind_item_handler_registry"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::bind_item_handler_registry), args, kwargs, __FUNCTION__,
 		&itemraw, &regraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvUUID reg = GetIDFromPyObject(regraw);
@@ -3891,6 +4228,8 @@ bind_item_handler_registry(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	if (appitem)
 	{
+		mvRequestRedraw();
+
 		if (reg == 0)
 		{
 			appitem->handlerRegistry = nullptr;
@@ -3927,11 +4266,12 @@ reset_pos(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["reset_pos"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::reset_pos), args, kwargs, __FUNCTION__,
 		&itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3945,6 +4285,7 @@ reset_pos(PyObject* self, PyObject* args, PyObject* kwargs)
 		return nullptr;
 	}
 
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -3953,10 +4294,11 @@ get_item_state(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["get_item_state"], args, kwargs, __FUNCTION__, &itemraw))
+	if (!Parse(GetCommandParser(mvCommand::get_item_state), args, kwargs, __FUNCTION__, &itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3989,10 +4331,212 @@ get_item_types(PyObject* self, PyObject* args, PyObject* kwargs)
 }
 
 static PyObject*
-configure_item(PyObject* self, PyObject* args, PyObject* kwargs)
+add_items(PyObject* self, PyObject* args, PyObject* kwargs)
 {
+	PyObject* items;
+
+	if (!Parse(GetCommandParser(mvCommand::add_items), args, kwargs, __FUNCTION__, &items))
+		return nullptr;
+
+	mvPyObject entries(PySequence_Fast(items, "items must be a sequence"));
+	if (!entries.isOk())
+		return nullptr;
+
+	static std::unordered_map<std::string, mvAppItemType> commandTypes;
+	if (commandTypes.empty())
+	{
+		#define X(el) commandTypes[GetEntityCommand(mvAppItemType::el)] = mvAppItemType::el;
+		MV_ITEM_TYPES
+		#undef X
+	}
+
+	struct Entry
+	{
+		mvAppItemType type;
+		PyObject*     parent; // borrowed, nullptr if not given
+		mvPyObject    args;   // required arguments, taken from the kwargs by name
+		mvPyObject    kwargs; // nullptr if not given
+	};
+
+	// Validate everything up front, required arguments included, so that a
+	// malformed entry is reported before anything is created. Errors that
+	// only show up while creating (e.g. an incompatible parent) undo the
+	// batch below.
+	Py_ssize_t count = PySequence_Fast_GET_SIZE(entries);
+	std::vector<Entry> batch;
+	batch.reserve(count);
+	for (Py_ssize_t i = 0; i < count; i++)
+	{
+		PyObject* entry = PySequence_Fast_GET_ITEM(entries, i);
+		if (!PyTuple_Check(entry) || PyTuple_GET_SIZE(entry) < 1 || PyTuple_GET_SIZE(entry) > 3)
+		{
+			mvThrowPythonError(mvErrorCode::mvWrongType, "add_items",
+				"Entry " + std::to_string(i) + " must be a (type, parent, kwargs) tuple.", nullptr);
+			return nullptr;
+		}
+
+		Entry out = { mvAppItemType::None, nullptr, mvPyObject(nullptr), mvPyObject(nullptr) };
+
+		PyObject* type = PyTuple_GET_ITEM(entry, 0);
+		if (PyUnicode_Check(type))
+		{
+			auto found = commandTypes.find(ToString(type));
+			if (found != commandTypes.end())
+				out.type = found->second;
+		}
+		else if (PyLong_Check(type))
+		{
+			long value = PyLong_AsLong(type);
+			if (value > (long)mvAppItemType::All && value < (long)mvAppItemType::ItemTypeCount)
+				out.type = (mvAppItemType)value;
+		}
+
+		if (out.type == mvAppItemType::None)
+		{
+			PyErr_Clear();
+			mvThrowPythonError(mvErrorCode::mvWrongType, "add_items",
+				"Entry " + std::to_string(i) + ": unknown item type.", nullptr);
+			return nullptr;
+		}
+
+		if (PyTuple_GET_SIZE(entry) > 1)
+		{
+			PyObject* parent = PyTuple_GET_ITEM(entry, 1);
+			if (parent != Py_None && !(PyLong_Check(parent) && ToUUID(parent) == 0))
+				out.parent = parent;
+		}
+
+		if (PyTuple_GET_SIZE(entry) > 2)
+		{
+			PyObject* itemKwargs = PyTuple_GET_ITEM(entry, 2);
+			if (itemKwargs != Py_None && !PyDict_Check(itemKwargs))
+			{
+				mvThrowPythonError(mvErrorCode::mvWrongType, "add_items",
+					"Entry " + std::to_string(i) + ": kwargs must be a dict.", nullptr);
+				return nullptr;
+			}
+			if (itemKwargs != Py_None)
+				out.kwargs = mvPyObject(itemKwargs, true);
+		}
+
+		const mvPythonParser& parser = GetItemParser(out.type);
+		out.args = mvPyObject(PyTuple_New(parser.required_elements.size()));
+		if (!parser.required_elements.empty())
+		{
+			// the item must not see them as keywords, so they go from a copy
+			out.kwargs = mvPyObject(out.kwargs.isOk() ? PyDict_Copy(out.kwargs) : PyDict_New());
+			for (size_t j = 0; j < parser.required_elements.size(); j++)
+			{
+				const char* name = parser.required_elements[j].name;
+				PyObject* value = PyDict_GetItemString(out.kwargs, name);
+				if (!value)
+				{
+					mvThrowPythonError(mvErrorCode::mvNone, "add_items",
+						"Entry " + std::to_string(i) + ": missing required argument '" + name + "'.", nullptr);
+					return nullptr;
+				}
+				Py_INCREF(value);
+				PyTuple_SET_ITEM((PyObject*)out.args, j, value);
+				PyDict_DelItemString(out.kwargs, name);
+			}
+
+			if (!VerifyRequiredArguments(parser, out.args))
+			{
+				if (!PyErr_Occurred())
+					mvThrowPythonError(mvErrorCode::mvNone, "add_items",
+						"Entry " + std::to_string(i) + ": invalid required arguments.", nullptr);
+				return nullptr;
+			}
+		}
+
+		batch.push_back(std::move(out));
+	}
+
+	// how many children each explicitly given (integer) parent receives in
+	// this batch, so that its slot can be grown once
+	std::map<std::pair<mvUUID, i32>, size_t> childCounts;
+	for (const auto& entry : batch)
+	{
+		if (entry.parent && PyLong_Check(entry.parent))
+			childCounts[{ ToUUID(entry.parent), DearPyGui::GetEntityTargetSlot(entry.type) }]++;
+	}
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
+
+	GContext->itemRegistry->slots.reserve(GContext->itemRegistry->slots.size() + batch.size());
+
+	std::vector<std::shared_ptr<mvAppItem>> created;
+	created.reserve(batch.size());
+
+	PyObject* result = PyList_New(count);
+	for (Py_ssize_t i = 0; i < count; i++)
+	{
+		const Entry& entry = batch[i];
+
+		std::shared_ptr<mvAppItem> item = ConstructItem(entry.type, entry.args, entry.kwargs, entry.parent);
+		PyList_SET_ITEM(result, i, ToPyUUID(item.get()));
+		created.push_back(item);
+
+		if (PyErr_Occurred())
+		{
+			// Delete what the batch created, newest first so that children go
+			// before their parents, and keep the error that stopped it.
+			PyObject* errorType;
+			PyObject* errorValue;
+			PyObject* errorTraceback;
+			PyErr_Fetch(&errorType, &errorValue, &errorTraceback);
+			for (auto it = created.rbegin(); it != created.rend(); ++it)
+			{
+				mvAppItem* createdItem = it->get();
+				if (GetItem(*GContext->itemRegistry, createdItem->uuid) != createdItem)
+					continue; // went with an ancestor
+				if (!DeleteItem(*GContext->itemRegistry, createdItem->uuid))
+				{
+					// never made it into the tree
+					RemoveAlias(*GContext->itemRegistry, createdItem->config.alias, true);
+					UnregisterItem(*GContext->itemRegistry, createdItem);
+					PyErr_Clear();
+				}
+			}
+			PyErr_Restore(errorType, errorValue, errorTraceback);
+
+			Py_DECREF(result);
+			return nullptr;
+		}
+
+		if (mvAppItem* parent = item->info.parentPtr)
+		{
+			i32 slot = DearPyGui::GetEntityTargetSlot(item->type);
+			auto found = childCounts.find({ parent->uuid, slot });
+			if (found != childCounts.end() && found->second > 1)
+			{
+				parent->childslots[slot].reserve(parent->childslots[slot].size() + found->second - 1);
+				found->second = 0;
+			}
+		}
+	}
+
+	return result;
+}
+
+static PyObject*
+configure_item(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+
+	mvPySafeLockGuard lk(GContext->mutex, std::try_to_lock);
+	if (!lk.owns_lock())
+	{
+		// A frame is being rendered; record the call instead of waiting for it.
+		if (GContext->IO.commandBuffer)
+		{
+			PushItemCommand(*GContext->itemRegistry, PyTuple_GetItem(args, 0), nullptr, kwargs);
+			return GetPyNone();
+		}
+		lk.lock();
+	}
+
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(PyTuple_GetItem(args, 0));
 	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -4000,7 +4544,7 @@ configure_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	if (appitem)
 	{
 		//appitem->checkArgs(args, kwargs);
-		appitem->handleKeywordArgs(kwargs, GetEntityCommand(appitem->type));
+		appitem->handleKeywordArgs(kwargs, GetItemParser(appitem->type));
 	}
 	else
 	{
@@ -4012,20 +4556,77 @@ configure_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	return GetPyNone();
 }
 
+static PyObject*
+configure_items(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* itemsraw;
+
+	// the keywords are the items' own and are checked by handleKeywordArgs
+	if (!Parse(GetCommandParser(mvCommand::configure_items), args, nullptr, __FUNCTION__, &itemsraw))
+		return nullptr;
+
+	mvPySafeLockGuard lk(GContext->mutex);
+
+	// buffered set_value/configure_item calls are older and must not win
+	FlushItemCommands(*GContext->itemRegistry);
+
+	auto items = ToUUIDVect(itemsraw);
+	if (PyErr_Occurred())
+		return nullptr;
+
+	for (auto uuid : items)
+	{
+		mvAppItem* appitem = GetItem((*GContext->itemRegistry), uuid);
+		if (!appitem)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "configure_items",
+				"Item not found: " + std::to_string(uuid), nullptr);
+			return nullptr;
+		}
+
+		appitem->handleKeywordArgs(kwargs, GetItemParser(appitem->type));
+	}
+
+	return GetPyNone();
+}
+
 static PyObject*
 get_value(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* nameraw;
+	b32 asBuffer = false;
 
-	if (!Parse((GetParsers())["get_value"], args, kwargs, __FUNCTION__, &nameraw))
+	if (!Parse(GetCommandParser(mvCommand::get_value), args, kwargs, __FUNCTION__, &nameraw, &asBuffer))
 		return nullptr;
 
-	mvPySafeLockGuard lk(GContext->mutex);
+	b8 useSnapshot = GContext->IO.commandBuffer && !asBuffer;
+
+	mvPySafeLockGuard lk(GContext->mutex, std::try_to_lock);
+	if (!lk.owns_lock())
+	{
+		// A frame is being rendered; the value it started with will do.
+		if (useSnapshot)
+		{
+			if (PyObject* value = ReadValueSnapshot(*GContext->itemRegistry, nameraw))
+				return value;
+		}
+		lk.lock();
+	}
+
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID name = GetIDFromPyObject(nameraw);
 	mvAppItem* item = GetItem(*GContext->itemRegistry, name);
 	if (item)
-		return item->getPyValue();
+	{
+		if (!useSnapshot)
+			return asBuffer ? item->getPyBufferValue() : item->getPyValue();
+
+		// keep the value in the snapshot so that the next read doesn't wait
+		PyObject* value = item->getPyValue();
+		WatchValue(*GContext->itemRegistry, nameraw, name, value);
+		return value;
+	}
 
 	return GetPyNone();
 }
@@ -4035,10 +4636,11 @@ get_values(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* items;
 
-	if (!Parse((GetParsers())["get_values"], args, kwargs, __FUNCTION__, &items))
+	if (!Parse(GetCommandParser(mvCommand::get_values), args, kwargs, __FUNCTION__, &items))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	auto aitems = ToUUIDVect(items);
 	PyObject* pyvalues = PyList_New(aitems.size());
@@ -4068,10 +4670,22 @@ set_value(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* nameraw;
 	PyObject* value;
 
-	if (!Parse((GetParsers())["set_value"], args, kwargs, __FUNCTION__, &nameraw, &value))
+	if (!Parse(GetCommandParser(mvCommand::set_value), args, kwargs, __FUNCTION__, &nameraw, &value))
 		return nullptr;
 
-	mvPySafeLockGuard lk(GContext->mutex);
+	mvPySafeLockGuard lk(GContext->mutex, std::try_to_lock);
+	if (!lk.owns_lock())
+	{
+		// A frame is being rendered; record the call instead of waiting for it.
+		if (GContext->IO.commandBuffer)
+		{
+			PushItemCommand(*GContext->itemRegistry, nameraw, value, nullptr);
+			return GetPyNone();
+		}
+		lk.lock();
+	}
+
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID name = GetIDFromPyObject(nameraw);
 
@@ -4087,6 +4701,72 @@ set_value(PyObject* self, PyObject* args, PyObject* kwargs)
 	item->setPyValue(value);
 	Py_XDECREF(value);
 
+	mvRequestRedraw();
+	return GetPyNone();
+}
+
+static PyObject*
+set_values(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* itemsraw;
+	PyObject* values;
+
+	if (!Parse(GetCommandParser(mvCommand::set_values), args, kwargs, __FUNCTION__, &itemsraw, &values))
+		return nullptr;
+
+	auto items = ToUUIDVect(itemsraw);
+	if (PyErr_Occurred())
+		return nullptr;
+
+	// numeric buffers (array.array, numpy, ...) are converted in bulk and
+	// written straight into scalar storage
+	std::vector<double> numbers;
+	mvPyObject sequence(nullptr);
+	Py_ssize_t count = 0;
+	if (PyObject_CheckBuffer(values) && !PyBytes_Check(values) && !PyByteArray_Check(values))
+	{
+		numbers = ToDoubleVect(values);
+		if (PyErr_Occurred())
+			return nullptr;
+		count = (Py_ssize_t)numbers.size();
+	}
+	else
+	{
+		sequence = mvPyObject(PySequence_Fast(values, "values must be a sequence"));
+		if (!sequence.isOk())
+			return nullptr;
+		count = PySequence_Fast_GET_SIZE(sequence);
+	}
+
+	if (count != (Py_ssize_t)items.size())
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "set_values",
+			"items and values must have the same length.", nullptr);
+		return nullptr;
+	}
+
+	mvPySafeLockGuard lk(GContext->mutex);
+
+	// buffered set_value/configure_item calls are older and must not win
+	FlushItemCommands(*GContext->itemRegistry);
+
+	for (size_t i = 0; i < items.size(); i++)
+	{
+		mvAppItem* item = GetItem(*GContext->itemRegistry, items[i]);
+		if (!item)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_values",
+				"Item not found: " + std::to_string(items[i]), nullptr);
+			return nullptr;
+		}
+
+		if (sequence.isOk())
+			item->setPyValue(PySequence_Fast_GET_ITEM((PyObject*)sequence, i));
+		else if (!item->setScalarValue(numbers[i]))
+			item->setPyValue(mvPyObject(PyFloat_FromDouble(numbers[i])));
+	}
+
+	mvRequestRedraw();
 	return GetPyNone();
 }
 
@@ -4096,11 +4776,12 @@ set_item_alias(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* itemraw;
 	const char* alias;
 
-	if (!Parse((GetParsers())["set_item_alias"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::set_item_alias), args, kwargs, __FUNCTION__,
 		&itemraw, &alias))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -4114,11 +4795,12 @@ get_item_alias(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	PyObject* itemraw;
 
-	if (!Parse((GetParsers())["get_item_alias"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::get_item_alias), args, kwargs, __FUNCTION__,
 		&itemraw))
 		return nullptr;
 
 	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
 
 	mvUUID item = GetIDFromPyObject(itemraw);
 	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -4133,7 +4815,7 @@ capture_next_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyObject* callable;
 	PyObject* user_data;
 
-	if (!Parse((GetParsers())["capture_next_item"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::capture_next_item), args, kwargs, __FUNCTION__,
 		&callable, &user_data))
 		return nullptr;
 
@@ -4167,13 +4849,13 @@ get_callback_queue(PyObject* self, PyObject* args, PyObject* kwargs)
 		}
 		else
 		{
-			auto liveOwner = cur_entry.owner.lock();
+			auto liveOwner = mvLockCallbackOwner(cur_entry.owner);
 			// If the owner of this entry is gone, we'll just set the callback to None.
 			// This lets us create the output list right away, without the need to collect
 			// valid callbacks first.  Also, this mimicks the behavior of widgets without
 			// a `callback` set on them, which in the "manual" mode put null callbacks into
 			// the queue.  It's mostly a debug/diagnostic mode anyway - captures everything.
-			callback = liveOwner? cur_entry.callback : nullptr;
+			callback = liveOwner && cur_entry.callback? (PyObject*)*cur_entry.callback : nullptr;
 			// Must only be done while we own liveOwner.
 			Py_XINCREF(callback);
 		}
@@ -4197,13 +4879,331 @@ get_callback_queue(PyObject* self, PyObject* args, PyObject* kwargs)
 	return pArgs;
 }
 
+// A caller-supplied column for get_callback_queue_columns: a writable, contiguous
+// buffer of `itemsize`-byte items in one of the struct `formats` (native byte
+// order), or a new bytearray-backed one if `obj` is None.
+struct mvQueueColumn
+{
+	Py_buffer view = {};
+	bool      valid = false;
+
+	~mvQueueColumn() { if (valid) PyBuffer_Release(&view); }
+
+	bool acquire(PyObject* obj, Py_ssize_t itemsize, const char* formats, const char* name)
+	{
+		if (obj == nullptr || obj == Py_None)
+			return true;
+		if (PyObject_GetBuffer(obj, &view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+			return false;
+		valid = true;
+
+		// e.g. an 8-byte 'q' buffer must not pass for doubles
+		const char* format = view.format ? view.format : "B";
+		if (*format == '@' || *format == '=')
+			format++;
+		if (view.itemsize != itemsize || format[0] == 0 || format[1] != 0 || strchr(formats, format[0]) == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "get_callback_queue_columns",
+				std::string("Buffer '") + name + "' must have " + std::to_string(itemsize) + "-byte items of format '" + formats[0] + "'.", nullptr);
+			return false;
+		}
+		return true;
+	}
+
+	Py_ssize_t capacity() const { return valid? view.len / view.itemsize : PY_SSIZE_T_MAX; }
+};
+
+// Wraps `count` items of `data` into a memoryview of the given format.
+static PyObject*
+ToPyColumn(const void* data, Py_ssize_t count, Py_ssize_t itemsize, const char* format)
+{
+	mvPyObject bytes(PyByteArray_FromStringAndSize((const char*)data, count * itemsize));
+	if (!bytes.isOk())
+		return nullptr;
+	mvPyObject view(PyMemoryView_FromObject(bytes));
+	if (!view.isOk())
+		return nullptr;
+	return PyObject_CallMethod(view, "cast", "s", format);
+}
+
+static PyObject*
+get_callback_queue_columns(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* sendersObj = nullptr;
+	PyObject* typesObj = nullptr;
+	PyObject* valuesObj = nullptr;
+
+	if (!Parse(GetCommandParser(mvCommand::get_callback_queue_columns), args, kwargs, __FUNCTION__,
+		&sendersObj, &typesObj, &valuesObj))
+		return nullptr;
+
+	// 'L'/'l' are accepted where they have the right size (itemsize is checked)
+	mvQueueColumn sendersCol, typesCol, valuesCol;
+	if (!sendersCol.acquire(sendersObj, sizeof(mvUUID), "QL", "senders")
+		|| !typesCol.acquire(typesObj, sizeof(i32), "il", "types")
+		|| !valuesCol.acquire(valuesObj, sizeof(double), "d", "values"))
+		return nullptr;
+
+	Py_ssize_t capacity = std::min({ sendersCol.capacity(), typesCol.capacity(), valuesCol.capacity() });
+
+	// Take the jobs that fit and resolve their callbacks while the owners are
+	// known to be alive; everything else is done after the mutex is released.
+	std::vector<mvCallbackJob> jobs;
+	i32* types = typesCol.valid? (i32*)typesCol.view.buf : nullptr;
+	std::vector<i32> ownTypes;
+	std::vector<PyObject*> callbacks;   // new references
+	{
+		mvPySafeLockGuard lk(GContext->mutex);
+		auto& queued = GContext->callbackRegistry->jobs;
+
+		if ((Py_ssize_t)queued.size() <= capacity)
+			jobs.swap(queued);
+		else
+		{
+			jobs.assign(std::make_move_iterator(queued.begin()), std::make_move_iterator(queued.begin() + capacity));
+			queued.erase(queued.begin(), queued.begin() + capacity);
+		}
+
+		if (!types)
+		{
+			ownTypes.resize(jobs.size());
+			types = ownTypes.data();
+		}
+		callbacks.reserve(jobs.size());
+		for (size_t i = 0; i < jobs.size(); i++)
+		{
+			const mvCallbackJob& job = jobs[i];
+			PyObject* callback = nullptr;
+			i32 type = -1;
+			if (job.ownerless_callback)
+				callback = *job.ownerless_callback;
+			else if (auto liveOwner = mvLockCallbackOwner(job.owner))
+			{
+				// Owners of callback jobs are always the items that submitted them.
+				type = (i32)static_cast<mvAppItem*>(liveOwner.get())->type;
+				callback = job.callback? (PyObject*)*job.callback : nullptr;
+			}
+			// A gone owner means a None callback, same as in get_callback_queue.
+			if (callback == nullptr)
+				callback = Py_None;
+			Py_INCREF(callback);
+			callbacks.push_back(callback);
+			types[i] = type;
+		}
+	}
+
+	Py_ssize_t count = (Py_ssize_t)jobs.size();
+
+	// app_data_func may pass ownership of what it returns (e.g. the frame buffer
+	// of output_frame_buffer), so it's called exactly once per job.
+	std::vector<mvPyObject> appData;
+	appData.reserve(count);
+	for (const mvCallbackJob& job : jobs)
+		appData.emplace_back(job.app_data_func());
+
+	// If the result can't be built, the jobs go back to the front of the queue
+	// along with their app_data, so that they aren't lost.
+	auto requeue = [&]() -> PyObject* {
+		for (Py_ssize_t i = 0; i < count; i++)
+		{
+			auto app_data = std::make_shared<mvPyObject>(std::move(appData[i]));
+			jobs[i].app_data_func = [app_data]() -> PyObject* {
+				PyObject* value = *app_data;
+				Py_XINCREF(value);
+				return value;
+			};
+		}
+		mvPySafeLockGuard lk(GContext->mutex);
+		auto& queued = GContext->callbackRegistry->jobs;
+		queued.insert(queued.begin(), std::make_move_iterator(jobs.begin()), std::make_move_iterator(jobs.end()));
+		return nullptr;
+	};
+
+	mvPyObject callbackList(PyList_New(count));
+	mvPyObject userData(PyList_New(count));
+	mvPyObject objects(PyDict_New());
+	if (!callbackList.isOk() || !userData.isOk() || !objects.isOk())
+	{
+		for (PyObject* callback : callbacks)
+			Py_DECREF(callback);
+		return requeue();
+	}
+
+	mvUUID* senders = sendersCol.valid? (mvUUID*)sendersCol.view.buf : nullptr;
+	double* values = valuesCol.valid? (double*)valuesCol.view.buf : nullptr;
+	std::vector<mvUUID> ownSenders(senders? 0 : count);
+	std::vector<double> ownValues(values? 0 : count);
+	if (!senders)
+		senders = ownSenders.data();
+	if (!values)
+		values = ownValues.data();
+
+	for (Py_ssize_t i = 0; i < count; i++)
+	{
+		const mvCallbackJob& job = jobs[i];
+		senders[i] = job.sender;
+		PyList_SET_ITEM((PyObject*)callbackList, i, callbacks[i]);
+
+		PyObject* user_data = *job.user_data;
+		if (user_data == nullptr)
+			user_data = Py_None;
+		Py_INCREF(user_data);
+		PyList_SET_ITEM((PyObject*)userData, i, user_data);
+
+		// Ints and floats go into `values`; anything else (other than None),
+		// bools included, into `objects`.
+		PyObject* app_data = appData[i];
+		values[i] = NAN;
+		if (app_data == nullptr || app_data == Py_None)
+			continue;
+		if (PyFloat_CheckExact(app_data) || PyLong_CheckExact(app_data))
+		{
+			double value = PyFloat_AsDouble(app_data);
+			if (value != -1.0 || !PyErr_Occurred())
+			{
+				values[i] = value;
+				continue;
+			}
+			// an int too large for a double is passed as it is
+			PyErr_Clear();
+		}
+		mvPyObject row(PyLong_FromSsize_t(i));
+		if (!row.isOk() || PyDict_SetItem(objects, row, app_data) != 0)
+			return requeue();
+	}
+
+	// Caller-supplied columns are returned as they are.
+	mvPyObject sendersOut(sendersCol.valid? sendersObj : ToPyColumn(senders, count, sizeof(mvUUID), "Q"), sendersCol.valid);
+	mvPyObject typesOut(typesCol.valid? typesObj : ToPyColumn(types, count, sizeof(i32), "i"), typesCol.valid);
+	mvPyObject valuesOut(valuesCol.valid? valuesObj : ToPyColumn(values, count, sizeof(double), "d"), valuesCol.valid);
+	if (!sendersOut.isOk() || !typesOut.isOk() || !valuesOut.isOk())
+		return requeue();
+
+	PyObject* result = Py_BuildValue("(nOOOOOO)", count, (PyObject*)sendersOut, (PyObject*)typesOut, (PyObject*)valuesOut,
+		(PyObject*)objects, (PyObject*)callbackList, (PyObject*)userData);
+	if (result == nullptr)
+		return requeue();
+
+	// The jobs own user_data etc. and must be released with GIL locked - which we have.
+	jobs.clear();
+	return result;
+}
+
+static PyObject*
+get_callback_queue_stats(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	mvPySafeLockGuard lk(GContext->mutex);
+	auto& registry = *GContext->callbackRegistry;
+
+	// With manual callback management, the queue is the `jobs` list drained by get_callback_queue.
+	i32 pending = GContext->IO.manualCallbacks? (i32)registry.jobs.size() : (i32)registry.callCount;
+
+	PyObject* pdict = PyDict_New();
+	PyDict_SetItemString(pdict, "pending", mvPyObject(ToPyInt(pending)));
+	PyDict_SetItemString(pdict, "capacity", mvPyObject(ToPyInt(registry.maxNumberOfCalls)));
+	PyDict_SetItemString(pdict, "dropped", mvPyObject(PyLong_FromLongLong(registry.droppedCalls)));
+	PyDict_SetItemString(pdict, "coalesced", mvPyObject(PyLong_FromLongLong(registry.coalescedCalls)));
+	return pdict;
+}
+
+static PyObject*
+get_allocation_stats(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	b32 trim = false;
+
+	if (!Parse(GetCommandParser(mvCommand::get_allocation_stats), args, kwargs, __FUNCTION__, &trim))
+		return nullptr;
+
+	if (trim)
+		mvTrimItemPools();
+
+	i64 pooledBlocks = 0;
+	i64 pooledBytes = 0;
+	{
+		std::lock_guard<std::mutex> lk(mvItemPoolBase::GetPoolsMutex());
+		for (mvItemPoolBase* pool : mvItemPoolBase::GetPools())
+		{
+			i64 count = (i64)pool->freeCount();
+			pooledBlocks += count;
+			pooledBytes += count * (i64)pool->blockSize;
+		}
+	}
+
+	auto& stats = mvItemPoolBase::GetStats();
+	PyObject* pdict = PyDict_New();
+	PyDict_SetItemString(pdict, "pool_allocations", mvPyObject(PyLong_FromLongLong(stats.allocations)));
+	PyDict_SetItemString(pdict, "pool_reuses", mvPyObject(PyLong_FromLongLong(stats.reuses)));
+	PyDict_SetItemString(pdict, "pooled_blocks", mvPyObject(PyLong_FromLongLong(pooledBlocks)));
+	PyDict_SetItemString(pdict, "pooled_bytes", mvPyObject(PyLong_FromLongLong(pooledBytes)));
+	PyDict_SetItemString(pdict, "value_buffer_allocations", mvPyObject(PyLong_FromLongLong(stats.valueBufferAllocations)));
+	return pdict;
+}
+
+static PyObject*
+get_memory_stats(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	mvPySafeLockGuard lk(GContext->mutex);
+	FlushItemCommands(*GContext->itemRegistry);
+	auto& registry = *GContext->itemRegistry;
+
+	i64 counts[(size_t)mvAppItemType::ItemTypeCount] = {};
+	i64 coldCounts[(size_t)mvAppItemType::ItemTypeCount] = {};
+	auto countItem = [&](mvAppItem* item) {
+		counts[(size_t)item->type]++;
+		if (item->config.coldConfig)
+			coldCounts[(size_t)item->type]++;
+	};
+	for (const auto& slot : registry.slots)
+	{
+		if (slot.item)
+			countItem(slot.item);
+	}
+	for (const auto& entry : registry.taggedItems)
+	{
+		if (entry.second)
+			countItem(entry.second);
+	}
+
+	i64 totalItems = 0;
+	i64 totalBytes = 0;
+	i64 totalCold = 0;
+	PyObject* types = PyDict_New();
+	for (size_t i = 0; i < (size_t)mvAppItemType::ItemTypeCount; i++)
+	{
+		if (counts[i] == 0)
+			continue;
+
+		i64 size = (i64)DearPyGui::GetEntitySize((mvAppItemType)i);
+		i64 bytes = counts[i] * size + coldCounts[i] * (i64)sizeof(mvAppItemColdConfig);
+		totalItems += counts[i];
+		totalBytes += bytes;
+		totalCold += coldCounts[i];
+
+		PyObject* entry = PyDict_New();
+		PyDict_SetItemString(entry, "count", mvPyObject(PyLong_FromLongLong(counts[i])));
+		PyDict_SetItemString(entry, "item_size", mvPyObject(PyLong_FromLongLong(size)));
+		PyDict_SetItemString(entry, "cold_configs", mvPyObject(PyLong_FromLongLong(coldCounts[i])));
+		PyDict_SetItemString(entry, "bytes", mvPyObject(PyLong_FromLongLong(bytes)));
+		PyDict_SetItemString(types, DearPyGui::GetEntityTypeString((mvAppItemType)i), mvPyObject(entry));
+	}
+
+	PyObject* pdict = PyDict_New();
+	PyDict_SetItemString(pdict, "types", mvPyObject(types));
+	PyDict_SetItemString(pdict, "items", mvPyObject(PyLong_FromLongLong(totalItems)));
+	PyDict_SetItemString(pdict, "bytes", mvPyObject(PyLong_FromLongLong(totalBytes)));
+	PyDict_SetItemString(pdict, "cold_configs", mvPyObject(PyLong_FromLongLong(totalCold)));
+	PyDict_SetItemString(pdict, "cold_config_size", mvPyObject(PyLong_FromLongLong((i64)sizeof(mvAppItemColdConfig))));
+	PyDict_SetItemString(pdict, "pending_deletions", mvPyObject(PyLong_FromLongLong(registry.pendingDeletions)));
+	return pdict;
+}
+
 static PyObject*
 set_clipboard_text(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 
 	const char* text;
 
-	if (!Parse((GetParsers())["set_clipboard_text"], args, kwargs, __FUNCTION__,
+	if (!Parse(GetCommandParser(mvCommand::set_clipboard_text), args, kwargs, __FUNCTION__,
 		&text))
 		return nullptr;
 
@@ -30,6 +30,34 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		parsers.insert({ "set_frame_callback", parser });
 	}
 
+	{
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::Integer, "interval", mvArgType::REQUIRED_ARG, "...", "Milliseconds between calls (or before the only call, if repeat is False)." });
+		args.push_back({ mvPyDataType::Callable, "callback" });
+		args.push_back({ mvPyDataType::Bool, "repeat", mvArgType::KEYWORD_ARG, "True", "Keep calling the callback every interval until the timer is deleted." });
+		args.push_back({ mvPyDataType::Object, "user_data", mvArgType::KEYWORD_ARG, "None", "Optional user data to send to the callback" });
+
+		mvPythonParserSetup setup;
+		setup.about = "Sets a callback to run after a time interval, once or repeatedly. The callback gets the timer as the sender. Timers keep firing when wait_for_input is enabled. Returns the timer.";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::Integer;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "set_timer_callback", parser });
+	}
+
+	{
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::Integer, "timer" });
+
+		mvPythonParserSetup setup;
+		setup.about = "Deletes a timer created by set_timer_callback. A call that's already queued may still run.";
+		setup.category = { "General" };
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "delete_timer_callback", parser });
+	}
+
 	{
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Callable, "callback" });
@@ -402,6 +430,9 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		args.push_back({ mvPyDataType::Bool, "decorated", mvArgType::KEYWORD_ARG, "True", "Enabled and disabled the decorator bar at the top of the viewport." });
 		args.push_back({ mvPyDataType::FloatList, "clear_color", mvArgType::KEYWORD_ARG, "(0, 0, 0, 255)", "Sets the color of the back of the viewport." });
 		args.push_back({ mvPyDataType::Bool, "disable_close", mvArgType::KEYWORD_ARG, "False", "Disables the viewport close button. can be used with set_exit_callback" });
+		args.push_back({ mvPyDataType::Integer, "max_fps", mvArgType::KEYWORD_ARG, "0", "Caps the frame rate, with or without vsync (0 for no cap)." });
+		args.push_back({ mvPyDataType::Float, "fixed_delta_time", mvArgType::KEYWORD_ARG, "0.0", "Advances time by this many seconds every frame instead of using the real time (0 for real time)." });
+		args.push_back({ mvPyDataType::Bool, "headless", mvArgType::KEYWORD_ARG, "False", "Renders into an offscreen framebuffer instead of a window, without needing a display (Linux only)." });
 
 		mvPythonParserSetup setup;
 		setup.about = "Creates a viewport. Viewports are required.";
@@ -532,8 +563,19 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		args.push_back({ mvPyDataType::Bool, "skip_required_args", mvArgType::KEYWORD_ARG, "False" });
 		args.push_back({ mvPyDataType::Bool, "skip_positional_args", mvArgType::KEYWORD_ARG, "False" });
 		args.push_back({ mvPyDataType::Bool, "skip_keyword_args", mvArgType::KEYWORD_ARG, "False" });
+		args.push_back({ mvPyDataType::Bool, "skip_keyword_validation", mvArgType::KEYWORD_ARG, "False", "Don't check keyword names passed to item constructors, configure_item and configure_app. Unknown keywords are silently ignored." });
+		args.push_back({ mvPyDataType::Integer, "deferred_deletion_threshold", mvArgType::KEYWORD_ARG, "1000", "Deleted subtrees with at least this many items are unlinked right away but destroyed over the following frames (0 to always destroy right away)." });
+		args.push_back({ mvPyDataType::Integer, "deletion_budget", mvArgType::KEYWORD_ARG, "2000", "Maximum number of deferred items destroyed per frame." });
+		args.push_back({ mvPyDataType::Bool, "command_buffer", mvArgType::KEYWORD_ARG, "False", "If a frame is being rendered, set_value and configure_item are recorded and applied before the next frame instead of waiting, and get_value returns the value from the start of the frame." });
 		args.push_back({ mvPyDataType::Bool, "wait_for_input", mvArgType::KEYWORD_ARG, "False", "New in 1.1. Only update when user input occurs" });
+		args.push_back({ mvPyDataType::Float, "max_idle_interval", mvArgType::KEYWORD_ARG, "0.0", "With wait_for_input, the longest time in seconds without a new frame even if nothing changes (0 for no limit)." });
+		args.push_back({ mvPyDataType::Bool, "null_renderer", mvArgType::KEYWORD_ARG, "False", "Frames are built as usual, but the draw data isn't rendered (the viewport is only cleared). For measuring the CPU cost of the UI, see get_render_stats." });
 		args.push_back({ mvPyDataType::Bool, "manual_callback_management", mvArgType::KEYWORD_ARG, "False", "New in 1.2"});
+		args.push_back({ mvPyDataType::Integer, "callback_queue_capacity", mvArgType::KEYWORD_ARG, "500", "Maximum number of callbacks waiting to be run. What happens to further callbacks depends on callback_queue_policy." });
+		args.push_back({ mvPyDataType::Integer, "callback_queue_policy", mvArgType::KEYWORD_ARG, "internal_dpg.mvCallbackQueue_DropNewest", "mvCallbackQueue_DropNewest discards new callbacks while the queue is full; mvCallbackQueue_DropOldest discards the oldest pending ones instead." });
+		args.push_back({ mvPyDataType::Bool, "coalesce_callbacks", mvArgType::KEYWORD_ARG, "False", "Mouse move/drag and resize handlers, as well as the viewport resize callback, keep at most one pending call; a newer event replaces it." });
+		args.push_back({ mvPyDataType::Integer, "callback_workers", mvArgType::KEYWORD_ARG, "0", "Number of threads running callbacks (must be set before setup_dearpygui). Callbacks from the same item run in order; callbacks from different items may run concurrently. Mostly useful on free-threaded Python." });
+		args.push_back({ mvPyDataType::Object, "callback_loop", mvArgType::KEYWORD_ARG, "None", "An asyncio event loop to run callbacks on (None to turn this off). Callbacks are posted to the loop in batches; `async def` callbacks become tasks on that loop." });
 		args.push_back({ mvPyDataType::Bool, "keyboard_navigation", mvArgType::KEYWORD_ARG, "False", "Keyboard navigation using arrow keys" });
 		args.push_back({ mvPyDataType::Bool, "anti_aliased_lines", mvArgType::KEYWORD_ARG, "False", "Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame." });
 		args.push_back({ mvPyDataType::Bool, "anti_aliased_lines_use_tex", mvArgType::KEYWORD_ARG, "False", "Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame." });
@@ -791,6 +833,18 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		parsers.insert({ "get_frame_rate", parser });
 	}
 
+	{
+		std::vector<mvPythonDataElement> args;
+
+		mvPythonParserSetup setup;
+		setup.about = "Returns render loop statistics: the number of frames rendered and of render_dearpygui_frame calls that rendered nothing (the viewport was minimized, or nothing changed with wait_for_input), the smoothed frame time and its jitter in seconds, and the size of the last frame's draw data (draw lists, vertices, indices, draw commands and texture binds).";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::Dict;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "get_render_stats", parser });
+	}
+
 	{
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Bool, "local", mvArgType::KEYWORD_ARG, "True" });
@@ -1225,6 +1279,30 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		parsers.insert({ "delete_item", parser });
 	}
 
+	{
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::UUIDList, "items" });
+
+		mvPythonParserSetup setup;
+		setup.about = "Deletes several items at once. Siblings are removed from their parent in a single pass, which is much faster than calling delete_item on each of them.";
+		setup.category = { "Item Registry" };
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "delete_items", parser });
+	}
+
+	{
+		std::vector<mvPythonDataElement> args;
+
+		mvPythonParserSetup setup;
+		setup.about = "Returns the number of deleted items that are still waiting to be destroyed (see deferred_deletion_threshold in configure_app).";
+		setup.category = { "Item Registry" };
+		setup.returnType = mvPyDataType::Integer;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "get_pending_deletions", parser });
+	}
+
 	{
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
@@ -1460,9 +1538,24 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		parsers.insert({ "configure_item", parser });
 	}
 
+	{
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::UUIDList, "items" });
+
+		mvPythonParserSetup setup;
+		setup.about = "Configures a list of items with the same keywords.";
+		setup.category = { "App Item Operations" };
+		setup.unspecifiedKwargs = true;
+		setup.internal = true;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "configure_items", parser });
+	}
+
 	{
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
+		args.push_back({ mvPyDataType::Bool, "as_buffer", mvArgType::KEYWORD_ARG, "False", "Array values (series, float vectors, textures) are returned as read-only memoryview snapshots instead of lists." });
 
 		mvPythonParserSetup setup;
 		setup.about = "Returns an item's value.";
@@ -1473,6 +1566,19 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		parsers.insert({ "get_value", parser });
 	}
 
+	{
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::Object, "items", mvArgType::REQUIRED_ARG, "", "Sequence of (type, parent, kwargs) tuples. Type is either the command name (e.g. 'add_button') or a value from get_item_types(). Parent and kwargs may be omitted or None." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Creates many items under a single lock. Equivalent to calling the add_* command of each entry in order, except that required arguments are passed by name in kwargs and optional positional arguments can't be passed. If an entry fails, the items the batch already created are deleted again. Returns the UUIDs (or aliases) of the new items.";
+		setup.category = { "App Item Operations" };
+		setup.returnType = mvPyDataType::UUIDList;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "add_items", parser });
+	}
+
 	{
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUIDList, "items" });
@@ -1499,6 +1605,19 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		parsers.insert({ "set_value", parser });
 	}
 
+	{
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::UUIDList, "items" });
+		args.push_back({ mvPyDataType::Object, "values", mvArgType::REQUIRED_ARG, "", "One value per item. Numeric buffers (e.g. numpy arrays) are written to int, float, double and bool items without creating Python objects." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Sets the values of a list of items.";
+		setup.category = { "App Item Operations" };
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "set_values", parser });
+	}
+
 	{
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
@@ -1945,6 +2064,58 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		parsers.insert({ "get_callback_queue", parser });
 	}
 
+	{
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::Object, "senders", mvArgType::KEYWORD_ARG, "None", "Optional writable buffer of format 'Q' (e.g. array('Q')) to fill with sender ids." });
+		args.push_back({ mvPyDataType::Object, "types", mvArgType::KEYWORD_ARG, "None", "Optional writable buffer of format 'i' (e.g. array('i')) to fill with sender item types." });
+		args.push_back({ mvPyDataType::Object, "values", mvArgType::KEYWORD_ARG, "None", "Optional writable buffer of format 'd' (e.g. array('d')) to fill with numeric app_data." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Columnar alternative to get_callback_queue for manual callback management. Returns (count, senders, types, values, objects, callbacks, user_data): sender ids (u64), sender item types (i32, -1 for frame/timer/viewport callbacks), app_data that is an int or a float (f64, NaN otherwise), a dict of row to app_data for other non-None app_data (bools and ints too large for a double included), and lists of callbacks and user_data. Columns are written into the given buffers if any; if there are more jobs than fit, the rest stay queued, and if the result can't be built, all of them do. This saves the per-job tuples and number objects; the objects dict and the callbacks and user_data lists are still created on every call.";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::Object;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "get_callback_queue_columns", parser });
+	}
+
+	{
+		std::vector<mvPythonDataElement> args;
+
+		mvPythonParserSetup setup;
+		setup.about = "Returns callback queue statistics: number of pending calls, queue capacity, and how many calls have been dropped or coalesced so far.";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::Dict;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "get_callback_queue_stats", parser });
+	}
+
+	{
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::Bool, "trim", mvArgType::KEYWORD_ARG, "False", "Returns the blocks kept for reuse to the heap before gathering the statistics." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Returns item memory pool statistics: how many pool blocks were taken from the heap (pool_allocations) and how many were recycled (pool_reuses) since the start, how many blocks/bytes are currently kept for reuse, and how many times the buffer of a vector value (series columns, float vects, textures) had to grow (value_buffer_allocations). Items and their value storage come from the pools; strings and child lists still use the heap directly. Once an app has warmed up, setting values of unchanged sizes leaves both allocation counters where they are. Pools keep their free blocks until the context is destroyed or trim is set.";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::Dict;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "get_allocation_stats", parser });
+	}
+
+	{
+		std::vector<mvPythonDataElement> args;
+
+		mvPythonParserSetup setup;
+		setup.about = "Returns memory used by live items. 'types' maps each item type to its count, item_size (in-object bytes per item), number of allocated cold configs (drag and drop/scroll settings), and total bytes. Heap data owned by items (strings, values, children lists) is not included.";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::Dict;
+
+		mvPythonParser parser = FinalizeParser(setup, args);
+		parsers.insert({ "get_memory_stats", parser });
+	}
+
 	{
 		std::vector<mvPythonDataElement> args;
 
@@ -22,10 +22,36 @@ UpdateLocations(std::vector<std::shared_ptr<mvAppItem>>* children, i32 slots)
     }
 }
 
+// Appends "###<id>" for ImGui. Generated UUIDs are too long to fit into the
+// small string buffer in decimal, so they are written in base 64 instead
+// ("###" + at most 11 digits fits). User tags keep the decimal form, so ImGui
+// settings saved in .ini files stay valid for them.
+static void
+AppendImGuiID(std::string& label, mvUUID uuid)
+{
+    label += "###";
+    if (!(uuid & MV_SLOT_UUID_FLAG))
+    {
+        label += std::to_string(uuid);
+        return;
+    }
+
+    static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ-_";
+    char buffer[11];
+    i32 count = 0;
+    do
+    {
+        buffer[count++] = digits[uuid & 63];
+        uuid >>= 6;
+    } while (uuid != 0);
+    while (count > 0)
+        label += buffer[--count];
+}
+
 mvAppItem::mvAppItem(mvUUID uuid)
 {
     this->uuid = uuid;
-    info.internalLabel = "###" + std::to_string(uuid);
+    AppendImGuiID(info.internalLabel, uuid);
     state.parent = this;
 }
 
@@ -47,7 +73,7 @@ mvAppItem::~mvAppItem()
             if (!GContext->IO.manualAliasManagement)
                 GContext->itemRegistry->aliases.erase(config.alias);
         }
-        GContext->itemRegistry->allItems.erase(uuid);
+        UnregisterItem(*GContext->itemRegistry, this);
     }
 }
 
@@ -135,12 +161,12 @@ void mvAppItem::submitCallback(ImGuiKey app_data)
 }
 
 void 
-mvAppItem::handleKeywordArgs(PyObject* dict, const std::string& parser)
+mvAppItem::handleKeywordArgs(PyObject* dict, const mvPythonParser& parser)
 {
     if (dict == nullptr)
         return;
 
-    if (VerifyKeywordArguments(GetParsers()[parser], dict))
+    if (VerifyKeywordArguments(parser, dict))
         return;
 
     if (PyArg_ValidateKeywordArguments(dict) == 0)
@@ -150,108 +176,116 @@ mvAppItem::handleKeywordArgs(PyObject* dict, const std::string& parser)
         return;
     }
 
-    if (PyObject* item = PyDict_GetItemString(dict, "use_internal_label")) config.useInternalLabel = ToBool(item); // must be before label
-
-    if (PyObject* item = PyDict_GetItemString(dict, "label"))
-    {
-        if (item != Py_None)
-        {
-            const std::string label = ToString(item);
-            config.specifiedLabel = label;
-            if (config.useInternalLabel)
-                info.internalLabel = label + "###" + std::to_string(uuid);
-            else
-                info.internalLabel = label;
-        }
-    }
-
-    if (PyObject* item = PyDict_GetItemString(dict, "width"))
-    {
-        info.dirty_size = true;
-        config.width = ToInt(item);
-    }
-    if (PyObject* item = PyDict_GetItemString(dict, "height"))
-    {
-        info.dirty_size = true;
-        config.height = ToInt(item);
-    }
-
-    if (PyObject* item = PyDict_GetItemString(dict, "pos")) {
-        std::vector<f32> position = ToFloatVect(item);
-        if (!position.empty())
-        {
-            info.dirtyPos = true;
-            state.pos = mvVec2{ position[0], position[1] };
-        }
-    }
-    if (PyObject* item = PyDict_GetItemString(dict, "indent")) config.indent = (f32)ToInt(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "show")) 
-    {
-        config.show = ToBool(item);
-        if (config.show)
-            info.shownLastFrame = true;
-        else
-            info.hiddenLastFrame = true;
-    }
-
-    if (PyObject* item = PyDict_GetItemString(dict, "filter_key")) config.filter = ToString(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "payload_type")) config.payloadType = ToString(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "source"))
-    {
-        if (isPyObject_Int(item))
-            setDataSource(ToUUID(item));
-        else if (isPyObject_String(item))
-        {
-            std::string alias = ToString(item);
-            setDataSource(GetIdFromAlias(*GContext->itemRegistry, alias));
-        }
-    }
-    if (PyObject* item = PyDict_GetItemString(dict, "enabled"))
-    {
-        b8 value = ToBool(item);
-
-        if (config.enabled != value)
-        {
-            config.enabled = value;
-
-            if (value)
-                info.enabledLastFrame = true;
-            else
-                info.disabledLastFrame = true;
-        }
-    }
-    if (PyObject* item = PyDict_GetItemString(dict, "tracked")) config.tracked = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "track_offset"))
-    {
-        config.trackOffset = ToFloat(item);
-    }
-    if (PyObject* item = PyDict_GetItemString(dict, "default_value"))
-    {
-        if(config.source == 0)
-            setPyValue(item);
-    }
+    mvRequestRedraw();
+
+    // table order matters: use_internal_label must be before label and
+    // source before default_value
+    static const mvKeywordTable<mvAppItem> keywords = {
+        { "use_internal_label", [](mvAppItem& self, PyObject* item) { self.config.useInternalLabel = ToBool(item); } },
+        { "label", [](mvAppItem& self, PyObject* item)
+            {
+                if (item != Py_None)
+                {
+                    const std::string label = ToString(item);
+                    self.config.specifiedLabel = label;
+                    self.info.internalLabel = label;
+                    if (self.config.useInternalLabel)
+                        AppendImGuiID(self.info.internalLabel, self.uuid);
+                }
+            } },
+        { "width", [](mvAppItem& self, PyObject* item)
+            {
+                self.info.dirty_size = true;
+                self.config.width = ToInt(item);
+            } },
+        { "height", [](mvAppItem& self, PyObject* item)
+            {
+                self.info.dirty_size = true;
+                self.config.height = ToInt(item);
+            } },
+        { "pos", [](mvAppItem& self, PyObject* item)
+            {
+                std::vector<f32> position = ToFloatVect(item);
+                if (!position.empty())
+                {
+                    self.info.dirtyPos = true;
+                    self.state.pos = mvVec2{ position[0], position[1] };
+                }
+            } },
+        { "indent", [](mvAppItem& self, PyObject* item) { self.config.indent = (f32)ToInt(item); } },
+        { "show", [](mvAppItem& self, PyObject* item)
+            {
+                self.config.show = ToBool(item);
+                if (self.config.show)
+                    self.info.shownLastFrame = true;
+                else
+                    self.info.hiddenLastFrame = true;
+            } },
+        { "filter_key", [](mvAppItem& self, PyObject* item) { self.config.filter = ToString(item); } },
+        { "payload_type", [](mvAppItem& self, PyObject* item)
+            {
+                // wrappers pass the default for every item; don't allocate the cold config for it
+                std::string payloadType = ToString(item);
+                if (self.config.coldConfig || payloadType != self.config.cold().payloadType)
+                    self.config.editCold().payloadType = std::move(payloadType);
+            } },
+        { "source", [](mvAppItem& self, PyObject* item)
+            {
+                if (isPyObject_Int(item))
+                    self.setDataSource(ToUUID(item));
+                else if (isPyObject_String(item))
+                {
+                    std::string alias = ToString(item);
+                    self.setDataSource(GetIdFromAlias(*GContext->itemRegistry, alias));
+                }
+            } },
+        { "enabled", [](mvAppItem& self, PyObject* item)
+            {
+                b8 value = ToBool(item);
+
+                if (self.config.enabled != value)
+                {
+                    self.config.enabled = value;
+
+                    if (value)
+                        self.info.enabledLastFrame = true;
+                    else
+                        self.info.disabledLastFrame = true;
+                }
+            } },
+        { "tracked", [](mvAppItem& self, PyObject* item) { self.config.tracked = ToBool(item); } },
+        { "track_offset", [](mvAppItem& self, PyObject* item) { self.config.trackOffset = ToFloat(item); } },
+        { "default_value", [](mvAppItem& self, PyObject* item)
+            {
+                if (self.config.source == 0)
+                    self.setPyValue(item);
+            } },
+        { "callback", [](mvAppItem& self, PyObject* item) { self.config.callback = mvPyCallback(item == Py_None? nullptr : item, true); } },
+        { "drag_callback", [](mvAppItem& self, PyObject* item) { if (item != Py_None || self.config.coldConfig) self.config.editCold().dragCallback = mvPyCallback(item == Py_None? nullptr : item, true); } },
+        { "drop_callback", [](mvAppItem& self, PyObject* item) { if (item != Py_None || self.config.coldConfig) self.config.editCold().dropCallback = mvPyCallback(item == Py_None? nullptr : item, true); } },
+        { "user_data", [](mvAppItem& self, PyObject* item) { *self.config.user_data = mvPyObject(item == Py_None? nullptr : item, true); } },
+    };
 
-    if (PyObject* item = PyDict_GetItemString(dict, "callback"))
-    {
-        config.callback = mvPyObject(item == Py_None? nullptr : item, true);
-    }
+    keywords.apply(dict, *this);
 
-    if (PyObject* item = PyDict_GetItemString(dict, "drag_callback"))
-    {
-        config.dragCallback = mvPyObject(item == Py_None? nullptr : item, true);
-    }
+    handleSpecificKeywordArgs(dict);
+}
 
-    if (PyObject* item = PyDict_GetItemString(dict, "drop_callback"))
-    {
-        config.dropCallback = mvPyObject(item == Py_None? nullptr : item, true);
-    }
+bool
+mvAppItem::setScalarValue(double value)
+{
+    void* storage = getValue();
+    if (storage == nullptr)
+        return false;
 
-    if (PyObject* item = PyDict_GetItemString(dict, "user_data"))
+    switch (DearPyGui::GetEntityValueType(type))
     {
-        *config.user_data = mvPyObject(item == Py_None? nullptr : item, true);
+    case StorageValueTypes::Int:    **static_cast<std::shared_ptr<int>*>(storage) = (int)value; return true;
+    case StorageValueTypes::Float:  **static_cast<std::shared_ptr<float>*>(storage) = (float)value; return true;
+    case StorageValueTypes::Double: **static_cast<std::shared_ptr<double>*>(storage) = value; return true;
+    case StorageValueTypes::Bool:   **static_cast<std::shared_ptr<bool>*>(storage) = value != 0.0; return true;
+    default: return false;
     }
-
-    handleSpecificKeywordArgs(dict);
 }
 
 void 
@@ -263,31 +297,33 @@ mvAppItem::setDataSource(mvUUID value)
 void 
 mvAppItem::handleImmediateScroll()
 {
-    if (!((config.scrollXFlags | config.scrollYFlags) & mvSetScrollFlags_Now))
+    const mvAppItemColdConfig& cold = config.cold();
+    if (!((cold.scrollXFlags | cold.scrollYFlags) & mvSetScrollFlags_Now))
         return;
 
-    ImVec2 scroll = { (config.scrollXFlags & mvSetScrollFlags_Now)? config.scrollX : -1,
-                      (config.scrollYFlags & mvSetScrollFlags_Now)? config.scrollY : -1 };
+    ImVec2 scroll = { (cold.scrollXFlags & mvSetScrollFlags_Now)? cold.scrollX : -1,
+                      (cold.scrollYFlags & mvSetScrollFlags_Now)? cold.scrollY : -1 };
     ImGui::SetNextWindowScroll(scroll);
 }
 
 void 
 mvAppItem::handleDelayedScroll()
 {
-    if (config.scrollXFlags & mvSetScrollFlags_Delayed)
+    const mvAppItemColdConfig& cold = config.cold();
+    if (cold.scrollXFlags & mvSetScrollFlags_Delayed)
     {
-        if (config.scrollX < 0.0f)
+        if (cold.scrollX < 0.0f)
             ImGui::SetScrollHereX(1.0f);
         else
-            ImGui::SetScrollX(config.scrollX);
+            ImGui::SetScrollX(cold.scrollX);
     }
 
-    if (config.scrollYFlags & mvSetScrollFlags_Delayed)
+    if (cold.scrollYFlags & mvSetScrollFlags_Delayed)
     {
-        if (config.scrollY < 0.0f)
+        if (cold.scrollY < 0.0f)
             ImGui::SetScrollHereY(1.0f);
         else
-            ImGui::SetScrollY(config.scrollY);
+            ImGui::SetScrollY(cold.scrollY);
     }
 }
 
@@ -1242,10 +1278,22 @@ DearPyGui::GetEntityTypeString(mvAppItemType type)
     return entity_type_strings[(size_t)type];
 }
 
+size_t
+DearPyGui::GetEntitySize(mvAppItemType type)
+{
+    #define X(el) case mvAppItemType::el: return sizeof(el);
+    switch (type)
+    {
+        MV_ITEM_TYPES
+        default: return 0;
+    }
+    #undef X
+}
+
 std::shared_ptr<mvAppItem>
 DearPyGui::CreateEntity(mvAppItemType type, mvUUID id)
 {
-    #define X(el) case mvAppItemType::el: {auto item = std::make_shared<el>(id); item->type = mvAppItemType::el; return item;};
+    #define X(el) case mvAppItemType::el: {auto item = mvAllocateShared<el>(id); item->type = mvAppItemType::el; return item;};
     switch (type)
     {
         MV_ITEM_TYPES
@@ -13,6 +13,7 @@
 #include "mvAppItemState.h"
 #include "mvCallbackRegistry.h"
 #include "mvPyUtils.h"
+#include "mvItemPool.h"
 #include "mvAppItemTypes.inc"
 
 // forward declarations
@@ -63,7 +64,8 @@ enum class mvLibType
 struct ScopedID
 {
     ScopedID(void* id) { ImGui::PushID(id); }
-    ScopedID(mvUUID id) { ImGui::PushID((int)id); }
+    // hash all 64 bits: the low 32 bits of a generated UUID are a reusable slot index
+    ScopedID(mvUUID id) { ImGui::PushID((const char*)&id, (const char*)&id + sizeof(id)); }
     ~ScopedID() { ImGui::PopID(); }
 };
 
@@ -74,6 +76,7 @@ namespace DearPyGui
     int                                             GetEntityTargetSlot             (mvAppItemType type);
     StorageValueTypes                               GetEntityValueType              (mvAppItemType type);
     const char*                                     GetEntityTypeString             (mvAppItemType type);
+    size_t                                          GetEntitySize                   (mvAppItemType type); // sizeof the item class
     int                                             GetApplicableState              (mvAppItemType type);
     const std::vector<std::pair<std::string, i32>>& GetAllowableParents             (mvAppItemType type);
     const std::vector<std::pair<std::string, i32>>& GetAllowableChildren            (mvAppItemType type);
@@ -93,6 +96,7 @@ struct mvAppItemInfo
     mvAppItem*  parentPtr = nullptr;
     int         location = -1;
     bool        showDebug = false;
+    bool        retired   = false; // deleted, but destroyed over the next frames (see ReclaimRetiredItems)
         
     // next frame triggers
     bool focusNextFrame           = false;
@@ -118,33 +122,59 @@ enum mvSetScrollFlags
     mvSetScrollFlags_Both       = mvSetScrollFlags_Now | mvSetScrollFlags_Delayed
 };
 
+// Configuration that few items ever set (drag and drop, scroll requests).
+// It's kept out of mvAppItemConfig and only allocated when first written to.
+struct mvAppItemColdConfig
+{
+    std::string  payloadType = "$$DPG_PAYLOAD";
+    mvPyCallback dragCallback = nullptr;
+    mvPyCallback dropCallback = nullptr;
+    float        scrollX      = 0.0f;
+    float        scrollY      = 0.0f;
+    mvSetScrollFlags scrollXFlags = mvSetScrollFlags_None;
+    mvSetScrollFlags scrollYFlags = mvSetScrollFlags_None;
+};
+
 struct mvAppItemConfig
 {
-    mvUUID      source = 0;
-    mvUUID      parent = 0;
-    std::string specifiedLabel;
-    std::string filter;
-    std::string alias;
-    std::string payloadType = "$$DPG_PAYLOAD";
-    int         width = 0;
-    int         height = 0;
-    float       indent = -1.0f;
-    float       trackOffset = 0.5f; // 0.0f:top, 0.5f:center, 1.0f:bottom
+    // read by the render walk every frame
     bool        show             = true;
     bool        enabled          = true;
     bool        useInternalLabel = true; // when false, will use specificed label
     bool        tracked          = false;
-    mvPyObject  callback         = nullptr;
-    mvPyObject  dragCallback     = nullptr;
-    mvPyObject  dropCallback     = nullptr;
+    int         width = 0;
+    int         height = 0;
+    float       indent = -1.0f;
+    float       trackOffset = 0.5f; // 0.0f:top, 0.5f:center, 1.0f:bottom
+    mvUUID      source = 0;
+    mvUUID      parent = 0;
+
+    mvPyCallback callback        = nullptr;
     // We store user_data as a pointer because that's how we'll need it when submitting
     // the callback.  This is to pass user_data into mvAddCallback that comes from a
     // different source than the callback owner (required for the drag callback).
-    std::shared_ptr<mvPyObject> user_data = std::make_shared<mvPyObject>(nullptr);
-    float       scrollX          = 0.0f;
-    float       scrollY          = 0.0f;
-    mvSetScrollFlags scrollXFlags = mvSetScrollFlags_None;
-    mvSetScrollFlags scrollYFlags = mvSetScrollFlags_None;
+    std::shared_ptr<mvPyObject> user_data = mvAllocateShared<mvPyObject>(nullptr);
+    std::string specifiedLabel;
+    std::string filter;
+    std::string alias;
+
+    std::unique_ptr<mvAppItemColdConfig> coldConfig;
+
+    // Items that have never written to the cold config share the defaults.
+    const mvAppItemColdConfig& cold() const
+    {
+        static const mvAppItemColdConfig defaults;
+        return coldConfig? *coldConfig : defaults;
+    }
+
+    // Note: once allocated, the block stays in place for the item's lifetime
+    // (callbacks in it are referenced by queued calls).
+    mvAppItemColdConfig& editCold()
+    {
+        if (!coldConfig)
+            coldConfig = std::make_unique<mvAppItemColdConfig>();
+        return *coldConfig;
+    }
 };
 
 struct mvAppItemDrawInfo
@@ -165,15 +195,9 @@ class mvAppItem : public std::enable_shared_from_this<mvAppItem>
 
 public:
 
+    // Ordered so that what the render walk touches for every item comes first.
     mvAppItemType                type = mvAppItemType::None;
     mvUUID                       uuid = 0;
-    mvAppItemState               state;
-    mvAppItemInfo                info{};
-    mvAppItemConfig              config{};
-    std::shared_ptr<mvItemHandlerRegistry> handlerRegistry = nullptr;
-    std::shared_ptr<mvAppItem>             font = nullptr;
-    std::shared_ptr<mvTheme>               theme = nullptr;
-    std::shared_ptr<mvAppItemDrawInfo>     drawInfo = nullptr;
 
     // slots
     //   * 0 : mvFileExtension, mvNodeLink, mvAnnotation, mvAxisTag
@@ -183,6 +207,14 @@ public:
     //   * 3 : mvDragPayload
     std::vector<std::shared_ptr<mvAppItem>> childslots[4] = { {}, {}, {}, {} };
 
+    std::shared_ptr<mvTheme>               theme = nullptr;
+    std::shared_ptr<mvAppItem>             font = nullptr;
+    std::shared_ptr<mvItemHandlerRegistry> handlerRegistry = nullptr;
+    std::shared_ptr<mvAppItemDrawInfo>     drawInfo = nullptr;
+    mvAppItemConfig              config{};
+    mvAppItemInfo                info{};
+    mvAppItemState               state;
+
 public:
 
     mvAppItem(mvUUID uuid);
@@ -209,8 +241,16 @@ public:
     virtual PyObject* getPyValue() { return GetPyNone(); }
     virtual void      setPyValue(PyObject* value) { }
 
+    // get_value(..., as_buffer=True): array storage is returned as read-only
+    // memoryview snapshots instead of lists of python floats
+    virtual PyObject* getPyBufferValue() { return getPyValue(); }
+
+    // set_values(): writes a plain number into Int/Float/Double/Bool storage
+    // without going through a PyObject; returns false for other storage types
+    virtual bool      setScalarValue(double value);
+
     // used to check arguments, get/set configurations
-    void handleKeywordArgs(PyObject* dict, const std::string& parser);  // python dictionary acts as an out parameter 
+    void handleKeywordArgs(PyObject* dict, const mvPythonParser& parser);  // python dictionary acts as an out parameter 
 
     // used by derived items to register their arguments
     virtual void handleSpecificRequiredArgs  (PyObject* args)  {}
@@ -227,11 +267,16 @@ public:
     // It does *not* check if the item is enabled or disabled, because some "custom"
     // callbacks historically run even on disabled items.
     template<typename AppDataFunc>
-    void submitCallbackEx(PyObject* callback, AppDataFunc app_data_func)
+    void submitCallbackEx(const mvPyCallback& callback, AppDataFunc app_data_func)
     {
         // The current `mvAppItem` becomes the owner of this callback, and as soon
         // as it gets deleted, the callback entry will be thrown away.
-        mvAddCallback(weak_from_this(), callback, config.user_data, uuid, config.alias, app_data_func);
+        // Handlers that fire every frame while active only care about the
+        // latest state, so their pending calls may be coalesced.
+        bool coalesce = type == mvAppItemType::mvMouseMoveHandler
+            || type == mvAppItemType::mvMouseDragHandler
+            || type == mvAppItemType::mvResizeHandler;
+        mvAddCallback(weak_from_this(), callback, config.user_data, uuid, config.alias, app_data_func, coalesce);
     }
 
     // Submits the mvAppItem's "default" callback, if any, with user_data from
@@ -712,11 +712,15 @@ DearPyGui::set_configuration(PyObject* inDict, mvSimplePlotConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "overlay"))   outConfig.overlay = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "minscale"))  outConfig.scaleMin = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "maxscale"))  outConfig.scaleMax = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "histogram")) outConfig.histogram = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "autosize"))  outConfig.autosize = ToBool(item);
+	static const mvKeywordTable<mvSimplePlotConfig> keywords = {
+		{ "overlay", [](mvSimplePlotConfig& config, PyObject* item) { config.overlay = ToString(item); } },
+		{ "minscale", [](mvSimplePlotConfig& config, PyObject* item) { config.scaleMin = ToFloat(item); } },
+		{ "maxscale", [](mvSimplePlotConfig& config, PyObject* item) { config.scaleMax = ToFloat(item); } },
+		{ "histogram", [](mvSimplePlotConfig& config, PyObject* item) { config.histogram = ToBool(item); } },
+		{ "autosize", [](mvSimplePlotConfig& config, PyObject* item) { config.autosize = ToBool(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -725,10 +729,14 @@ DearPyGui::set_configuration(PyObject* inDict, mvButtonConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "small")) outConfig.small_button = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "arrow")) outConfig.arrow = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "direction")) outConfig.direction = static_cast<ImGuiDir>(ToInt(item));
-	if (PyObject* item = PyDict_GetItemString(inDict, "repeat")) outConfig.repeat = ToBool(item);
+	static const mvKeywordTable<mvButtonConfig> keywords = {
+		{ "small", [](mvButtonConfig& config, PyObject* item) { config.small_button = ToBool(item); } },
+		{ "arrow", [](mvButtonConfig& config, PyObject* item) { config.arrow = ToBool(item); } },
+		{ "direction", [](mvButtonConfig& config, PyObject* item) { config.direction = static_cast<ImGuiDir>(ToInt(item)); } },
+		{ "repeat", [](mvButtonConfig& config, PyObject* item) { config.repeat = ToBool(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -737,25 +745,26 @@ DearPyGui::set_configuration(PyObject* inDict, mvComboConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "items")) outConfig.items = ToStringVect(item);
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "height_mode"))
-	{
-		long height_mode = (long)ToUUID(item);
-		if (height_mode == (long)mvComboHeightMode::mvComboHeight_Small) outConfig.flags = ImGuiComboFlags_HeightSmall;
-		else if (height_mode == (long)mvComboHeightMode::mvComboHeight_Regular) outConfig.flags = ImGuiComboFlags_HeightRegular;
-		else if (height_mode == (long)mvComboHeightMode::mvComboHeight_Large) outConfig.flags = ImGuiComboFlags_HeightLarge;
-		else outConfig.flags = ImGuiComboFlags_HeightLargest;
-	}
+	using Keywords = mvKeywordTable<mvComboConfig>;
+	static const Keywords keywords = {
+		{ "items", [](mvComboConfig& config, PyObject* item) { config.items = ToStringVect(item); } },
 
-	// helpers for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{ if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;};
+		{ "height_mode", [](mvComboConfig& config, PyObject* item)
+			{
+				long height_mode = (long)ToUUID(item);
+				if (height_mode == (long)mvComboHeightMode::mvComboHeight_Small) config.flags = ImGuiComboFlags_HeightSmall;
+				else if (height_mode == (long)mvComboHeightMode::mvComboHeight_Regular) config.flags = ImGuiComboFlags_HeightRegular;
+				else if (height_mode == (long)mvComboHeightMode::mvComboHeight_Large) config.flags = ImGuiComboFlags_HeightLarge;
+				else config.flags = ImGuiComboFlags_HeightLargest;
+			} },
+
+		{ "popup_align_left", Keywords::flag(&mvComboConfig::flags, ImGuiComboFlags_PopupAlignLeft) },
+		{ "no_arrow_button", Keywords::flag(&mvComboConfig::flags, ImGuiComboFlags_NoArrowButton) },
+		{ "no_preview", Keywords::flag(&mvComboConfig::flags, ImGuiComboFlags_NoPreview) },
+		{ "fit_width", Keywords::flag(&mvComboConfig::flags, ImGuiComboFlags_WidthFitPreview) },
+	};
 
-	flagop("popup_align_left", ImGuiComboFlags_PopupAlignLeft, outConfig.flags);
-	flagop("no_arrow_button", ImGuiComboFlags_NoArrowButton, outConfig.flags);
-	flagop("no_preview", ImGuiComboFlags_NoPreview, outConfig.flags);
-	flagop("fit_width", ImGuiComboFlags_WidthFitPreview, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -764,20 +773,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragFloatConfig& outConfig, mvA
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "speed")) outConfig.speed = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToFloat(item);
+	using Keywords = mvKeywordTable<mvDragFloatConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvDragFloatConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "speed", [](mvDragFloatConfig& config, PyObject* item) { config.speed = ToFloat(item); } },
+		{ "min_value", [](mvDragFloatConfig& config, PyObject* item) { config.minv = ToFloat(item); } },
+		{ "max_value", [](mvDragFloatConfig& config, PyObject* item) { config.maxv = ToFloat(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvDragFloatConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvDragFloatConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -786,20 +794,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragDoubleConfig& outConfig, mv
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "speed")) outConfig.speed = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToDouble(item);
+	using Keywords = mvKeywordTable<mvDragDoubleConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvDragDoubleConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "speed", [](mvDragDoubleConfig& config, PyObject* item) { config.speed = ToFloat(item); } },
+		{ "min_value", [](mvDragDoubleConfig& config, PyObject* item) { config.minv = ToDouble(item); } },
+		{ "max_value", [](mvDragDoubleConfig& config, PyObject* item) { config.maxv = ToDouble(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvDragDoubleConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvDragDoubleConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -808,20 +815,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragIntConfig& outConfig, mvApp
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "speed")) outConfig.speed = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToInt(item);
+	using Keywords = mvKeywordTable<mvDragIntConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvDragIntConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "speed", [](mvDragIntConfig& config, PyObject* item) { config.speed = ToFloat(item); } },
+		{ "min_value", [](mvDragIntConfig& config, PyObject* item) { config.minv = ToInt(item); } },
+		{ "max_value", [](mvDragIntConfig& config, PyObject* item) { config.maxv = ToInt(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvDragIntConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvDragIntConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -830,21 +836,20 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragIntMultiConfig& outConfig,
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "speed")) outConfig.speed = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "size")) outConfig.size = ToInt(item);
+	using Keywords = mvKeywordTable<mvDragIntMultiConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvDragIntMultiConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "speed", [](mvDragIntMultiConfig& config, PyObject* item) { config.speed = ToFloat(item); } },
+		{ "min_value", [](mvDragIntMultiConfig& config, PyObject* item) { config.minv = ToInt(item); } },
+		{ "max_value", [](mvDragIntMultiConfig& config, PyObject* item) { config.maxv = ToInt(item); } },
+		{ "size", [](mvDragIntMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvDragIntMultiConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvDragIntMultiConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -853,21 +858,20 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragFloatMultiConfig& outConfig
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "speed")) outConfig.speed = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "size")) outConfig.size = ToInt(item);
+	using Keywords = mvKeywordTable<mvDragFloatMultiConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvDragFloatMultiConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "speed", [](mvDragFloatMultiConfig& config, PyObject* item) { config.speed = ToFloat(item); } },
+		{ "min_value", [](mvDragFloatMultiConfig& config, PyObject* item) { config.minv = ToFloat(item); } },
+		{ "max_value", [](mvDragFloatMultiConfig& config, PyObject* item) { config.maxv = ToFloat(item); } },
+		{ "size", [](mvDragFloatMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvDragFloatMultiConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvDragFloatMultiConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -876,21 +880,20 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragDoubleMultiConfig& outConfi
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "speed")) outConfig.speed = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "size")) outConfig.size = ToInt(item);
+	using Keywords = mvKeywordTable<mvDragDoubleMultiConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvDragDoubleMultiConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "speed", [](mvDragDoubleMultiConfig& config, PyObject* item) { config.speed = ToFloat(item); } },
+		{ "min_value", [](mvDragDoubleMultiConfig& config, PyObject* item) { config.minv = ToDouble(item); } },
+		{ "max_value", [](mvDragDoubleMultiConfig& config, PyObject* item) { config.maxv = ToDouble(item); } },
+		{ "size", [](mvDragDoubleMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvDragDoubleMultiConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvDragDoubleMultiConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -899,20 +902,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvSliderIntConfig& outConfig, mvA
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "vertical")) outConfig.vertical = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToInt(item);
+	using Keywords = mvKeywordTable<mvSliderIntConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvSliderIntConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "vertical", [](mvSliderIntConfig& config, PyObject* item) { config.vertical = ToBool(item); } },
+		{ "min_value", [](mvSliderIntConfig& config, PyObject* item) { config.minv = ToInt(item); } },
+		{ "max_value", [](mvSliderIntConfig& config, PyObject* item) { config.maxv = ToInt(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvSliderIntConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvSliderIntConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -921,20 +923,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvSliderIntMultiConfig& outConfig
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format"))    outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "size"))      outConfig.size = ToInt(item);
+	using Keywords = mvKeywordTable<mvSliderIntMultiConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvSliderIntMultiConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "min_value", [](mvSliderIntMultiConfig& config, PyObject* item) { config.minv = ToInt(item); } },
+		{ "max_value", [](mvSliderIntMultiConfig& config, PyObject* item) { config.maxv = ToInt(item); } },
+		{ "size", [](mvSliderIntMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvSliderIntMultiConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvSliderIntMultiConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -943,20 +944,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvSliderFloatConfig& outConfig, m
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "vertical")) outConfig.vertical = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToFloat(item);
+	using Keywords = mvKeywordTable<mvSliderFloatConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvSliderFloatConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "vertical", [](mvSliderFloatConfig& config, PyObject* item) { config.vertical = ToBool(item); } },
+		{ "min_value", [](mvSliderFloatConfig& config, PyObject* item) { config.minv = ToFloat(item); } },
+		{ "max_value", [](mvSliderFloatConfig& config, PyObject* item) { config.maxv = ToFloat(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvSliderFloatConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvSliderFloatConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -966,20 +966,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvSliderFloatMultiConfig& outConf
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format"))    outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "size"))      outConfig.size = ToInt(item);
+	using Keywords = mvKeywordTable<mvSliderFloatMultiConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvSliderFloatMultiConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "min_value", [](mvSliderFloatMultiConfig& config, PyObject* item) { config.minv = ToFloat(item); } },
+		{ "max_value", [](mvSliderFloatMultiConfig& config, PyObject* item) { config.maxv = ToFloat(item); } },
+		{ "size", [](mvSliderFloatMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvSliderFloatMultiConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvSliderFloatMultiConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -988,20 +987,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvSliderDoubleConfig& outConfig,
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "vertical")) outConfig.vertical = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToDouble(item);
+	using Keywords = mvKeywordTable<mvSliderDoubleConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvSliderDoubleConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "vertical", [](mvSliderDoubleConfig& config, PyObject* item) { config.vertical = ToBool(item); } },
+		{ "min_value", [](mvSliderDoubleConfig& config, PyObject* item) { config.minv = ToDouble(item); } },
+		{ "max_value", [](mvSliderDoubleConfig& config, PyObject* item) { config.maxv = ToDouble(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvSliderDoubleConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvSliderDoubleConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1011,20 +1009,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvSliderDoubleMultiConfig& outCon
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format"))    outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "size"))      outConfig.size = ToInt(item);
+	using Keywords = mvKeywordTable<mvSliderDoubleMultiConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvSliderDoubleMultiConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "min_value", [](mvSliderDoubleMultiConfig& config, PyObject* item) { config.minv = ToDouble(item); } },
+		{ "max_value", [](mvSliderDoubleMultiConfig& config, PyObject* item) { config.maxv = ToDouble(item); } },
+		{ "size", [](mvSliderDoubleMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "clamped", Keywords::flag(&mvSliderDoubleMultiConfig::flags, ImGuiSliderFlags_AlwaysClamp) },
+		{ "no_input", Keywords::flag(&mvSliderDoubleMultiConfig::flags, ImGuiSliderFlags_NoInput) },
 	};
 
-	// flags
-	flagop("clamped", ImGuiSliderFlags_AlwaysClamp, outConfig.flags);
-	flagop("no_input", ImGuiSliderFlags_NoInput, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1033,48 +1030,52 @@ DearPyGui::set_configuration(PyObject* inDict, mvListboxConfig& outConfig, mvApp
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "num_items")) outConfig.itemsHeight = ToInt(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "items"))
-    {
-        outConfig.names = ToStringVect(item);
-        outConfig.charNames.clear();
-        for (const std::string& name : outConfig.names)
-            outConfig.charNames.emplace_back(name.c_str());
+    static const mvKeywordTable<mvListboxConfig> keywords = {
+        { "num_items", [](mvListboxConfig& config, PyObject* item) { config.itemsHeight = ToInt(item); } },
+        { "items", [](mvListboxConfig& config, PyObject* item)
+            {
+                config.names = ToStringVect(item);
+                config.charNames.clear();
+                for (const std::string& name : config.names)
+                    config.charNames.emplace_back(name.c_str());
 
-        outConfig.index = 0;
-        outConfig.disabledindex = 0;
+                config.index = 0;
+                config.disabledindex = 0;
 
-        int index = 0;
-        for (const auto& name : outConfig.names)
-        {
-            if (name == *outConfig.value)
-            {
-                outConfig.index = index;
-                outConfig.disabledindex = index;
-                break;
-            }
-            index++;
-        }
+                int index = 0;
+                for (const auto& name : config.names)
+                {
+                    if (name == *config.value)
+                    {
+                        config.index = index;
+                        config.disabledindex = index;
+                        break;
+                    }
+                    index++;
+                }
 
-		if (!outConfig.value->empty())
-		{
-			if (!outConfig.names.empty())
-			{
-				bool oldValueFound = false;
-				for (int i = 0; i < outConfig.names.size(); i++)
-				{
-					if (outConfig.names[i] == *outConfig.value)
-					{
-						oldValueFound = true;
-						break;
-					}
-				}
+                if (!config.value->empty())
+                {
+                    if (!config.names.empty())
+                    {
+                        bool oldValueFound = false;
+                        for (int i = 0; i < config.names.size(); i++)
+                        {
+                            if (config.names[i] == *config.value)
+                            {
+                                oldValueFound = true;
+                                break;
+                            }
+                        }
+
+                        if(!oldValueFound)
+                            *config.value = config.names[0];
+                    }
+                }
+            } },
+    };
 
-				if(!oldValueFound)
-					*outConfig.value = outConfig.names[0];
-			}
-		}
-    }
+    keywords.apply(inDict, outConfig);
 
     if(outConfig.value->empty())
     {
@@ -1089,28 +1090,32 @@ DearPyGui::set_configuration(PyObject* inDict, mvRadioButtonConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "items"))
-	{
-		outConfig.itemnames = ToStringVect(item);
+	static const mvKeywordTable<mvRadioButtonConfig> keywords = {
+		{ "items", [](mvRadioButtonConfig& config, PyObject* item)
+			{
+				config.itemnames = ToStringVect(item);
 
-		// update index
-		outConfig.index = 0;
-		outConfig.disabledindex = 0;
+				// update index
+				config.index = 0;
+				config.disabledindex = 0;
 
-		int index = 0;
-		for (const auto& name : outConfig.itemnames)
-		{
-			if (name == *outConfig.value)
-			{
-				outConfig.index = index;
-				outConfig.disabledindex = index;
-				break;
-			}
-			index++;
-		}
+				int index = 0;
+				for (const auto& name : config.itemnames)
+				{
+					if (name == *config.value)
+					{
+						config.index = index;
+						config.disabledindex = index;
+						break;
+					}
+					index++;
+				}
 
-	}
-	if (PyObject* item = PyDict_GetItemString(inDict, "horizontal")) outConfig.horizontal = ToBool(item);
+			} },
+		{ "horizontal", [](mvRadioButtonConfig& config, PyObject* item) { config.horizontal = ToBool(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1119,33 +1124,32 @@ DearPyGui::set_configuration(PyObject* inDict, mvInputTextConfig& outConfig, mvA
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "hint")) outConfig.hint = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "multiline")) outConfig.multiline = ToBool(item);
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mvInputTextConfig>;
+	static const Keywords keywords = {
+		{ "hint", [](mvInputTextConfig& config, PyObject* item) { config.hint = ToString(item); } },
+		{ "multiline", [](mvInputTextConfig& config, PyObject* item) { config.multiline = ToBool(item); } },
+
+		// flags
+		{ "no_spaces", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_CharsNoBlank) },
+		{ "uppercase", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_CharsUppercase) },
+		{ "decimal", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_CharsDecimal) },
+		{ "hexadecimal", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_CharsHexadecimal) },
+		{ "readonly", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_ReadOnly) },
+		{ "password", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_Password) },
+		{ "on_enter", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_EnterReturnsTrue) },
+		{ "scientific", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_CharsScientific) },
+		{ "tab_input", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_AllowTabInput) },
+
+		{ "auto_select_all", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_AutoSelectAll) },
+		{ "ctrl_enter_for_new_line", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_CtrlEnterForNewLine) },
+		{ "no_horizontal_scroll", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_NoHorizontalScroll) },
+		{ "always_overwrite", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_AlwaysOverwrite) },
+		{ "no_undo_redo", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_NoUndoRedo) },
+		{ "escape_clears_all", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_EscapeClearsAll) },
+		{ "elide_left", Keywords::flag(&mvInputTextConfig::flags, ImGuiInputTextFlags_ElideLeft) },
 	};
 
-	// flags
-	flagop("no_spaces", ImGuiInputTextFlags_CharsNoBlank, outConfig.flags);
-	flagop("uppercase", ImGuiInputTextFlags_CharsUppercase, outConfig.flags);
-	flagop("decimal", ImGuiInputTextFlags_CharsDecimal, outConfig.flags);
-	flagop("hexadecimal", ImGuiInputTextFlags_CharsHexadecimal, outConfig.flags);
-	flagop("readonly", ImGuiInputTextFlags_ReadOnly, outConfig.flags);
-	flagop("password", ImGuiInputTextFlags_Password, outConfig.flags);
-	flagop("on_enter", ImGuiInputTextFlags_EnterReturnsTrue, outConfig.flags);
-	flagop("scientific", ImGuiInputTextFlags_CharsScientific, outConfig.flags);
-	flagop("tab_input", ImGuiInputTextFlags_AllowTabInput, outConfig.flags);
-
-	flagop("auto_select_all", ImGuiInputTextFlags_AutoSelectAll, outConfig.flags);
-	flagop("ctrl_enter_for_new_line", ImGuiInputTextFlags_CtrlEnterForNewLine, outConfig.flags);
-	flagop("no_horizontal_scroll", ImGuiInputTextFlags_NoHorizontalScroll, outConfig.flags);
-	flagop("always_overwrite", ImGuiInputTextFlags_AlwaysOverwrite, outConfig.flags);
-	flagop("no_undo_redo", ImGuiInputTextFlags_NoUndoRedo, outConfig.flags);
-	flagop("escape_clears_all", ImGuiInputTextFlags_EscapeClearsAll, outConfig.flags);
-	flagop("elide_left", ImGuiInputTextFlags_ElideLeft, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1154,34 +1158,33 @@ DearPyGui::set_configuration(PyObject* inDict, mvInputIntConfig& outConfig, mvAp
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "step")) outConfig.step = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "step_fast")) outConfig.step_fast = ToInt(item);
+	using Keywords = mvKeywordTable<mvInputIntConfig>;
+	static const Keywords keywords = {
+		{ "step", [](mvInputIntConfig& config, PyObject* item) { config.step = ToInt(item); } },
+		{ "step_fast", [](mvInputIntConfig& config, PyObject* item) { config.step_fast = ToInt(item); } },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value"))
-	{
-		outConfig.minv = ToInt(item);
-		outConfig.min_clamped = true;
-	}
+		{ "min_value", [](mvInputIntConfig& config, PyObject* item)
+			{
+				config.minv = ToInt(item);
+				config.min_clamped = true;
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value"))
-	{
-		outConfig.maxv = ToInt(item);
-		outConfig.max_clamped = true;
-	}
+		{ "max_value", [](mvInputIntConfig& config, PyObject* item)
+			{
+				config.maxv = ToInt(item);
+				config.max_clamped = true;
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_clamped")) outConfig.min_clamped = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_clamped")) outConfig.max_clamped = ToBool(item);
+		{ "min_clamped", [](mvInputIntConfig& config, PyObject* item) { config.min_clamped = ToBool(item); } },
+		{ "max_clamped", [](mvInputIntConfig& config, PyObject* item) { config.max_clamped = ToBool(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		{ "on_enter", Keywords::flag(&mvInputIntConfig::flags, ImGuiInputTextFlags_EnterReturnsTrue) },
+		{ "readonly", Keywords::flag(&mvInputIntConfig::flags, ImGuiInputTextFlags_ReadOnly) },
+		{ "accept_empty_input", Keywords::flag(&mvInputIntConfig::flags, ImGuiInputTextFlags_ParseEmptyRefVal) },
+		{ "display_empty_value", Keywords::flag(&mvInputIntConfig::flags, ImGuiInputTextFlags_DisplayEmptyRefVal) },
 	};
 
-	flagop("on_enter", ImGuiInputTextFlags_EnterReturnsTrue, outConfig.flags);
-	flagop("readonly", ImGuiInputTextFlags_ReadOnly, outConfig.flags);
-	flagop("accept_empty_input", ImGuiInputTextFlags_ParseEmptyRefVal, outConfig.flags);
-	flagop("display_empty_value", ImGuiInputTextFlags_DisplayEmptyRefVal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1190,38 +1193,35 @@ DearPyGui::set_configuration(PyObject* inDict, mvInputFloatConfig& outConfig, mv
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "step")) outConfig.step = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "step_fast")) outConfig.step_fast = ToFloat(item);
+	using Keywords = mvKeywordTable<mvInputFloatConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvInputFloatConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "step", [](mvInputFloatConfig& config, PyObject* item) { config.step = ToFloat(item); } },
+		{ "step_fast", [](mvInputFloatConfig& config, PyObject* item) { config.step_fast = ToFloat(item); } },
 
+		{ "min_value", [](mvInputFloatConfig& config, PyObject* item)
+			{
+				config.minv = ToFloat(item);
+				config.min_clamped = true;
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value"))
-	{
-		outConfig.minv = ToFloat(item);
-		outConfig.min_clamped = true;
-	}
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value"))
-	{
-		outConfig.maxv = ToFloat(item);
-		outConfig.max_clamped = true;
-	}
-
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_clamped")) outConfig.min_clamped = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_clamped")) outConfig.max_clamped = ToBool(item);
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		{ "max_value", [](mvInputFloatConfig& config, PyObject* item)
+			{
+				config.maxv = ToFloat(item);
+				config.max_clamped = true;
+			} },
+
+		{ "min_clamped", [](mvInputFloatConfig& config, PyObject* item) { config.min_clamped = ToBool(item); } },
+		{ "max_clamped", [](mvInputFloatConfig& config, PyObject* item) { config.max_clamped = ToBool(item); } },
+
+		// flags
+		{ "on_enter", Keywords::flag(&mvInputFloatConfig::flags, ImGuiInputTextFlags_EnterReturnsTrue) },
+		{ "readonly", Keywords::flag(&mvInputFloatConfig::flags, ImGuiInputTextFlags_ReadOnly) },
+		{ "accept_empty_input", Keywords::flag(&mvInputFloatConfig::flags, ImGuiInputTextFlags_ParseEmptyRefVal) },
+		{ "display_empty_value", Keywords::flag(&mvInputFloatConfig::flags, ImGuiInputTextFlags_DisplayEmptyRefVal) },
 	};
 
-	// flags
-	flagop("on_enter", ImGuiInputTextFlags_EnterReturnsTrue, outConfig.flags);
-	flagop("readonly", ImGuiInputTextFlags_ReadOnly, outConfig.flags);
-	flagop("accept_empty_input", ImGuiInputTextFlags_ParseEmptyRefVal, outConfig.flags);
-	flagop("display_empty_value", ImGuiInputTextFlags_DisplayEmptyRefVal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1230,38 +1230,35 @@ DearPyGui::set_configuration(PyObject* inDict, mvInputDoubleConfig& outConfig, m
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "step")) outConfig.step = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "step_fast")) outConfig.step_fast = ToDouble(item);
-
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value"))
-	{
-		outConfig.minv = ToDouble(item);
-		outConfig.min_clamped = true;
-	}
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value"))
-	{
-		outConfig.maxv = ToDouble(item);
-		outConfig.max_clamped = true;
-	}
+	using Keywords = mvKeywordTable<mvInputDoubleConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvInputDoubleConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "step", [](mvInputDoubleConfig& config, PyObject* item) { config.step = ToDouble(item); } },
+		{ "step_fast", [](mvInputDoubleConfig& config, PyObject* item) { config.step_fast = ToDouble(item); } },
 
+		{ "min_value", [](mvInputDoubleConfig& config, PyObject* item)
+			{
+				config.minv = ToDouble(item);
+				config.min_clamped = true;
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_clamped")) outConfig.min_clamped = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_clamped")) outConfig.max_clamped = ToBool(item);
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		{ "max_value", [](mvInputDoubleConfig& config, PyObject* item)
+			{
+				config.maxv = ToDouble(item);
+				config.max_clamped = true;
+			} },
+
+		{ "min_clamped", [](mvInputDoubleConfig& config, PyObject* item) { config.min_clamped = ToBool(item); } },
+		{ "max_clamped", [](mvInputDoubleConfig& config, PyObject* item) { config.max_clamped = ToBool(item); } },
+
+		// flags
+		{ "on_enter", Keywords::flag(&mvInputDoubleConfig::flags, ImGuiInputTextFlags_EnterReturnsTrue) },
+		{ "readonly", Keywords::flag(&mvInputDoubleConfig::flags, ImGuiInputTextFlags_ReadOnly) },
+		{ "accept_empty_input", Keywords::flag(&mvInputDoubleConfig::flags, ImGuiInputTextFlags_ParseEmptyRefVal) },
+		{ "display_empty_value", Keywords::flag(&mvInputDoubleConfig::flags, ImGuiInputTextFlags_DisplayEmptyRefVal) },
 	};
 
-	// flags
-	flagop("on_enter", ImGuiInputTextFlags_EnterReturnsTrue, outConfig.flags);
-	flagop("readonly", ImGuiInputTextFlags_ReadOnly, outConfig.flags);
-	flagop("accept_empty_input", ImGuiInputTextFlags_ParseEmptyRefVal, outConfig.flags);
-	flagop("display_empty_value", ImGuiInputTextFlags_DisplayEmptyRefVal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1270,35 +1267,34 @@ DearPyGui::set_configuration(PyObject* inDict, mvInputFloatMultiConfig& outConfi
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "size")) outConfig.size = ToInt(item);
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value"))
-	{
-		outConfig.minv = ToFloat(item);
-		outConfig.min_clamped = true;
-	}
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value"))
-	{
-		outConfig.maxv = ToFloat(item);
-		outConfig.max_clamped = true;
-	}
+	using Keywords = mvKeywordTable<mvInputFloatMultiConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvInputFloatMultiConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "size", [](mvInputFloatMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_clamped")) outConfig.min_clamped = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_clamped")) outConfig.max_clamped = ToBool(item);
+		{ "min_value", [](mvInputFloatMultiConfig& config, PyObject* item)
+			{
+				config.minv = ToFloat(item);
+				config.min_clamped = true;
+			} },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		{ "max_value", [](mvInputFloatMultiConfig& config, PyObject* item)
+			{
+				config.maxv = ToFloat(item);
+				config.max_clamped = true;
+			} },
+
+		{ "min_clamped", [](mvInputFloatMultiConfig& config, PyObject* item) { config.min_clamped = ToBool(item); } },
+		{ "max_clamped", [](mvInputFloatMultiConfig& config, PyObject* item) { config.max_clamped = ToBool(item); } },
+
+		// flags
+		{ "on_enter", Keywords::flag(&mvInputFloatMultiConfig::flags, ImGuiInputTextFlags_EnterReturnsTrue) },
+		{ "readonly", Keywords::flag(&mvInputFloatMultiConfig::flags, ImGuiInputTextFlags_ReadOnly) },
+		{ "accept_empty_input", Keywords::flag(&mvInputFloatMultiConfig::flags, ImGuiInputTextFlags_ParseEmptyRefVal) },
+		{ "display_empty_value", Keywords::flag(&mvInputFloatMultiConfig::flags, ImGuiInputTextFlags_DisplayEmptyRefVal) },
 	};
 
-	// flags
-	flagop("on_enter", ImGuiInputTextFlags_EnterReturnsTrue, outConfig.flags);
-	flagop("readonly", ImGuiInputTextFlags_ReadOnly, outConfig.flags);
-	flagop("accept_empty_input", ImGuiInputTextFlags_ParseEmptyRefVal, outConfig.flags);
-	flagop("display_empty_value", ImGuiInputTextFlags_DisplayEmptyRefVal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1307,35 +1303,34 @@ DearPyGui::set_configuration(PyObject* inDict, mvInputDoubleMultiConfig& outConf
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "size")) outConfig.size = ToInt(item);
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value"))
-	{
-		outConfig.minv = ToDouble(item);
-		outConfig.min_clamped = true;
-	}
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value"))
-	{
-		outConfig.maxv = ToDouble(item);
-		outConfig.max_clamped = true;
-	}
+	using Keywords = mvKeywordTable<mvInputDoubleMultiConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvInputDoubleMultiConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "size", [](mvInputDoubleMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_clamped")) outConfig.min_clamped = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_clamped")) outConfig.max_clamped = ToBool(item);
+		{ "min_value", [](mvInputDoubleMultiConfig& config, PyObject* item)
+			{
+				config.minv = ToDouble(item);
+				config.min_clamped = true;
+			} },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		{ "max_value", [](mvInputDoubleMultiConfig& config, PyObject* item)
+			{
+				config.maxv = ToDouble(item);
+				config.max_clamped = true;
+			} },
+
+		{ "min_clamped", [](mvInputDoubleMultiConfig& config, PyObject* item) { config.min_clamped = ToBool(item); } },
+		{ "max_clamped", [](mvInputDoubleMultiConfig& config, PyObject* item) { config.max_clamped = ToBool(item); } },
+
+		// flags
+		{ "on_enter", Keywords::flag(&mvInputDoubleMultiConfig::flags, ImGuiInputTextFlags_EnterReturnsTrue) },
+		{ "readonly", Keywords::flag(&mvInputDoubleMultiConfig::flags, ImGuiInputTextFlags_ReadOnly) },
+		{ "accept_empty_input", Keywords::flag(&mvInputDoubleMultiConfig::flags, ImGuiInputTextFlags_ParseEmptyRefVal) },
+		{ "display_empty_value", Keywords::flag(&mvInputDoubleMultiConfig::flags, ImGuiInputTextFlags_DisplayEmptyRefVal) },
 	};
 
-	// flags
-	flagop("on_enter", ImGuiInputTextFlags_EnterReturnsTrue, outConfig.flags);
-	flagop("readonly", ImGuiInputTextFlags_ReadOnly, outConfig.flags);
-	flagop("accept_empty_input", ImGuiInputTextFlags_ParseEmptyRefVal, outConfig.flags);
-	flagop("display_empty_value", ImGuiInputTextFlags_DisplayEmptyRefVal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1344,33 +1339,32 @@ DearPyGui::set_configuration(PyObject* inDict, mvInputIntMultiConfig& outConfig,
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "size")) outConfig.size = ToInt(item);
+	using Keywords = mvKeywordTable<mvInputIntMultiConfig>;
+	static const Keywords keywords = {
+		{ "size", [](mvInputIntMultiConfig& config, PyObject* item) { config.size = ToInt(item); } },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value"))
-	{
-		outConfig.minv = ToInt(item);
-		outConfig.min_clamped = true;
-	}
+		{ "min_value", [](mvInputIntMultiConfig& config, PyObject* item)
+			{
+				config.minv = ToInt(item);
+				config.min_clamped = true;
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value"))
-	{
-		outConfig.maxv = ToInt(item);
-		outConfig.max_clamped = true;
-	}
+		{ "max_value", [](mvInputIntMultiConfig& config, PyObject* item)
+			{
+				config.maxv = ToInt(item);
+				config.max_clamped = true;
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_clamped")) outConfig.min_clamped = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_clamped")) outConfig.max_clamped = ToBool(item);
+		{ "min_clamped", [](mvInputIntMultiConfig& config, PyObject* item) { config.min_clamped = ToBool(item); } },
+		{ "max_clamped", [](mvInputIntMultiConfig& config, PyObject* item) { config.max_clamped = ToBool(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		{ "on_enter", Keywords::flag(&mvInputIntMultiConfig::flags, ImGuiInputTextFlags_EnterReturnsTrue) },
+		{ "readonly", Keywords::flag(&mvInputIntMultiConfig::flags, ImGuiInputTextFlags_ReadOnly) },
+		{ "accept_empty_input", Keywords::flag(&mvInputIntMultiConfig::flags, ImGuiInputTextFlags_ParseEmptyRefVal) },
+		{ "display_empty_value", Keywords::flag(&mvInputIntMultiConfig::flags, ImGuiInputTextFlags_DisplayEmptyRefVal) },
 	};
 
-	flagop("on_enter", ImGuiInputTextFlags_EnterReturnsTrue, outConfig.flags);
-	flagop("readonly", ImGuiInputTextFlags_ReadOnly, outConfig.flags);
-	flagop("accept_empty_input", ImGuiInputTextFlags_ParseEmptyRefVal, outConfig.flags);
-	flagop("display_empty_value", ImGuiInputTextFlags_DisplayEmptyRefVal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1379,10 +1373,14 @@ DearPyGui::set_configuration(PyObject* inDict, mvTextConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "color")) outConfig.color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "wrap")) outConfig.wrap = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "bullet")) outConfig.bullet = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "show_label")) outConfig.show_label = ToBool(item);
+	static const mvKeywordTable<mvTextConfig> keywords = {
+		{ "color", [](mvTextConfig& config, PyObject* item) { config.color = ToColor(item); } },
+		{ "wrap", [](mvTextConfig& config, PyObject* item) { config.wrap = ToInt(item); } },
+		{ "bullet", [](mvTextConfig& config, PyObject* item) { config.bullet = ToBool(item); } },
+		{ "show_label", [](mvTextConfig& config, PyObject* item) { config.show_label = ToBool(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1391,16 +1389,14 @@ DearPyGui::set_configuration(PyObject* inDict, mvSelectableConfig& outConfig, mv
 	if (inDict == nullptr)
 		return;
 
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mvSelectableConfig>;
+	static const Keywords keywords = {
+		{ "span_columns", Keywords::flag(&mvSelectableConfig::flags, ImGuiSelectableFlags_SpanAllColumns) },
+		{ "disable_popup_close", Keywords::flag(&mvSelectableConfig::flags, ImGuiSelectableFlags_NoAutoClosePopups) },
+		{ "select_on_nav", Keywords::flag(&mvSelectableConfig::flags, ImGuiSelectableFlags_SelectOnNav) },
 	};
 
-	flagop("span_columns", ImGuiSelectableFlags_SpanAllColumns, outConfig.flags);
-	flagop("disable_popup_close", ImGuiSelectableFlags_NoAutoClosePopups, outConfig.flags);
-	flagop("select_on_nav", ImGuiSelectableFlags_SelectOnNav, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 
 	if (info.enabledLastFrame)
 	{
@@ -1421,18 +1417,16 @@ DearPyGui::set_configuration(PyObject* inDict, mvTabButtonConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mvTabButtonConfig>;
+	static const Keywords keywords = {
+		{ "no_reorder", Keywords::flag(&mvTabButtonConfig::flags, ImGuiTabItemFlags_NoReorder) },
+		{ "leading", Keywords::flag(&mvTabButtonConfig::flags, ImGuiTabItemFlags_Leading) },
+		{ "trailing", Keywords::flag(&mvTabButtonConfig::flags, ImGuiTabItemFlags_Trailing) },
+		{ "no_tooltip", Keywords::flag(&mvTabButtonConfig::flags, ImGuiTabItemFlags_NoTooltip) },
+		{ "unsaved_document", Keywords::flag(&mvTabButtonConfig::flags, ImGuiTabItemFlags_UnsavedDocument) },
 	};
 
-	flagop("no_reorder", ImGuiTabItemFlags_NoReorder, outConfig.flags);
-	flagop("leading", ImGuiTabItemFlags_Leading, outConfig.flags);
-	flagop("trailing", ImGuiTabItemFlags_Trailing, outConfig.flags);
-	flagop("no_tooltip", ImGuiTabItemFlags_NoTooltip, outConfig.flags);
-	flagop("unsaved_document", ImGuiTabItemFlags_UnsavedDocument, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 
 	if (outConfig.flags & ImGuiTabItemFlags_Leading && outConfig.flags & ImGuiTabItemFlags_Trailing)
 		outConfig.flags &= ~ImGuiTabItemFlags_Leading;
@@ -1444,8 +1438,12 @@ DearPyGui::set_configuration(PyObject* inDict, mvMenuItemConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "shortcut")) outConfig.shortcut = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "check")) outConfig.check = ToBool(item);
+	static const mvKeywordTable<mvMenuItemConfig> keywords = {
+		{ "shortcut", [](mvMenuItemConfig& config, PyObject* item) { config.shortcut = ToString(item); } },
+		{ "check", [](mvMenuItemConfig& config, PyObject* item) { config.check = ToBool(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1454,7 +1452,11 @@ DearPyGui::set_configuration(PyObject* inDict, mvProgressBarConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "overlay")) outConfig.overlay = ToString(item);
+	static const mvKeywordTable<mvProgressBarConfig> keywords = {
+		{ "overlay", [](mvProgressBarConfig& config, PyObject* item) { config.overlay = ToString(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1463,24 +1465,28 @@ DearPyGui::set_configuration(PyObject* inDict, mvImageConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "uv_min")) outConfig.uv_min = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "uv_max")) outConfig.uv_max = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "tint_color")) outConfig.tintColor = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "border_color")) outConfig.borderColor = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "texture_tag"))
-	{
-		mvUUID textureUUID = GetIDFromPyObject(item);
-		if (textureUUID == MV_ATLAS_UUID)
-		{
-			outConfig.texture = std::make_shared<mvStaticTexture>(textureUUID);
-		}
-		else
-		{
-			outConfig.texture = GetRefItem(*GContext->itemRegistry, textureUUID);
-			if (!outConfig.texture)
-				mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(mvAppItemType::mvImage), "Texture not found.", nullptr);
-		}
-	}
+	static const mvKeywordTable<mvImageConfig> keywords = {
+		{ "uv_min", [](mvImageConfig& config, PyObject* item) { config.uv_min = ToVec2(item); } },
+		{ "uv_max", [](mvImageConfig& config, PyObject* item) { config.uv_max = ToVec2(item); } },
+		{ "tint_color", [](mvImageConfig& config, PyObject* item) { config.tintColor = ToColor(item); } },
+		{ "border_color", [](mvImageConfig& config, PyObject* item) { config.borderColor = ToColor(item); } },
+		{ "texture_tag", [](mvImageConfig& config, PyObject* item)
+			{
+				mvUUID textureUUID = GetIDFromPyObject(item);
+				if (textureUUID == MV_ATLAS_UUID)
+				{
+					config.texture = std::make_shared<mvStaticTexture>(textureUUID);
+				}
+				else
+				{
+					config.texture = GetRefItem(*GContext->itemRegistry, textureUUID);
+					if (!config.texture)
+						mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(mvAppItemType::mvImage), "Texture not found.", nullptr);
+				}
+			} },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1489,31 +1495,35 @@ DearPyGui::set_configuration(PyObject* inDict, mvImageButtonConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "uv_min")) outConfig.uv_min = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "uv_max")) outConfig.uv_max = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "tint_color")) outConfig.tintColor = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "background_color")) outConfig.backgroundColor = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "frame_padding")) outConfig.framePadding = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "texture_tag"))
-	{
-		mvUUID textureUUID = GetIDFromPyObject(item);
-		if (textureUUID == MV_ATLAS_UUID)
-		{
-			outConfig.texture = std::make_shared<mvStaticTexture>(textureUUID);
-		}
-		else
-		{
-			outConfig.texture = GetRefItem(*GContext->itemRegistry, textureUUID);
-			if (!outConfig.texture)
-				mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(mvAppItemType::mvImageButton), "Texture not found.", nullptr);
-		}
-	}
+	static const mvKeywordTable<mvImageButtonConfig> keywords = {
+		{ "uv_min", [](mvImageButtonConfig& config, PyObject* item) { config.uv_min = ToVec2(item); } },
+		{ "uv_max", [](mvImageButtonConfig& config, PyObject* item) { config.uv_max = ToVec2(item); } },
+		{ "tint_color", [](mvImageButtonConfig& config, PyObject* item) { config.tintColor = ToColor(item); } },
+		{ "background_color", [](mvImageButtonConfig& config, PyObject* item) { config.backgroundColor = ToColor(item); } },
+		{ "frame_padding", [](mvImageButtonConfig& config, PyObject* item) { config.framePadding = ToInt(item); } },
+		{ "texture_tag", [](mvImageButtonConfig& config, PyObject* item)
+			{
+				mvUUID textureUUID = GetIDFromPyObject(item);
+				if (textureUUID == MV_ATLAS_UUID)
+				{
+					config.texture = std::make_shared<mvStaticTexture>(textureUUID);
+				}
+				else
+				{
+					config.texture = GetRefItem(*GContext->itemRegistry, textureUUID);
+					if (!config.texture)
+						mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(mvAppItemType::mvImageButton), "Texture not found.", nullptr);
+				}
+			} },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvTooltipConfig& outConfig, mvAppItemConfig& config)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvTooltip)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvTooltip), inDict))
 		return;
 
 	config.parent = GetIDFromPyObject(PyTuple_GetItem(inDict, 0));
@@ -1525,8 +1535,12 @@ DearPyGui::set_configuration(PyObject* inDict, mvTooltipConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "delay")) outConfig.activation_delay = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "hide_on_activity")) outConfig.hide_on_move = ToBool(item);
+	static const mvKeywordTable<mvTooltipConfig> keywords = {
+		{ "delay", [](mvTooltipConfig& config, PyObject* item) { config.activation_delay = ToFloat(item); } },
+		{ "hide_on_activity", [](mvTooltipConfig& config, PyObject* item) { config.hide_on_move = ToBool(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1535,8 +1549,12 @@ DearPyGui::set_configuration(PyObject* inDict, mvKnobFloatConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_value")) outConfig.minv = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_value")) outConfig.maxv = ToFloat(item);
+	static const mvKeywordTable<mvKnobFloatConfig> keywords = {
+		{ "min_value", [](mvKnobFloatConfig& config, PyObject* item) { config.minv = ToFloat(item); } },
+		{ "max_value", [](mvKnobFloatConfig& config, PyObject* item) { config.maxv = ToFloat(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 //-----------------------------------------------------------------------------
@@ -1546,7 +1564,7 @@ DearPyGui::set_configuration(PyObject* inDict, mvKnobFloatConfig& outConfig)
 void
 DearPyGui::set_required_configuration(PyObject* inDict, mvImageConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvImage)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvImage), inDict))
 		return;
 
 	mvUUID textureUUID = GetIDFromPyObject(PyTuple_GetItem(inDict, 0));
@@ -1565,7 +1583,7 @@ DearPyGui::set_required_configuration(PyObject* inDict, mvImageConfig& outConfig
 void
 DearPyGui::set_required_configuration(PyObject* inDict, mvImageButtonConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvImageButton)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvImageButton), inDict))
 		return;
 
 	mvUUID textureUUID = GetIDFromPyObject(PyTuple_GetItem(inDict, 0));
@@ -1588,7 +1606,7 @@ DearPyGui::set_required_configuration(PyObject* inDict, mvImageButtonConfig& out
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvComboConfig& outConfig)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvCombo)], inDict))
+	if (!VerifyPositionalArguments(GetItemParser(mvAppItemType::mvCombo), inDict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(inDict); i++)
@@ -1609,7 +1627,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvComboConfig& outConf
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvListboxConfig& outConfig)
 {
-    if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvListbox)], inDict))
+    if (!VerifyPositionalArguments(GetItemParser(mvAppItemType::mvListbox), inDict))
         return;
     for (int i = 0; i < PyTuple_Size(inDict); i++)
     {
@@ -1630,7 +1648,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvListboxConfig& outCo
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvRadioButtonConfig& outConfig)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvRadioButton)], inDict))
+	if (!VerifyPositionalArguments(GetItemParser(mvAppItemType::mvRadioButton), inDict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(inDict); i++)
@@ -1651,7 +1669,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvRadioButtonConfig& o
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvTextConfig& outConfig)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvText)], inDict))
+	if (!VerifyPositionalArguments(GetItemParser(mvAppItemType::mvText), inDict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(inDict); i++)
@@ -4020,7 +4038,8 @@ DearPyGui::draw_listbox(ImDrawList *drawlist, mvAppItem &item, mvListboxConfig &
             }
 
             item.handleDelayedScroll();
-            item.config.scrollXFlags = item.config.scrollYFlags = mvSetScrollFlags_None;
+            if (item.config.coldConfig)
+                item.config.coldConfig->scrollXFlags = item.config.coldConfig->scrollYFlags = mvSetScrollFlags_None;
             UpdateAppItemScrollInfo(item.state);
 
             ImGui::EndListBox();
@@ -5942,7 +5961,9 @@ DearPyGui::draw_tooltip(ImDrawList* drawlist, mvAppItem& item)
 		// Note: state_changed and the following condition are not mutually
 		// exclusive and *may* both be true in the same frame - in particular,
 		// when activation_delay is zero.
-		if (GContext->time - tooltip->change_time >= tooltip->configData.activation_delay)
+		if (GContext->time - tooltip->change_time < tooltip->configData.activation_delay)
+			mvRequestRedraw();  // wait_for_input: the tooltip must appear without further input
+		else
 		{
 			if (item.font)
 				static_cast<mvFont*>(item.font.get())->pushFont();
@@ -5996,7 +6017,7 @@ mvDragIntMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<int, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<int, 4>>(temp_array);
 }
 
 void
@@ -6011,7 +6032,7 @@ mvDragFloatMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<float, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void
@@ -6026,7 +6047,7 @@ mvDragDoubleMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<double, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<double, 4>>(temp_array);
 }
 
 void
@@ -6041,7 +6062,7 @@ mvSliderFloatMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<float, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void
@@ -6056,7 +6077,7 @@ mvSliderDoubleMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<double, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<double, 4>>(temp_array);
 }
 
 void
@@ -6071,7 +6092,7 @@ mvSliderIntMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<int, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<int, 4>>(temp_array);
 }
 
 void
@@ -6129,7 +6150,7 @@ mvInputIntMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<int, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<int, 4>>(temp_array);
 }
 
 void
@@ -6144,7 +6165,7 @@ mvInputFloatMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<float, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void
@@ -6159,7 +6180,7 @@ mvInputDoubleMulti::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<double, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<double, 4>>(temp_array);
 }
 
 void
@@ -6184,7 +6205,7 @@ mvFilterSet::setPyValue(PyObject* value)
 void
 mvSimplePlot::setPyValue(PyObject* value)
 {
-	*configData.value = ToFloatVect(value);
+	ToFloatVect(value, *configData.value);
 
 	if (!configData.autosize)
 		return;
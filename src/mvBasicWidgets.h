@@ -206,7 +206,7 @@ enum class mvComboHeightMode
 
 struct mvSimplePlotConfig
 {
-    std::shared_ptr<std::vector<float>> value = std::make_shared<std::vector<float>>(std::vector<float>{0.0f});
+    std::shared_ptr<std::vector<float>> value = mvAllocateShared<std::vector<float>>(std::vector<float>{0.0f});
     std::string               overlay;
     float                     scaleMin = 0.0f;
     float                     scaleMax = 0.0f;
@@ -229,13 +229,13 @@ struct mvComboConfig
     bool                     popup_align_left = false;
     bool                     no_preview = false;
     bool                     fit_width = false;
-    std::shared_ptr<std::string>       value = std::make_shared<std::string>("");
+    std::shared_ptr<std::string>       value = mvAllocateShared<std::string>("");
     std::string              disabled_value;
 };
 
 struct mvCheckboxConfig
 {
-    std::shared_ptr<bool> value = std::make_shared<bool>(false);
+    std::shared_ptr<bool> value = mvAllocateShared<bool>(false);
     bool        disabled_value = false;
 };
 
@@ -246,7 +246,7 @@ struct mvDragFloatConfig
     float               maxv = 100.0f;
     std::string         format = "%.3f";
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
-    std::shared_ptr<float>        value = std::make_shared<float>(0.0f);
+    std::shared_ptr<float>        value = mvAllocateShared<float>(0.0f);
     float               disabled_value = 0.0f;
 };
 
@@ -257,7 +257,7 @@ struct mvDragDoubleConfig
     double              maxv = 100.0;
     std::string         format = "%.3f";
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
-    std::shared_ptr<double>       value = std::make_shared<double>(0.0);
+    std::shared_ptr<double>       value = mvAllocateShared<double>(0.0);
     double              disabled_value = 0.0;
 };
 
@@ -268,7 +268,7 @@ struct mvDragIntConfig
     int                 maxv = 100;
     std::string         format = "%d";
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
-    std::shared_ptr<int>          value = std::make_shared<int>(0);
+    std::shared_ptr<int>          value = mvAllocateShared<int>(0);
     int                 disabled_value = 0;
 };
 
@@ -280,7 +280,7 @@ struct mvDragIntMultiConfig
     std::string               format = "%d";
     ImGuiInputTextFlags       flags = ImGuiSliderFlags_None;
     int                       size = 4;
-    std::shared_ptr<std::array<int, 4>> value = std::make_shared<std::array<int, 4>>(std::array<int, 4>{0, 0, 0, 0});
+    std::shared_ptr<std::array<int, 4>> value = mvAllocateShared<std::array<int, 4>>(std::array<int, 4>{0, 0, 0, 0});
     int                       disabled_value[4]{}; 
 };
 
@@ -292,7 +292,7 @@ struct mvDragFloatMultiConfig
     std::string                 format = "%.3f";
     ImGuiInputTextFlags         flags = ImGuiSliderFlags_None;
     int                         size = 4;
-    std::shared_ptr<std::array<float, 4>> value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
+    std::shared_ptr<std::array<float, 4>> value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
     float                       disabled_value[4]{};  
 };
 
@@ -304,7 +304,7 @@ struct mvDragDoubleMultiConfig
     std::string                 format = "%.3f";
     ImGuiInputTextFlags         flags = ImGuiSliderFlags_None;
     int                         size = 4;
-    std::shared_ptr<std::array<double, 4>>value = std::make_shared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
+    std::shared_ptr<std::array<double, 4>>value = mvAllocateShared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
     double                      disabled_value[4]{};
 };
 
@@ -315,7 +315,7 @@ struct mvSliderIntConfig
     std::string         format = "%d";
     bool                vertical = false;
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
-    std::shared_ptr<int>          value = std::make_shared<int>(0);
+    std::shared_ptr<int>          value = mvAllocateShared<int>(0);
     int                 disabled_value = 0;
 };
 
@@ -326,7 +326,7 @@ struct mvSliderFloatConfig
     std::string         format = "%.3f";
     bool                vertical = false;
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
-    std::shared_ptr<float>        value = std::make_shared<float>(0.0f);
+    std::shared_ptr<float>        value = mvAllocateShared<float>(0.0f);
     float               disabled_value = 0.0f;
 };
 
@@ -337,7 +337,7 @@ struct mvSliderDoubleConfig
     std::string          format = "%.3f";
     bool                 vertical = false;
     ImGuiInputTextFlags  flags = ImGuiSliderFlags_None;
-    std::shared_ptr<double>        value = std::make_shared<double>(0.0);
+    std::shared_ptr<double>        value = mvAllocateShared<double>(0.0);
     double               disabled_value = 0.0;
 };
 
@@ -348,7 +348,7 @@ struct mvSliderFloatMultiConfig
     std::string                 format = "%.3f";
     ImGuiInputTextFlags         flags = ImGuiSliderFlags_None;
     int                         size = 4;
-    std::shared_ptr<std::array<float, 4>> value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
+    std::shared_ptr<std::array<float, 4>> value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
     float                       disabled_value[4]{};
 };
 
@@ -359,7 +359,7 @@ struct mvSliderIntMultiConfig
     std::string               format = "%d";
     ImGuiInputTextFlags       flags = ImGuiSliderFlags_None;
     int                       size = 4;
-    std::shared_ptr<std::array<int, 4>> value = std::make_shared<std::array<int, 4>>(std::array<int, 4>{0, 0, 0, 0});
+    std::shared_ptr<std::array<int, 4>> value = mvAllocateShared<std::array<int, 4>>(std::array<int, 4>{0, 0, 0, 0});
     int                       disabled_value[4]{};
 };
 
@@ -370,7 +370,7 @@ struct mvSliderDoubleMultiConfig
     std::string                  format = "%d";
     ImGuiInputTextFlags          flags = ImGuiSliderFlags_None;
     int                          size = 4;
-    std::shared_ptr<std::array<double, 4>> value = std::make_shared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
+    std::shared_ptr<std::array<double, 4>> value = mvAllocateShared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
     double                       disabled_value[4]{};
 };
 
@@ -381,7 +381,7 @@ struct mvListboxConfig
     std::vector<const char*> charNames;
     int                      index = 0;
     int                      disabledindex = 0;
-    std::shared_ptr<std::string>       value = std::make_shared<std::string>("");
+    std::shared_ptr<std::string>       value = mvAllocateShared<std::string>("");
     std::string              disabled_value;
 };
 
@@ -391,7 +391,7 @@ struct mvRadioButtonConfig
     bool                     horizontal = false;
     int                      index = 0;
     int                      disabledindex = 0;
-    std::shared_ptr<std::string>       value = std::make_shared<std::string>("");
+    std::shared_ptr<std::string>       value = mvAllocateShared<std::string>("");
     std::string              disabled_value = "";
 };
 
@@ -400,7 +400,7 @@ struct mvInputTextConfig
     std::string         hint;
     bool                multiline = false;
     ImGuiInputTextFlags flags = 0;
-    std::shared_ptr<std::string>  value = std::make_shared<std::string>("");
+    std::shared_ptr<std::string>  value = mvAllocateShared<std::string>("");
     std::string         disabled_value = "";
 };
 
@@ -414,7 +414,7 @@ struct mvInputIntConfig
     bool                max_clamped = false;
     ImGuiInputTextFlags flags = 0;
     int                 last_value = 0;
-    std::shared_ptr<int>          value = std::make_shared<int>(0);
+    std::shared_ptr<int>          value = mvAllocateShared<int>(0);
     int                 disabled_value = 0;
 };
 
@@ -429,7 +429,7 @@ struct mvInputFloatConfig
     float               step_fast = 1.0f;
     ImGuiInputTextFlags flags = 0;
     float               last_value = 0.0f;
-    std::shared_ptr<float>        value = std::make_shared<float>(0.0f);
+    std::shared_ptr<float>        value = mvAllocateShared<float>(0.0f);
     float               disabled_value = 0.0f;
 };
 
@@ -444,7 +444,7 @@ struct mvInputDoubleConfig
     double              step_fast = 1.0;
     ImGuiInputTextFlags flags = 0;
     double              last_value = 0.0;
-    std::shared_ptr<double>        value = std::make_shared<double>(0.0);
+    std::shared_ptr<double>        value = mvAllocateShared<double>(0.0);
     double              disabled_value = 0.0;
 };
 
@@ -458,7 +458,7 @@ struct mvInputFloatMultiConfig
     ImGuiInputTextFlags         flags = 0;
     std::array<float, 4>        last_value = { 0.0f, 0.0f, 0.0f, 0.0f };
     int                         size = 4;
-    std::shared_ptr<std::array<float, 4>> value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
+    std::shared_ptr<std::array<float, 4>> value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
     float                       disabled_value[4]{};
 };
 
@@ -471,7 +471,7 @@ struct mvInputIntMultiConfig
     ImGuiInputTextFlags       flags = 0;
     std::array<int, 4>        last_value = { 0, 0, 0, 0 };
     int                       size = 4;
-    std::shared_ptr<std::array<int, 4>> value = std::make_shared<std::array<int, 4>>(std::array<int, 4>{0, 0, 0, 0});
+    std::shared_ptr<std::array<int, 4>> value = mvAllocateShared<std::array<int, 4>>(std::array<int, 4>{0, 0, 0, 0});
     int                       disabled_value[4]{};
 };
 
@@ -485,7 +485,7 @@ struct mvInputDoubleMultiConfig
     ImGuiInputTextFlags          flags = 0;
     std::array<double, 4>        last_value = { 0.0f, 0.0f, 0.0f, 0.0f };
     int                          size = 4;
-    std::shared_ptr<std::array<double, 4>> value = std::make_shared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
+    std::shared_ptr<std::array<double, 4>> value = mvAllocateShared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
     double                       disabled_value[4]{};
 };
 
@@ -495,14 +495,14 @@ struct mvTextConfig
     int                wrap = -1;
     bool               bullet = false;
     bool               show_label = false;
-    std::shared_ptr<std::string> value = std::make_shared<std::string>("");
+    std::shared_ptr<std::string> value = mvAllocateShared<std::string>("");
     std::string        disabled_value = "";
 };
 
 struct mvSelectableConfig
 {
     ImGuiSelectableFlags flags = ImGuiSelectableFlags_None;
-    std::shared_ptr<bool>          value = std::make_shared<bool>(false);
+    std::shared_ptr<bool>          value = mvAllocateShared<bool>(false);
     bool                 disabled_value = false;
 };
 
@@ -515,14 +515,14 @@ struct mvMenuItemConfig
 {
     std::string shortcut;
     bool        check = false;
-    std::shared_ptr<bool> value = std::make_shared<bool>(false);
+    std::shared_ptr<bool> value = mvAllocateShared<bool>(false);
     bool        disabled_value = false;
 };
 
 struct mvProgressBarConfig
 {
     std::string  overlay;
-    std::shared_ptr<float> value = std::make_shared<float>(0.0f);
+    std::shared_ptr<float> value = mvAllocateShared<float>(0.0f);
     float        disabled_value = 0.0f;
 };
 
@@ -560,7 +560,7 @@ struct mvTooltipConfig
 
 struct mvKnobFloatConfig
 {
-    std::shared_ptr<float> value = std::make_shared<float>(0.0f);
+    std::shared_ptr<float> value = mvAllocateShared<float>(0.0f);
     float        disabled_value = 0.0f;
     float        minv = 0.0f;
     float        maxv = 100.0f;
@@ -582,6 +582,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryView(configData.value->data(), (int)configData.value->size()); }
     void setPyValue(PyObject* value) override;
 };
 
@@ -850,6 +851,7 @@ public:
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override{ return ToPyInt(*configData.value); }
     void setPyValue(PyObject* value) override{ *configData.value = ToInt(value); configData.last_value = *configData.value;}
+    bool setScalarValue(double value) override { *configData.value = (int)value; configData.last_value = *configData.value; return true; }
 };
 
 class mvInputIntMulti : public mvAppItem
@@ -878,6 +880,7 @@ public:
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyFloat(*configData.value); }
     void setPyValue(PyObject* value) override { *configData.value = ToFloat(value); configData.last_value = *configData.value; }
+    bool setScalarValue(double value) override { *configData.value = (float)value; configData.last_value = *configData.value; return true; }
 };
 
 class mvInputFloatMulti : public mvAppItem
@@ -906,6 +909,7 @@ public:
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyDouble(*configData.value); }
     void setPyValue(PyObject* value) override { *configData.value = ToDouble(value); configData.last_value = *configData.value; }
+    bool setScalarValue(double value) override { *configData.value = value; configData.last_value = *configData.value; return true; }
 };
 
 class mvInputDoubleMulti : public mvAppItem
@@ -5,6 +5,11 @@
 
 #include "mvContext.h"
 #include "mvItemRegistry.h"
+#include "mvAppItem.h"
+
+#if PY_VERSION_HEX < 0x03090000
+#define PyObject_Vectorcall _PyObject_Vectorcall
+#endif
 
 void mvRunTasks(bool early /* = false */)
 {
@@ -32,7 +37,7 @@ void mvFrameCallback(i32 frame)
 	// `mvPyObject` has no default constructor, whereas `operator[]` can insert
 	// a new value into the map and therefore requires a default constructor.
 
-	auto callback = std::make_shared<mvPyObject>(std::move(callbackRegistry->frameCallbacks.at(frame)));
+	auto callback = std::make_shared<mvPyCallback>(std::move(callbackRegistry->frameCallbacks.at(frame)));
 	auto user_data = std::make_shared<mvPyObject>(std::move(callbackRegistry->frameCallbacksUserData.at(frame)));
 
 	// Since mvPyObject objects remaining in the maps are now "empty", it's safe to
@@ -43,27 +48,132 @@ void mvFrameCallback(i32 frame)
 	mvAddOwnerlessCallback(callback, user_data, (mvUUID)frame, "", []() -> PyObject* { return nullptr; });
 }
 
+void mvRunTimers()
+{
+	auto& registry = *GContext->callbackRegistry;
+	auto& heap = registry.timerHeap;
+	if (heap.empty())
+		return;
+
+	auto now = std::chrono::steady_clock::now();
+	while (!heap.empty() && heap.front().due <= now)
+	{
+		std::pop_heap(heap.begin(), heap.end());
+		mvTimerDue next = heap.back();
+		heap.pop_back();
+
+		auto found = registry.timers.find(next.id);
+		if (found == registry.timers.end())
+			continue;   // deleted
+
+		mvTimer& timer = found->second;
+		mvAddOwnerlessCallback(timer.callback, timer.user_data, (mvUUID)next.id, "", []() -> PyObject* { return nullptr; });
+
+		if (!timer.repeat)
+		{
+			registry.timers.erase(found);
+			continue;
+		}
+
+		// If we've fallen behind (e.g. a long frame), don't fire the missed
+		// intervals in a burst.
+		next.due += timer.interval;
+		if (next.due <= now)
+			next.due = now + timer.interval;
+		heap.push_back(next);
+		std::push_heap(heap.begin(), heap.end());
+	}
+}
+
+double mvTimeToNextTimer()
+{
+	std::lock_guard lk(GContext->mutex);
+	auto& heap = GContext->callbackRegistry->timerHeap;
+	if (heap.empty())
+		return -1.0;
+
+	std::chrono::duration<double> remaining = heap.front().due - std::chrono::steady_clock::now();
+	return std::max(remaining.count(), 0.0);
+}
+
+// Runs the calls forwarded by mvRunCallbacks until it receives an empty one.
+static void RunCallbackWorker(mvQueue<mvQueuedCall>& queue)
+{
+	mvGlobalIntepreterLock gil;
+
+	auto& registry = *GContext->callbackRegistry;
+	while (true)
+	{
+		mvQueuedCall t;
+		Py_BEGIN_ALLOW_THREADS;
+		queue.wait_and_pop(t);
+		Py_END_ALLOW_THREADS;
+
+		if (!t.call)
+			break;
+
+		t.call();
+		registry.callCount--;
+	}
+}
+
 bool mvRunCallbacks()
 {
-	GContext->callbackRegistry->running = true;
+	auto& registry = *GContext->callbackRegistry;
+	registry.running = true;
 
 	mvGlobalIntepreterLock gil;
 
-	while (GContext->callbackRegistry->running)
+	// With callback workers, this thread only dispatches: each sender is pinned
+	// to one worker, so its callbacks stay sequential while callbacks from
+	// different senders run concurrently (on free-threaded Python, that is;
+	// otherwise they take turns holding the GIL).
+	std::vector<std::unique_ptr<mvQueue<mvQueuedCall>>> queues;
+	std::vector<std::thread> workers;
+	for (i32 i = 0; i < registry.callbackWorkers; i++)
+	{
+		queues.push_back(std::make_unique<mvQueue<mvQueuedCall>>(mvCallbackRegistry::callQueueSize));
+		workers.emplace_back(RunCallbackWorker, std::ref(*queues.back()));
+	}
+
+	while (registry.running)
 	{
-		mvFunctionWrapper t2;
+		mvQueuedCall t2;
 		Py_BEGIN_ALLOW_THREADS;
-		GContext->callbackRegistry->calls.wait_and_pop(t2);
+		registry.calls.wait_and_pop(t2);
 		Py_END_ALLOW_THREADS;
-		t2();
-		GContext->callbackRegistry->callCount--;
+
+		// DropOldest: newer calls were let in past the limit; skip as many old ones
+		if (!t2.essential && registry.staleCalls > 0)
+		{
+			registry.staleCalls--;
+			registry.droppedCalls++;
+		}
+		else if (!queues.empty() && !t2.control)
+		{
+			// The worker decrements callCount once the call is done.
+			queues[t2.sender % queues.size()]->push(std::move(t2));
+			continue;
+		}
+		else
+			t2.call();
+
+		registry.callCount--;
 	}
 
+	// Workers finish everything queued before the shutdown call, then exit.
+	for (auto& queue : queues)
+		queue->push({});
+	Py_BEGIN_ALLOW_THREADS;
+	for (auto& worker : workers)
+		worker.join();
+	Py_END_ALLOW_THREADS;
+
 	return true;
 }
 
 void mvAddCallback(const std::weak_ptr<void>& owner,
-                   PyObject* callback,
+                   const mvPyCallback& callback,
                    const std::shared_ptr<mvPyObject>& user_data,
                    mvUUID sender,
                    const std::string& alias)
@@ -71,7 +181,7 @@ void mvAddCallback(const std::weak_ptr<void>& owner,
     mvAddCallback(owner, callback, user_data, sender, alias, []() -> PyObject* { return nullptr; });
 }
 
-void mvAddOwnerlessCallback(const std::shared_ptr<mvPyObject>& callback,
+void mvAddOwnerlessCallback(const std::shared_ptr<mvPyCallback>& callback,
                             const std::shared_ptr<mvPyObject>& user_data,
                             mvUUID sender,
                             const std::string& alias)
@@ -79,26 +189,101 @@ void mvAddOwnerlessCallback(const std::shared_ptr<mvPyObject>& callback,
 	mvAddOwnerlessCallback(callback, user_data, sender, alias, []() -> PyObject* { return nullptr; });
 }
 
-void mvRunOwnedCallback(const std::weak_ptr<void>& owner, PyObject* callback, PyObject* user_data, mvUUID sender /* = 0 */, const std::string& sender_alias /* = "" */, PyObject* app_data /* = nullptr */)
+// Returns whatever the callback returned, or nullptr if it failed (the error
+// is printed).
+static mvPyObject RunCallback(PyObject* callback, i32 argCount, PyObject* user_data, mvUUID sender, const std::string& sender_alias, PyObject* app_data)
+{
+
+	if (callback == nullptr)
+		return nullptr;
+
+	//PyErr_Clear();
+	if (PyErr_Occurred())
+		PyErr_Print();
+
+	// arity unknown: pass everything we have
+	if (argCount < 0)
+		argCount = 3;
+
+	if (app_data == nullptr)
+		app_data = Py_None;
+	if (user_data == nullptr)
+		user_data = Py_None;
+
+	mvPyObject pySender(argCount > 0 ? ToPyUUID(sender, sender_alias) : nullptr);
+
+	// Slot 0 is scratch space for the vectorcall protocol (PY_VECTORCALL_ARGUMENTS_OFFSET
+	// lets bound methods prepend `self` there instead of copying the arguments).
+	// If the callback takes more parms than 3, just pass None in there.
+	constexpr i32 maxStackArgs = 8;
+	PyObject* stackArgs[maxStackArgs + 1];
+	std::vector<PyObject*> heapArgs;
+	PyObject** argv = stackArgs;
+	if (argCount > maxStackArgs)
+	{
+		heapArgs.resize(argCount + 1);
+		argv = heapArgs.data();
+	}
+
+	PyObject* params[] = { pySender, app_data, user_data };
+	for (i32 i = 0; i < argCount; i++)
+		argv[i + 1] = i < 3 ? params[i] : Py_None;
+
+	// perform the actual call
+	mvPyObject result(PyObject_Vectorcall(callback, argv + 1, (size_t)argCount | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr));
+
+	// check if call succeeded
+	if (!result.isOk())
+		PyErr_Print();
+
+	return result;
+}
+
+std::shared_ptr<void> mvLockCallbackOwner(const std::weak_ptr<void>& owner)
 {
 	auto liveOwner = owner.lock();
-	if (liveOwner)
+	// Owners of callback jobs are always the items that submitted them.
+	if (liveOwner && static_cast<mvAppItem*>(liveOwner.get())->info.retired)
+		return nullptr;
+	return liveOwner;
+}
+
+static mvPyObject RunOwnedCallback(const std::weak_ptr<void>& owner, const mvPyCallback* callback, PyObject* user_data, mvUUID sender, const std::string& sender_alias, PyObject* app_data)
+{
+	auto liveOwner = owner.lock();
+	if (!liveOwner)
+		return nullptr;
+
+	// Make our own callback ref
+	mvPyObject ownCallback(*callback, true);
+	i32 argCount = callback->argCount();
+	b8 retired;
 	{
-		// Make our own callback ref
-		mvPyObject ownCallback(callback, true);
-		{
-			// We need to lock the mutex while releasing the `owner` pointer.  When `liveOwner`
-			// goes out of scope, the mvAppItem that it holds might get deleted, thus
-			// invalidating all mvAppItem* pointers that we might be holding in various DPG functions
-			// e.g. in another thread.  By locking the mutex and explicitly resetting
-			// `liveOwner`, we guarantee that destruction of mvAppItem only occurs with
-			// the mutex locked, and thus cannot happen in the middle of an API function
-			// that also locks the mutex.
-			mvPySafeLockGuard lk(GContext->mutex);
-			liveOwner.reset();
-		}
-		mvRunCallback(ownCallback, user_data, sender, sender_alias, app_data);
+		// We need to lock the mutex while releasing the `owner` pointer.  When `liveOwner`
+		// goes out of scope, the mvAppItem that it holds might get deleted, thus
+		// invalidating all mvAppItem* pointers that we might be holding in various DPG functions
+		// e.g. in another thread.  By locking the mutex and explicitly resetting
+		// `liveOwner`, we guarantee that destruction of mvAppItem only occurs with
+		// the mutex locked, and thus cannot happen in the middle of an API function
+		// that also locks the mutex.
+		mvPySafeLockGuard lk(GContext->mutex);
+		// A deleted item may live on for a few frames; its callbacks are dropped all the same.
+		retired = static_cast<mvAppItem*>(liveOwner.get())->info.retired;
+		liveOwner.reset();
 	}
+	if (retired)
+		return nullptr;
+	return RunCallback(ownCallback, argCount, user_data, sender, sender_alias, app_data);
+}
+
+void mvRunOwnedCallback(const std::weak_ptr<void>& owner, const mvPyCallback* callback, PyObject* user_data, mvUUID sender /* = 0 */, const std::string& sender_alias /* = "" */, PyObject* app_data /* = nullptr */)
+{
+	RunOwnedCallback(owner, callback, user_data, sender, sender_alias, app_data);
+}
+
+void mvRunCallback(const mvPyCallback& callback, PyObject* user_data, mvUUID sender, const std::string& sender_alias, PyObject* app_data)
+{
+	RunCallback(callback, callback.argCount(), user_data, sender, sender_alias, app_data);
 }
 
 void mvRunCallback(PyObject* callback, PyObject* user_data, mvUUID sender, const std::string& sender_alias, PyObject* app_data)
@@ -114,60 +299,132 @@ void mvRunCallback(PyObject* callback, PyObject* user_data, mvUUID sender, const
 		return;
 	}
 
-	//PyErr_Clear();
-	if (PyErr_Occurred())
-		PyErr_Print();
+	RunCallback(callback, GetCallableArgCount(callback), user_data, sender, sender_alias, app_data);
+}
 
-	PyObject* fc = PyObject_GetAttrString(callback, "__code__");
-	if (fc) {
-		PyObject* ac = PyObject_GetAttrString(fc, "co_argcount");
-		if (ac) {
-			i32 count = PyLong_AsLong(ac);
+// Same as inspect.isawaitable(): coroutines, generator-based coroutines and
+// anything with __await__ (futures, tasks, custom awaitables).
+static bool IsAwaitable(PyObject* obj)
+{
+	if (PyCoro_CheckExact(obj))
+		return true;
 
-			if (PyMethod_Check(callback))
-				count--;
+	PyAsyncMethods* async = Py_TYPE(obj)->tp_as_async;
+	if (async && async->am_await)
+		return true;
 
-			mvPyObject pArgs(count > 0 ? PyTuple_New(count) : nullptr);
+	if (!PyGen_Check(obj))
+		return false;
 
-			if (count > 0)
-			{
-				PyTuple_SetItem(pArgs, 0, ToPyUUID(sender, sender_alias));
-
-				if (count > 1)
-				{
-					if (app_data == nullptr)
-						app_data = Py_None;
-					// Need an owned ref here: PyTuple_SetItem takes ownership;
-					// this also handles Py_None correctly (need to incref it).
-					Py_INCREF(app_data);
-					PyTuple_SetItem(pArgs, 1, app_data);
-
-					if (count > 2)
-					{
-						if (user_data == nullptr)
-							user_data = Py_None;
-						// Need an owned ref here: PyTuple_SetItem takes ownership;
-						// this also handles Py_None correctly (need to incref it).
-						Py_INCREF(user_data);
-						PyTuple_SetItem(pArgs, 2, user_data);
-
-						// If the callback takes more parms, just pass None in there
-						for (int i = 3; i < count; i++)
-							PyTuple_SetItem(pArgs, i, GetPyNone());
-					}
-				}
-			}
+	// @types.coroutine
+	mvPyObject code(PyObject_GetAttrString(obj, "gi_code"));
+	if (!code.isOk())
+	{
+		PyErr_Clear();
+		return false;
+	}
+	return (((PyCodeObject*)(PyObject*)code)->co_flags & CO_ITERABLE_COROUTINE) != 0;
+}
+
+// Runs on the asyncio loop: takes everything collected in `jobs` so far.
+static PyObject* RunAsyncCallbacks(PyObject* self, PyObject* args)
+{
+	// The context might have been destroyed while this call was scheduled.
+	if (GContext == nullptr)
+		Py_RETURN_NONE;
+
+	auto& registry = *GContext->callbackRegistry;
+	std::vector<mvCallbackJob> jobs;
+	mvPyObject loop(nullptr);
+	mvPyObject tasks(nullptr);
+	mvPyObject ensureFuture(nullptr);
+	{
+		mvPySafeLockGuard lk(GContext->mutex);
+		jobs.swap(registry.jobs);
+		registry.asyncWakeupPending = false;
+		loop = mvPyObject(registry.asyncLoop, true);
+		tasks = mvPyObject(registry.asyncTasks, true);
+	}
 
-			// perform the actual call
-			mvPyObject result(PyObject_CallObject(callback, pArgs));
+	for (const auto& job : jobs)
+	{
+		mvPyObject app_data(job.app_data_func());
+		mvPyObject result = job.ownerless_callback?
+			RunCallback(*job.ownerless_callback, job.ownerless_callback->argCount(), *job.user_data, job.sender, job.alias, app_data) :
+			RunOwnedCallback(job.owner, job.callback, *job.user_data, job.sender, job.alias, app_data);
 
-			// check if call succeeded
-			if (!result.isOk())
-				PyErr_Print();
+		if (!result.isOk() || result == Py_None || !loop.isOk() || !IsAwaitable(result))
+			continue;
 
-			Py_DECREF(ac);
+		// `async def` callback (or one returning an awaitable): let the loop
+		// run it, and keep the task alive until it's done.
+		if (!ensureFuture.isOk())
+		{
+			mvPyObject asyncio(PyImport_ImportModule("asyncio"));
+			ensureFuture = mvPyObject(asyncio.isOk()? PyObject_GetAttrString(asyncio, "ensure_future") : nullptr);
+			if (!ensureFuture.isOk())
+			{
+				PyErr_Print();
+				continue;
+			}
+		}
+		mvPyObject callArgs(PyTuple_Pack(1, (PyObject*)result));
+		mvPyObject callKwargs(Py_BuildValue("{s:O}", "loop", (PyObject*)loop));
+		mvPyObject task(PyObject_Call(ensureFuture, callArgs, callKwargs));
+		if (!task.isOk())
+		{
+			PyErr_Print();
+			continue;
 		}
-		Py_DECREF(fc);
+		PySet_Add(tasks, task);
+		mvPyObject discard(PyObject_GetAttrString(tasks, "discard"));
+		mvPyObject added(PyObject_CallMethod(task, "add_done_callback", "O", (PyObject*)discard));
+		if (!added.isOk())
+			PyErr_Print();
 	}
 
+	Py_RETURN_NONE;
+}
+
+static PyMethodDef RunAsyncCallbacksDef = { "_run_async_callbacks", RunAsyncCallbacks, METH_NOARGS, nullptr };
+
+void mvPostAsyncCallbacks()
+{
+	// One wakeup per batch: whatever comes in before the loop gets to it
+	// will be picked up by the same run.
+	if (GContext->callbackRegistry->asyncWakeupPending.exchange(true))
+		return;
+
+	// call_soon_threadsafe needs the GIL, which the render thread can't
+	// safely take while holding the mutex; the handler thread can.
+	mvSubmitCallback([]() {
+		mvPyObject loop(nullptr);
+		{
+			mvPySafeLockGuard lk(GContext->mutex);
+			loop = mvPyObject(GContext->callbackRegistry->asyncLoop, true);
+		}
+		mvPyObject func(PyCFunction_New(&RunAsyncCallbacksDef, nullptr));
+		mvPyObject handle(loop.isOk()? PyObject_CallMethod(loop, "call_soon_threadsafe", "O", (PyObject*)func) : nullptr);
+		if (!handle.isOk())
+		{
+			// e.g. the loop is closed: nothing would ever run the collected
+			// jobs, so they are dropped instead of piling up. The next
+			// callback tries the loop again.
+			if (PyErr_Occurred())
+				PyErr_Print();
+			std::vector<mvCallbackJob> dropped;
+			{
+				mvPySafeLockGuard lk(GContext->mutex);
+				if (GContext->callbackRegistry->asyncCallbacks)
+					dropped.swap(GContext->callbackRegistry->jobs);
+				GContext->callbackRegistry->asyncWakeupPending = false;
+			}
+			if (!dropped.empty())
+			{
+				mvThrowPythonError(mvErrorCode::mvNone, "Dropped " + std::to_string(dropped.size()) +
+					" callback(s): the callback_loop can't take calls (is it closed?).");
+				PyErr_Print();
+			}
+		}
+	}, true);
 }
@@ -1,248 +1,162 @@
 #pragma once
 
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <new>
+#include <cstddef>
 #include <vector>
+#include <deque>
 #include <unordered_map>
+#include <chrono>
 #include "mvContext.h"
-
-//-----------------------------------------------------------------------------
-// mvFunctionWrapper
-//-----------------------------------------------------------------------------
-
-class mvFunctionWrapper
-{
-    struct impl_base {
-        virtual void call() = 0;
-        virtual ~impl_base() = default;
-    };
-
-    template<typename F>
-    struct impl_type : impl_base
-    {
-        F f;
-        explicit impl_type(F&& f) : f(std::move(f)) {}
-        void call() override { f(); }
-    };
-
-public:
-
-    mvFunctionWrapper() = default;
-
-    template<typename F>
-    mvFunctionWrapper(F&& f) : m_impl(new impl_type<F>(std::move(f))) {}
-
-    mvFunctionWrapper(mvFunctionWrapper&& other) noexcept
-            : m_impl(std::move(other.m_impl))
-    {
-
-    }
-
-    mvFunctionWrapper& operator=(mvFunctionWrapper&& other)
-    {
-        m_impl = std::move(other.m_impl);
-        return *this;
-    }
-
-    // delete copy constructor and assignment operator
-    mvFunctionWrapper(const mvFunctionWrapper&) = delete;
-    mvFunctionWrapper(mvFunctionWrapper&) = delete;
-    mvFunctionWrapper& operator=(const mvFunctionWrapper&) = delete;
-
-    void operator()()
-    {
-        m_impl->call();
-    }
-
-private:
-
-    std::unique_ptr<impl_base> m_impl;
-
-};
-
-//-----------------------------------------------------------------------------
-// mvQueue
-//-----------------------------------------------------------------------------
-template<typename T>
-class mvQueue
-{
-
-public:
-
-    struct node
-    {
-        std::shared_ptr<T>    data;
-        std::unique_ptr<node> next;
-    };
-
-public:
-
-    mvQueue() : m_head(new node), m_tail(m_head.get()) {}
-
-    // copy assignment and constructor deleted
-    mvQueue(const mvQueue& other) = delete;
-    mvQueue& operator=(const mvQueue& other) = delete;
-
-    std::shared_ptr<T> wait_and_pop()
-    {
-        std::unique_ptr<node> const old_head = wait_pop_head();
-        return old_head->data;
-    }
-
-    std::shared_ptr<T> try_pop()
-    {
-        std::unique_ptr<node> const old_head = try_pop_head();
-        return old_head ? old_head->data : std::shared_ptr<T>();
-    }
-
-    void wait_and_pop(T& value)
-    {
-        std::unique_ptr<node> const old_head = wait_pop_head(value);
-    }
-
-    bool try_pop(T& value)
-    {
-        std::unique_ptr<node> const old_head = try_pop_head(value);
-        if (old_head)
-            return true;
-        return false;
-    }
-
-    void push(T value)
-    {
-        std::shared_ptr<T> new_data = std::make_shared<T>(std::move(value));
-        auto p = std::make_unique<node>();
-
-        // scoped in order to unlock tail mutex before notifying other threads
-        {
-            std::lock_guard<std::mutex> tail_lock(m_tail_mutex);
-            m_tail->data = std::move(new_data);
-            node* const new_tail = p.get();
-            m_tail->next = std::move(p);
-            m_tail = new_tail;
-        }
-
-        m_data_cond.notify_one();
-    }
-
-    bool empty()
-    {
-        std::lock_guard<std::mutex> head_lock(m_head_mutex);
-        return (m_head.get() == get_tail());
-    }
-
-private:
-
-    node* get_tail()
-    {
-        std::lock_guard<std::mutex> tail_lock(m_tail_mutex);
-        return m_tail;
-    }
-
-    std::unique_ptr<node> pop_head()
-    {
-        std::unique_ptr<node> old_head = std::move(m_head);
-        m_head = std::move(old_head->next);
-        return old_head;
-    }
-
-    std::unique_ptr<node> try_pop_head()
-    {
-        std::lock_guard<std::mutex> head_lock(m_head_mutex);
-        if (m_head.get() == get_tail())
-            return std::unique_ptr<node>();
-        return pop_head();
-    }
-
-    std::unique_ptr<node> try_pop_head(T& value)
-    {
-        std::lock_guard<std::mutex> head_lock(m_head_mutex);
-        if (m_head.get() == get_tail())
-            return std::unique_ptr<node>();
-
-        value = std::move(*m_head->data);
-        return pop_head();
-    }
-
-    std::unique_ptr<node> wait_pop_head()
-    {
-        std::unique_lock<std::mutex> head_lock(wait_for_data());
-        return pop_head();
-    }
-
-    std::unique_ptr<node> wait_pop_head(T& value)
-    {
-        std::unique_lock<std::mutex> head_lock(wait_for_data());
-        value = std::move(*m_head->data);
-        return pop_head();
-    }
-
-    std::unique_lock<std::mutex> wait_for_data()
-    {
-        std::unique_lock<std::mutex> head_lock(m_head_mutex);
-        m_data_cond.wait(head_lock, [&] {return m_head.get() != get_tail(); });
-        return head_lock;
-    }
-
-private:
-
-    std::mutex              m_head_mutex;
-    std::mutex              m_tail_mutex;
-    std::unique_ptr<node>   m_head;
-    node* m_tail;
-    std::condition_variable m_data_cond;
-
-};
+#include "mvQueue.h"
 
 struct mvCallbackJob
 {
     std::weak_ptr<void> owner;
     // Only valid if `owner` is alive; one must lock() the owner before accessing
     // the callback.
-    PyObject* callback = nullptr;
+    const mvPyCallback* callback = nullptr;
     std::shared_ptr<mvPyObject> user_data;
     mvUUID sender = 0;
     std::string alias;
     std::function<PyObject*()> app_data_func;
     // Either `callback` (and `owner`) or `ownerless_callback` must be set,
     // but not both - otherwise one of them will be ignored.
-    std::shared_ptr<mvPyObject> ownerless_callback = nullptr;
+    std::shared_ptr<mvPyCallback> ownerless_callback = nullptr;
+};
+
+// What mvSubmitCallback does once `maxNumberOfCalls` calls are pending
+// (configure_app(callback_queue_policy=...)).
+enum class mvCallbackQueuePolicy
+{
+	DropNewest = 0, // the new call is discarded
+	DropOldest = 1  // the oldest pending call is skipped by the handler thread
+};
+
+struct mvQueuedCall
+{
+	mvFunctionWrapper call;
+	// Never skipped by DropOldest: calls submitted with `ignore_limit` (e.g.
+	// the shutdown sentinel), and coalesced calls (there's at most one per
+	// callback in the queue, and it owns a pendingCoalesced entry).
+	b8                essential = false;
+	// Submitted with `ignore_limit`: runs on the handler thread itself, never
+	// on a callback worker (see configure_app(callback_workers=...)).
+	b8                control = false;
+	// Calls from the same sender go to the same worker, in order.
+	mvUUID            sender = 0;
+};
+
+// set_timer_callback
+struct mvTimer
+{
+	std::chrono::milliseconds     interval;
+	b8                            repeat = true;
+	std::shared_ptr<mvPyCallback> callback;
+	std::shared_ptr<mvPyObject>   user_data;
+};
+
+struct mvTimerDue
+{
+	std::chrono::steady_clock::time_point due;
+	i32                                   id = 0;
+
+	// for std::push_heap & co. to keep the earliest one at the front
+	bool operator<(const mvTimerDue& other) const { return due > other.due; }
 };
 
 struct mvCallbackRegistry
 {
-    // TODO: ideally, it should be configurable (e.g. via configure_app)
-	const i32 maxNumberOfCalls = 500;
+	// Size of the `calls` ring. The configurable limit is kept below it so
+	// that essential calls and the DropOldest backlog always fit.
+	static constexpr i32 callQueueSize = 4096;
+	static constexpr i32 maxCallQueueCapacity = callQueueSize - 256;
+
+	// configure_app(callback_queue_capacity=..., callback_queue_policy=..., coalesce_callbacks=...)
+	std::atomic<i32>                   maxNumberOfCalls = 500;
+	std::atomic<mvCallbackQueuePolicy> queuePolicy = mvCallbackQueuePolicy::DropNewest;
+	std::atomic<b8>                    coalesceCallbacks = false;
+	// configure_app(callback_workers=...); latched by mvRunCallbacks on startup.
+	// 0 runs all callbacks on the handler thread.
+	std::atomic<i32>                   callbackWorkers = 0;
+	static constexpr i32               maxCallbackWorkers = 64;
+
+	// get_callback_queue_stats()
+	std::atomic<i64>           droppedCalls = 0;
+	std::atomic<i64>           coalescedCalls = 0;
 
 	std::vector<mvCallbackJob> jobs;
+
+	// configure_app(callback_loop=...): callbacks are collected in `jobs` like
+	// with manual callback management, and run on the given asyncio loop.
+	std::atomic<b8>            asyncCallbacks = false;
+	// Set while a drain of `jobs` is scheduled on the loop but hasn't run yet.
+	std::atomic<b8>            asyncWakeupPending = false;
+	mvPyObject                 asyncLoop = nullptr;
+	// Tasks of `async def` callbacks that haven't completed; asyncio only
+	// keeps weak references to them.
+	mvPyObject                 asyncTasks = nullptr;
 	mvQueue<mvFunctionWrapper> tasks;
     // These are like `tasks` but they run very early at the start of the frame,
     // whereas `tasks` can be run mid-frame either before or after Render().
     mvQueue<mvFunctionWrapper> earlyTasks;
-	mvQueue<mvFunctionWrapper> calls;
+	mvQueue<mvQueuedCall>      calls{ callQueueSize };
 	std::atomic<b8>            running = false;
 	std::atomic<i32>           callCount = 0;
+	// DropOldest: how many of the oldest non-essential calls the handler thread should skip
+	std::atomic<i32>           staleCalls = 0;
+
+	// Coalesced calls waiting in `calls`, keyed by the callback they belong to.
+	// A newer event for the same key replaces the pending call instead of
+	// queuing another one.
+	std::mutex                                                           coalesceMutex;
+	std::unordered_map<const void*, std::shared_ptr<mvFunctionWrapper>> pendingCoalesced;
 
 	// callbacks
-	std::shared_ptr<mvPyObject> resizeCallback          = std::make_shared<mvPyObject>(nullptr);
+	std::shared_ptr<mvPyCallback> resizeCallback        = std::make_shared<mvPyCallback>(nullptr);
     std::shared_ptr<mvPyObject> resizeCallbackUserData  = std::make_shared<mvPyObject>(nullptr);
-    std::shared_ptr<mvPyObject> onCloseCallback         = std::make_shared<mvPyObject>(nullptr);
+    std::shared_ptr<mvPyCallback> onCloseCallback       = std::make_shared<mvPyCallback>(nullptr);
     std::shared_ptr<mvPyObject> onCloseCallbackUserData = std::make_shared<mvPyObject>(nullptr);
 
 	i32 highestFrame = 0;
-	std::unordered_map<i32, mvPyObject> frameCallbacks;
+	std::unordered_map<i32, mvPyCallback> frameCallbacks;
 	std::unordered_map<i32, mvPyObject> frameCallbacksUserData;
+
+	// Timers by id, plus a heap of when they're due next.  Deleted timers
+	// are removed from the heap lazily, once they come up.
+	i32 lastTimerId = 0;
+	std::unordered_map<i32, mvTimer> timers;
+	std::vector<mvTimerDue> timerHeap;
 };
 
 void mvFrameCallback(i32 frame);
+// Submits callbacks of the timers that are due.  Called once per frame.
+void mvRunTimers();
+// Seconds until the next timer is due, or a negative value if there are no
+// timers.  Lets the viewport bound its wait for input.
+double mvTimeToNextTimer();
 // Runs either `tasks` or `earlyTasks` from mvCallbackRegistry, depending on the `early` flag.
 void mvRunTasks(bool early = false);
 // All PyObject references here are borrowed references - caller must release them after this call
+void mvRunCallback(const mvPyCallback& callback, PyObject* user_data, mvUUID sender = 0, const std::string& sender_alias = "", PyObject* app_data = nullptr);
+// Same as above for a callable whose arity hasn't been resolved yet; it is looked up on each call.
 void mvRunCallback(PyObject* callback, PyObject* user_data, mvUUID sender = 0, const std::string& sender_alias = "", PyObject* app_data = nullptr);
 // This version checks if owner is still alive (by obtaining shared_ptr), and if it is,
 // INCREFs the callback and releases the owner.  The owner is released under mvContext::mutex.
 // All PyObject references except `callback` are borrowed references - the caller must release
 // them after this call.
-void mvRunOwnedCallback(const std::weak_ptr<void>& owner, PyObject* callback, PyObject* user_data, mvUUID sender = 0, const std::string& sender_alias = "", PyObject* app_data = nullptr);
+void mvRunOwnedCallback(const std::weak_ptr<void>& owner, const mvPyCallback* callback, PyObject* user_data, mvUUID sender = 0, const std::string& sender_alias = "", PyObject* app_data = nullptr);
+// Obtains the owner of a callback job, or nullptr if it's gone.  Owners that have
+// been deleted but are still being destroyed (retired items) count as gone.
+// Must be called with mvContext::mutex locked.
+std::shared_ptr<void> mvLockCallbackOwner(const std::weak_ptr<void>& owner);
+
+// Schedules one run of the pending `jobs` on the asyncio loop set via
+// configure_app(callback_loop=...), unless one is already scheduled.
+// Callbacks that return a coroutine are turned into tasks on that loop.
+void mvPostAsyncCallbacks();
 
 // Note: We pass the `callback` and its `user_data` as two separate arguments (rather
 // than a single object) because, even though they only make sense together, `mvAppItem` may
@@ -256,22 +170,27 @@ void mvRunOwnedCallback(const std::weak_ptr<void>& owner, PyObject* callback, Py
 // If the `owner` is already lost by the moment the callback is fetched from the
 // queue, the callback will be silently ignored.  This effectively cleans the queue
 // from irrelevant callbacks - lingering there after `mvAppItem` deletion and such.
+// With `coalesce`, a call still waiting in the queue for the same callback is
+// replaced by this one (if coalescing is enabled via configure_app).
 template<typename AppDataFunc>
 void mvAddCallback(const std::weak_ptr<void>& owner,
-                   PyObject* callback,
+                   const mvPyCallback& callback,
                    const std::shared_ptr<mvPyObject>& user_data,
                    mvUUID sender,
                    const std::string& alias,
-                   AppDataFunc&& app_data_func)
+                   AppDataFunc&& app_data_func,
+                   bool coalesce = false)
 {
-	if (GContext->IO.manualCallbacks)
+	if (GContext->IO.manualCallbacks || GContext->callbackRegistry->asyncCallbacks)
 	{
-		GContext->callbackRegistry->jobs.push_back({owner, callback, user_data, sender, alias, std::forward<AppDataFunc>(app_data_func)});
+		GContext->callbackRegistry->jobs.push_back({owner, &callback, user_data, sender, alias, std::forward<AppDataFunc>(app_data_func)});
+		if (GContext->callbackRegistry->asyncCallbacks)
+			mvPostAsyncCallbacks();
 		return;
 	}
-	mvSubmitCallback([=, app_data_func = std::forward<AppDataFunc>(app_data_func)] () {
+	mvSubmitCallback([=, callback = &callback, app_data_func = std::forward<AppDataFunc>(app_data_func)] () {
         mvRunOwnedCallback(owner, callback, *user_data, sender, alias, mvPyObject(app_data_func()));
-    });
+    }, false, coalesce? &callback : nullptr, sender);
 }
 
 // This overload exists purely to provide default argument values - we can't do this
@@ -279,33 +198,36 @@ void mvAddCallback(const std::weak_ptr<void>& owner,
 // `app_data_func` type if `app_data_func` is omitted (that is, we can't really use
 // the default on `app_data_func`).
 void mvAddCallback(const std::weak_ptr<void>& owner,
-                   PyObject* callback,
+                   const mvPyCallback& callback,
                    const std::shared_ptr<mvPyObject>& user_data,
                    mvUUID sender = 0,
                    const std::string& alias = "");
 
 template<typename AppDataFunc>
-void mvAddOwnerlessCallback(const std::shared_ptr<mvPyObject>& callback,
+void mvAddOwnerlessCallback(const std::shared_ptr<mvPyCallback>& callback,
                             const std::shared_ptr<mvPyObject>& user_data,
                             mvUUID sender,
                             const std::string& alias,
-                            AppDataFunc&& app_data_func)
+                            AppDataFunc&& app_data_func,
+                            bool coalesce = false)
 {
-	if (GContext->IO.manualCallbacks)
+	if (GContext->IO.manualCallbacks || GContext->callbackRegistry->asyncCallbacks)
 	{
 		GContext->callbackRegistry->jobs.push_back({{}, nullptr, user_data, sender, alias, std::forward<AppDataFunc>(app_data_func), callback});
+		if (GContext->callbackRegistry->asyncCallbacks)
+			mvPostAsyncCallbacks();
 		return;
 	}
 	mvSubmitCallback([=, app_data_func = std::forward<AppDataFunc>(app_data_func)]() {
 		mvRunCallback(*callback, *user_data, sender, alias, mvPyObject(app_data_func()));
-    });
+    }, false, coalesce? callback.get() : nullptr, sender);
 }
 
 // This overload exists purely to provide default argument values - we can't do this
 // directly on the template version above because the compiler won't be able to deduce
 // `app_data_func` type if `app_data_func` is omitted (that is, we can't really use
 // the default on `app_data_func`).
-void mvAddOwnerlessCallback(const std::shared_ptr<mvPyObject>& callback,
+void mvAddOwnerlessCallback(const std::shared_ptr<mvPyCallback>& callback,
                             const std::shared_ptr<mvPyObject>& user_data,
                             mvUUID sender = 0,
                             const std::string& alias = "");
@@ -324,6 +246,7 @@ std::future<typename std::invoke_result<F, Args...>::type> mvSubmitTask(F f, boo
     {
         auto& tasks = runEarlyInFrame? GContext->callbackRegistry->earlyTasks : GContext->callbackRegistry->tasks;
         tasks.push(std::move(task));
+        mvRequestRedraw();
     }
 	else
 		task();
@@ -332,22 +255,68 @@ std::future<typename std::invoke_result<F, Args...>::type> mvSubmitTask(F f, boo
 }
 
 template<typename F, typename ...Args>
-std::future<typename std::invoke_result<F, Args...>::type> mvSubmitCallback(F f, bool ignore_limit = false)
+std::future<typename std::invoke_result<F, Args...>::type> mvSubmitCallback(F f, bool ignore_limit = false, const void* coalesce_key = nullptr, mvUUID sender = 0)
 {
+	auto& registry = *GContext->callbackRegistry;
 
-	if (GContext->callbackRegistry->callCount > GContext->callbackRegistry->maxNumberOfCalls && !ignore_limit)
+	typedef typename std::invoke_result<F, Args...>::type result_type;
+	std::packaged_task<result_type()> task(std::move(f));
+	std::future<result_type> res(task.get_future());
+
+	std::shared_ptr<mvFunctionWrapper> coalesced;
+	if (coalesce_key && registry.coalesceCallbacks && !ignore_limit)
 	{
-        assert(false);
-		return {};
+		std::lock_guard<std::mutex> lk(registry.coalesceMutex);
+		auto found = registry.pendingCoalesced.find(coalesce_key);
+		if (found != registry.pendingCoalesced.end())
+		{
+			// The queued entry will run this task instead of the one it was queued with.
+			*found->second = mvFunctionWrapper(std::move(task));
+			registry.coalescedCalls++;
+			return {};
+		}
+
+		coalesced = std::make_shared<mvFunctionWrapper>(std::move(task));
+		registry.pendingCoalesced[coalesce_key] = coalesced;
 	}
 
-	GContext->callbackRegistry->callCount++;
+	if (registry.callCount >= registry.maxNumberOfCalls && !ignore_limit)
+	{
+		// DropOldest still needs room in the ring for the backlog
+		if (registry.queuePolicy == mvCallbackQueuePolicy::DropOldest
+			&& registry.callCount < mvCallbackRegistry::maxCallQueueCapacity + 128)
+		{
+			if (!coalesced)
+				registry.staleCalls++;
+		}
+		else
+		{
+			if (coalesced)
+			{
+				std::lock_guard<std::mutex> lk(registry.coalesceMutex);
+				registry.pendingCoalesced.erase(coalesce_key);
+			}
+			registry.droppedCalls++;
+			return {};
+		}
+	}
 
-	typedef typename std::invoke_result<F, Args...>::type result_type;
-	std::packaged_task<result_type()> task(std::move(f));
-	std::future<result_type> res(task.get_future());
+	registry.callCount++;
 
-	GContext->callbackRegistry->calls.push(std::move(task));
+	if (coalesced)
+	{
+		registry.calls.push({ [coalesced, coalesce_key]() {
+			mvFunctionWrapper call;
+			{
+				std::lock_guard<std::mutex> lk(GContext->callbackRegistry->coalesceMutex);
+				call = std::move(*coalesced);
+				GContext->callbackRegistry->pendingCoalesced.erase(coalesce_key);
+			}
+			call();
+		}, true, false, sender });
+	}
+	else
+		registry.calls.push({ mvFunctionWrapper(std::move(task)), ignore_limit, ignore_limit, sender });
 
 	return res;
 }
\ No newline at end of file
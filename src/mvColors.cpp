@@ -572,7 +572,7 @@ DearPyGui::draw_color_map_registry(ImDrawList* drawlist, mvAppItem& item)
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvColorButtonConfig& outConfig)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvColorButton)], inDict))
+	if (!VerifyPositionalArguments(GetItemParser(mvAppItemType::mvColorButton), inDict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(inDict); i++)
@@ -591,7 +591,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvColorButtonConfig& o
 			if (outConfig.value)
 				*outConfig.value = temp_array;
 			else
-				outConfig.value = std::make_shared<std::array<float, 4>>(temp_array);
+				outConfig.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 			break;
 
 		default:
@@ -603,7 +603,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvColorButtonConfig& o
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvColorEditConfig& outConfig)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvColorEdit)], inDict))
+	if (!VerifyPositionalArguments(GetItemParser(mvAppItemType::mvColorEdit), inDict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(inDict); i++)
@@ -622,7 +622,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvColorEditConfig& out
 			if (outConfig.value)
 				*outConfig.value = temp_array;
 			else
-				outConfig.value = std::make_shared<std::array<float, 4>>(temp_array);
+				outConfig.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 			break;
 
 		default:
@@ -634,7 +634,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvColorEditConfig& out
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvColorPickerConfig& outConfig)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvColorPicker)], inDict))
+	if (!VerifyPositionalArguments(GetItemParser(mvAppItemType::mvColorPicker), inDict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(inDict); i++)
@@ -653,7 +653,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvColorPickerConfig& o
 			if (outConfig.value)
 				*outConfig.value = temp_array;
 			else
-				outConfig.value = std::make_shared<std::array<float, 4>>(temp_array);
+				outConfig.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 			break;
 
 		default:
@@ -666,7 +666,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvColorPickerConfig& o
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvColorMapConfig& outConfig, mvAppItem& item)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvColorMap)], inDict))
+	if (!VerifyPositionalArguments(GetItemParser(mvAppItemType::mvColorMap), inDict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(inDict); i++)
@@ -759,7 +759,7 @@ DearPyGui::set_py_value(PyObject* inDict, mvColorButtonConfig& outConfig)
 	if (outConfig.value)
 		*outConfig.value = temp_array;
 	else
-		outConfig.value = std::make_shared<std::array<float, 4>>(temp_array);
+		outConfig.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void
@@ -780,7 +780,7 @@ DearPyGui::set_py_value(PyObject* inDict, mvColorEditConfig& outConfig)
 	if (outConfig.value)
 		*outConfig.value = temp_array;
 	else
-		outConfig.value = std::make_shared<std::array<float, 4>>(temp_array);
+		outConfig.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void
@@ -795,7 +795,7 @@ DearPyGui::set_py_value(PyObject* inDict, mvColorPickerConfig& outConfig)
 	if (outConfig.value)
 		*outConfig.value = temp_array;
 	else
-		outConfig.value = std::make_shared<std::array<float, 4>>(temp_array);
+		outConfig.value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void
@@ -894,25 +894,24 @@ DearPyGui::set_configuration(PyObject* inDict, mvColorButtonConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
+	using Keywords = mvKeywordTable<mvColorButtonConfig>;
+	static const Keywords keywords = {
+		{ "no_alpha", Keywords::flag(&mvColorButtonConfig::flags, ImGuiColorEditFlags_NoAlpha) },
+		{ "no_border", Keywords::flag(&mvColorButtonConfig::flags, ImGuiColorEditFlags_NoBorder) },
+		{ "no_drag_drop", Keywords::flag(&mvColorButtonConfig::flags, ImGuiColorEditFlags_NoDragDrop) },
+		{ "no_tooltip", Keywords::flag(&mvColorButtonConfig::flags, ImGuiColorEditFlags_NoTooltip) },
 
-	// helpers for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
-	};
-	flagop("no_alpha", ImGuiColorEditFlags_NoAlpha, outConfig.flags);
-	flagop("no_border", ImGuiColorEditFlags_NoBorder, outConfig.flags);
-	flagop("no_drag_drop", ImGuiColorEditFlags_NoDragDrop, outConfig.flags);
-	flagop("no_tooltip", ImGuiColorEditFlags_NoTooltip, outConfig.flags);
+		{ "alpha_preview", [](mvColorButtonConfig& config, PyObject* item)
+			{
+				long mode = ToLong(item);
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "alpha_preview"))
-	{
-		long mode = ToLong(item);
+				// reset target flags
+				config.flags &= ~(ImGuiColorEditFlags_AlphaOpaque | ImGuiColorEditFlags_AlphaPreviewHalf);
+				config.flags |= mode;
+			} },
+	};
 
-		// reset target flags
-		outConfig.flags &= ~(ImGuiColorEditFlags_AlphaOpaque | ImGuiColorEditFlags_AlphaPreviewHalf);
-		outConfig.flags |= mode;
-	}
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -921,92 +920,91 @@ DearPyGui::set_configuration(PyObject* inDict, mvColorEditConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	// helpers for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
-	};
-
-	flagop("no_alpha", ImGuiColorEditFlags_NoAlpha, outConfig.flags);
-	flagop("no_picker", ImGuiColorEditFlags_NoPicker, outConfig.flags);
-	flagop("no_options", ImGuiColorEditFlags_NoOptions, outConfig.flags);
-	flagop("no_small_preview", ImGuiColorEditFlags_NoSmallPreview, outConfig.flags);
-	flagop("no_inputs", ImGuiColorEditFlags_NoInputs, outConfig.flags);
-	flagop("no_tooltip", ImGuiColorEditFlags_NoTooltip, outConfig.flags);
-	flagop("no_label", ImGuiColorEditFlags_NoLabel, outConfig.flags);
-	flagop("no_side_preview", ImGuiColorEditFlags_NoSidePreview, outConfig.flags);
-	flagop("no_drag_drop", ImGuiColorEditFlags_NoDragDrop, outConfig.flags);
-	flagop("alpha_bar", ImGuiColorEditFlags_AlphaBar, outConfig.flags);
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "alpha_preview"))
-	{
-		long mode = ToLong(item);
-
-		// reset target flags
-		outConfig.flags &= ~(ImGuiColorEditFlags_AlphaOpaque | ImGuiColorEditFlags_AlphaPreviewHalf);
-		outConfig.flags |= mode;
-	}
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "display_mode"))
-	{
-		long mode = ToLong(item);
-
-		// reset target flags
-		outConfig.flags &= ~ImGuiColorEditFlags_DisplayRGB;
-		outConfig.flags &= ~ImGuiColorEditFlags_DisplayHSV;
-		outConfig.flags &= ~ImGuiColorEditFlags_DisplayHex;
-
-		switch (mode)
-		{
-		case ImGuiColorEditFlags_DisplayHex:
-			outConfig.flags |= ImGuiColorEditFlags_DisplayHex;
-			break;
-		case ImGuiColorEditFlags_DisplayHSV:
-			outConfig.flags |= ImGuiColorEditFlags_DisplayHSV;
-			break;
-		default:
-			outConfig.flags |= ImGuiColorEditFlags_DisplayRGB;
-			break;
-		}
-	}
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "display_type"))
-	{
-		long mode = ToLong(item);
-
-		// reset target flags
-		outConfig.flags &= ~ImGuiColorEditFlags_Uint8;
-		outConfig.flags &= ~ImGuiColorEditFlags_Float;
-
-		switch (mode)
-		{
-		case ImGuiColorEditFlags_Float:
-			outConfig.flags |= ImGuiColorEditFlags_Float;
-			break;
-		default:
-			outConfig.flags |= ImGuiColorEditFlags_Uint8;
-			break;
-		}
-	}
+	using Keywords = mvKeywordTable<mvColorEditConfig>;
+	static const Keywords keywords = {
+		{ "no_alpha", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoAlpha) },
+		{ "no_picker", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoPicker) },
+		{ "no_options", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoOptions) },
+		{ "no_small_preview", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoSmallPreview) },
+		{ "no_inputs", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoInputs) },
+		{ "no_tooltip", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoTooltip) },
+		{ "no_label", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoLabel) },
+		{ "no_side_preview", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoSidePreview) },
+		{ "no_drag_drop", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_NoDragDrop) },
+		{ "alpha_bar", Keywords::flag(&mvColorEditConfig::flags, ImGuiColorEditFlags_AlphaBar) },
+
+		{ "alpha_preview", [](mvColorEditConfig& config, PyObject* item)
+			{
+				long mode = ToLong(item);
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "input_mode"))
-	{
-		long mode = (long)ToUUID(item);
+				// reset target flags
+				config.flags &= ~(ImGuiColorEditFlags_AlphaOpaque | ImGuiColorEditFlags_AlphaPreviewHalf);
+				config.flags |= mode;
+			} },
 
-		// reset target flags
-		outConfig.flags &= ~ImGuiColorEditFlags_InputRGB;
-		outConfig.flags &= ~ImGuiColorEditFlags_InputHSV;
+		{ "display_mode", [](mvColorEditConfig& config, PyObject* item)
+			{
+				long mode = ToLong(item);
+
+				// reset target flags
+				config.flags &= ~ImGuiColorEditFlags_DisplayRGB;
+				config.flags &= ~ImGuiColorEditFlags_DisplayHSV;
+				config.flags &= ~ImGuiColorEditFlags_DisplayHex;
+
+				switch (mode)
+				{
+				case ImGuiColorEditFlags_DisplayHex:
+					config.flags |= ImGuiColorEditFlags_DisplayHex;
+					break;
+				case ImGuiColorEditFlags_DisplayHSV:
+					config.flags |= ImGuiColorEditFlags_DisplayHSV;
+					break;
+				default:
+					config.flags |= ImGuiColorEditFlags_DisplayRGB;
+					break;
+				}
+			} },
+
+		{ "display_type", [](mvColorEditConfig& config, PyObject* item)
+			{
+				long mode = ToLong(item);
+
+				// reset target flags
+				config.flags &= ~ImGuiColorEditFlags_Uint8;
+				config.flags &= ~ImGuiColorEditFlags_Float;
+
+				switch (mode)
+				{
+				case ImGuiColorEditFlags_Float:
+					config.flags |= ImGuiColorEditFlags_Float;
+					break;
+				default:
+					config.flags |= ImGuiColorEditFlags_Uint8;
+					break;
+				}
+			} },
+
+		{ "input_mode", [](mvColorEditConfig& config, PyObject* item)
+			{
+				long mode = (long)ToUUID(item);
+
+				// reset target flags
+				config.flags &= ~ImGuiColorEditFlags_InputRGB;
+				config.flags &= ~ImGuiColorEditFlags_InputHSV;
+
+				switch (mode)
+				{
+				case ImGuiColorEditFlags_InputHSV:
+					config.flags |= ImGuiColorEditFlags_InputHSV;
+					break;
+				default:
+					config.flags |= ImGuiColorEditFlags_InputRGB;
+					break;
+				}
+			} },
+	};
 
-		switch (mode)
-		{
-		case ImGuiColorEditFlags_InputHSV:
-			outConfig.flags |= ImGuiColorEditFlags_InputHSV;
-			break;
-		default:
-			outConfig.flags |= ImGuiColorEditFlags_InputRGB;
-			break;
-		}
-	}
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1015,89 +1013,87 @@ DearPyGui::set_configuration(PyObject* inDict, mvColorPickerConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	// helpers for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
-	};
-
-
-	flagop("no_alpha", ImGuiColorEditFlags_NoAlpha, outConfig.flags);
-	flagop("no_small_preview", ImGuiColorEditFlags_NoSmallPreview, outConfig.flags);
-	flagop("no_inputs", ImGuiColorEditFlags_NoInputs, outConfig.flags);
-	flagop("no_tooltip", ImGuiColorEditFlags_NoTooltip, outConfig.flags);
-	flagop("no_label", ImGuiColorEditFlags_NoLabel, outConfig.flags);
-	flagop("no_side_preview", ImGuiColorEditFlags_NoSidePreview, outConfig.flags);
-	flagop("alpha_bar", ImGuiColorEditFlags_AlphaBar, outConfig.flags);
-	flagop("display_rgb", ImGuiColorEditFlags_DisplayRGB, outConfig.flags);
-	flagop("display_hsv", ImGuiColorEditFlags_DisplayHSV, outConfig.flags);
-	flagop("display_hex", ImGuiColorEditFlags_DisplayHex, outConfig.flags);
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "picker_mode"))
-	{
-		long mode = ToLong(item);
-
-		// reset target flags
-		outConfig.flags &= ~ImGuiColorEditFlags_PickerHueBar;
-		outConfig.flags &= ~ImGuiColorEditFlags_PickerHueWheel;
-
-		switch (mode)
-		{
-		case ImGuiColorEditFlags_PickerHueWheel:
-			outConfig.flags |= ImGuiColorEditFlags_PickerHueWheel;
-			break;
-		default:
-			outConfig.flags |= ImGuiColorEditFlags_PickerHueBar;
-			break;
-		}
-	}
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "alpha_preview"))
-	{
-		long mode = ToLong(item);
-
-		// reset target flags
-		outConfig.flags &= ~(ImGuiColorEditFlags_AlphaOpaque | ImGuiColorEditFlags_AlphaPreviewHalf);
-		outConfig.flags |= mode;
-	}
-
-	if (PyObject* item = PyDict_GetItemString(inDict, "display_type"))
-	{
-		long mode = ToLong(item);
-
-		// reset target flags
-		outConfig.flags &= ~ImGuiColorEditFlags_Uint8;
-		outConfig.flags &= ~ImGuiColorEditFlags_Float;
-
-		switch (mode)
-		{
-		case ImGuiColorEditFlags_Float:
-			outConfig.flags |= ImGuiColorEditFlags_Float;
-			break;
-		default:
-			outConfig.flags |= ImGuiColorEditFlags_Uint8;
-			break;
-		}
-	}
+	using Keywords = mvKeywordTable<mvColorPickerConfig>;
+	static const Keywords keywords = {
+		{ "no_alpha", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_NoAlpha) },
+		{ "no_small_preview", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_NoSmallPreview) },
+		{ "no_inputs", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_NoInputs) },
+		{ "no_tooltip", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_NoTooltip) },
+		{ "no_label", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_NoLabel) },
+		{ "no_side_preview", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_NoSidePreview) },
+		{ "alpha_bar", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_AlphaBar) },
+		{ "display_rgb", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_DisplayRGB) },
+		{ "display_hsv", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_DisplayHSV) },
+		{ "display_hex", Keywords::flag(&mvColorPickerConfig::flags, ImGuiColorEditFlags_DisplayHex) },
+
+		{ "picker_mode", [](mvColorPickerConfig& config, PyObject* item)
+			{
+				long mode = ToLong(item);
+
+				// reset target flags
+				config.flags &= ~ImGuiColorEditFlags_PickerHueBar;
+				config.flags &= ~ImGuiColorEditFlags_PickerHueWheel;
+
+				switch (mode)
+				{
+				case ImGuiColorEditFlags_PickerHueWheel:
+					config.flags |= ImGuiColorEditFlags_PickerHueWheel;
+					break;
+				default:
+					config.flags |= ImGuiColorEditFlags_PickerHueBar;
+					break;
+				}
+			} },
+
+		{ "alpha_preview", [](mvColorPickerConfig& config, PyObject* item)
+			{
+				long mode = ToLong(item);
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "input_mode"))
-	{
-		long mode = ToLong(item);
+				// reset target flags
+				config.flags &= ~(ImGuiColorEditFlags_AlphaOpaque | ImGuiColorEditFlags_AlphaPreviewHalf);
+				config.flags |= mode;
+			} },
 
-		// reset target flags
-		outConfig.flags &= ~ImGuiColorEditFlags_InputRGB;
-		outConfig.flags &= ~ImGuiColorEditFlags_InputHSV;
+		{ "display_type", [](mvColorPickerConfig& config, PyObject* item)
+			{
+				long mode = ToLong(item);
+
+				// reset target flags
+				config.flags &= ~ImGuiColorEditFlags_Uint8;
+				config.flags &= ~ImGuiColorEditFlags_Float;
+
+				switch (mode)
+				{
+				case ImGuiColorEditFlags_Float:
+					config.flags |= ImGuiColorEditFlags_Float;
+					break;
+				default:
+					config.flags |= ImGuiColorEditFlags_Uint8;
+					break;
+				}
+			} },
+
+		{ "input_mode", [](mvColorPickerConfig& config, PyObject* item)
+			{
+				long mode = ToLong(item);
+
+				// reset target flags
+				config.flags &= ~ImGuiColorEditFlags_InputRGB;
+				config.flags &= ~ImGuiColorEditFlags_InputHSV;
+
+				switch (mode)
+				{
+				case ImGuiColorEditFlags_InputHSV:
+					config.flags |= ImGuiColorEditFlags_InputHSV;
+					break;
+				default:
+					config.flags |= ImGuiColorEditFlags_InputRGB;
+					break;
+				}
+			} },
+	};
 
-		switch (mode)
-		{
-		case ImGuiColorEditFlags_InputHSV:
-			outConfig.flags |= ImGuiColorEditFlags_InputHSV;
-			break;
-		default:
-			outConfig.flags |= ImGuiColorEditFlags_InputRGB;
-			break;
-		}
-	}
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -1106,39 +1102,37 @@ DearPyGui::set_configuration(PyObject* inDict, mvColorMapScaleConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_scale")) outConfig.scale_min = (double)ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_scale")) outConfig.scale_max = (double)ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "colormap"))
-	{
-		outConfig.colorMap = (ImPlotColormap)GetIDFromPyObject(item);
-		if (outConfig.colorMap > 10)
-		{
-			auto asource = GetItem(*GContext->itemRegistry, outConfig.colorMap);
-			if (asource == nullptr)
-			{
-				mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_colormap",
-					"Source Item not found: " + std::to_string(outConfig.colorMap), nullptr);
-				outConfig.colorMap = 0;
-			}
-
-			else if (asource->type == mvAppItemType::mvColorMap)
+	using Keywords = mvKeywordTable<mvColorMapScaleConfig>;
+	static const Keywords keywords = {
+		{ "min_scale", [](mvColorMapScaleConfig& config, PyObject* item) { config.scale_min = (double)ToFloat(item); } },
+		{ "max_scale", [](mvColorMapScaleConfig& config, PyObject* item) { config.scale_max = (double)ToFloat(item); } },
+		{ "format", [](mvColorMapScaleConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "colormap", [](mvColorMapScaleConfig& config, PyObject* item)
 			{
-				mvColorMap* colormap = static_cast<mvColorMap*>(asource);
-				outConfig.colorMap = colormap->configData.colorMap;
-			}
-		}
-	}
-
-	// helpers for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+				config.colorMap = (ImPlotColormap)GetIDFromPyObject(item);
+				if (config.colorMap > 10)
+				{
+					auto asource = GetItem(*GContext->itemRegistry, config.colorMap);
+					if (asource == nullptr)
+					{
+						mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_colormap",
+							"Source Item not found: " + std::to_string(config.colorMap), nullptr);
+						config.colorMap = 0;
+					}
+
+					else if (asource->type == mvAppItemType::mvColorMap)
+					{
+						mvColorMap* colormap = static_cast<mvColorMap*>(asource);
+						config.colorMap = colormap->configData.colorMap;
+					}
+				}
+			} },
+
+		{ "reverse_dir", Keywords::flag(&mvColorMapScaleConfig::flags, ImPlotColormapScaleFlags_Invert) },
+		{ "mirror", Keywords::flag(&mvColorMapScaleConfig::flags, ImPlotColormapScaleFlags_Opposite) },
 	};
 
-
-	flagop("reverse_dir", ImPlotColormapScaleFlags_Invert, outConfig.flags);
-	flagop("mirror", ImPlotColormapScaleFlags_Opposite, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -63,7 +63,7 @@ namespace DearPyGui
 struct mvColorButtonConfig
 {
 
-    std::shared_ptr<std::array<float, 4>> value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
+    std::shared_ptr<std::array<float, 4>> value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
     float                       disabled_value[4]{};
     ImGuiColorEditFlags         flags = ImGuiColorEditFlags_None;
     bool                        no_border = false;
@@ -73,7 +73,7 @@ struct mvColorButtonConfig
 struct mvColorEditConfig
 {
 
-    std::shared_ptr<std::array<float, 4>> value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
+    std::shared_ptr<std::array<float, 4>> value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
     float                       disabled_value[4]{};
     ImGuiColorEditFlags         flags = ImGuiColorEditFlags_DefaultOptions_;
     bool                        no_picker = false;
@@ -86,7 +86,7 @@ struct mvColorEditConfig
 
 struct mvColorPickerConfig
 {
-    std::shared_ptr<std::array<float, 4>> value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
+    std::shared_ptr<std::array<float, 4>> value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
     float                       disabled_value[4]{};
     ImGuiColorEditFlags         flags = ImGuiColorEditFlags_DefaultOptions_;
     bool                        no_inputs = false;
@@ -118,7 +118,7 @@ struct mvColorMapScaleConfig
 
 struct mvColorMapSliderConfig
 {
-    std::shared_ptr<float>    value = std::make_shared<float>(0.0f);
+    std::shared_ptr<float>    value = mvAllocateShared<float>(0.0f);
     ImVec4          color = ImVec4(0.0f, 0.0f, 0.0f, 1.0f);
     ImPlotColormap  colorMap = 0;
 };
@@ -235,8 +235,11 @@ DearPyGui::set_configuration(PyObject* inDict, mvMenuConfig& outConfig, mvAppIte
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "enabled")) itemc.config.enabled = ToBool(item);
+    static const mvKeywordTable<mvAppItem> keywords = {
+        { "enabled", [](mvAppItem& self, PyObject* item) { self.config.enabled = ToBool(item); } },
+    };
 
+    keywords.apply(inDict, itemc);
 }
 
 void
@@ -245,33 +248,31 @@ DearPyGui::set_configuration(PyObject* inDict, mvTabConfig& outConfig)
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "closable")) outConfig.closable = ToBool(item);
-
+    using Keywords = mvKeywordTable<mvTabConfig>;
+    static const Keywords keywords = {
+        { "closable", [](mvTabConfig& config, PyObject* item) { config.closable = ToBool(item); } },
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "order_mode"))
-    {
-        long order_mode = (long)ToUUID(item);
-
-        if (order_mode == (long)TabOrdering::mvTabOrder_Fixed)
-            outConfig._flags = ImGuiTabItemFlags_NoReorder;
-        else if (order_mode == (long)TabOrdering::mvTabOrder_Leading)
-            outConfig._flags = ImGuiTabItemFlags_Leading;
-        else if (order_mode == (long)TabOrdering::mvTabOrder_Trailing)
-            outConfig._flags = ImGuiTabItemFlags_Trailing;
-        else
-            outConfig._flags = ImGuiTabItemFlags_None;
-    }
-
-    // helper for bit flipping
-    auto flagop = [inDict](const char* keyword, int flag, int& flags)
-    {
-        if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+        { "order_mode", [](mvTabConfig& config, PyObject* item)
+            {
+                long order_mode = (long)ToUUID(item);
+
+                if (order_mode == (long)TabOrdering::mvTabOrder_Fixed)
+                    config._flags = ImGuiTabItemFlags_NoReorder;
+                else if (order_mode == (long)TabOrdering::mvTabOrder_Leading)
+                    config._flags = ImGuiTabItemFlags_Leading;
+                else if (order_mode == (long)TabOrdering::mvTabOrder_Trailing)
+                    config._flags = ImGuiTabItemFlags_Trailing;
+                else
+                    config._flags = ImGuiTabItemFlags_None;
+            } },
+
+        { "no_tooltip", Keywords::flag(&mvTabConfig::_flags, ImGuiTabItemFlags_NoTooltip) },
+        { "unsaved_document", Keywords::flag(&mvTabConfig::_flags, ImGuiTabItemFlags_UnsavedDocument) },
+        { "no_close_with_middle_click", Keywords::flag(&mvTabConfig::_flags, ImGuiTabItemFlags_NoCloseWithMiddleMouseButton) },
+        { "no_reorder", Keywords::flag(&mvTabConfig::_flags, ImGuiTabItemFlags_NoReorder) },
     };
 
-    flagop("no_tooltip", ImGuiTabItemFlags_NoTooltip, outConfig._flags);
-    flagop("unsaved_document", ImGuiTabItemFlags_UnsavedDocument, outConfig._flags);
-    flagop("no_close_with_middle_click", ImGuiTabItemFlags_NoCloseWithMiddleMouseButton, outConfig._flags);
-    flagop("no_reorder", ImGuiTabItemFlags_NoReorder, outConfig._flags);
+    keywords.apply(inDict, outConfig);
 }
 
 void
@@ -280,31 +281,30 @@ DearPyGui::set_configuration(PyObject* inDict, mvChildWindowConfig& outConfig)
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "autosize_x")) outConfig.autosize_x = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "autosize_y")) outConfig.autosize_y = ToBool(item);
+    using Keywords = mvKeywordTable<mvChildWindowConfig>;
+    static const Keywords keywords = {
+        { "autosize_x", [](mvChildWindowConfig& config, PyObject* item) { config.autosize_x = ToBool(item); } },
+        { "autosize_y", [](mvChildWindowConfig& config, PyObject* item) { config.autosize_y = ToBool(item); } },
 
-    // helper for bit flipping
-    auto flagop = [inDict](const char* keyword, int flag, int& flags)
-    {
-        if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+        // window flags
+        { "no_scrollbar", Keywords::flag(&mvChildWindowConfig::windowflags, ImGuiWindowFlags_NoScrollbar) },
+        { "horizontal_scrollbar", Keywords::flag(&mvChildWindowConfig::windowflags, ImGuiWindowFlags_HorizontalScrollbar) },
+        { "menubar", Keywords::flag(&mvChildWindowConfig::windowflags, ImGuiWindowFlags_MenuBar) },
+        { "no_scroll_with_mouse", Keywords::flag(&mvChildWindowConfig::windowflags, ImGuiWindowFlags_NoScrollWithMouse) },
+
+        // child flags
+        { "border", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_Borders) },
+        { "always_auto_resize", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_AlwaysAutoResize) },
+        { "always_use_window_padding", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_AlwaysUseWindowPadding) },
+        { "auto_resize_x", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_AutoResizeX) },
+        { "auto_resize_y", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_AutoResizeY) },
+        { "frame_style", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_FrameStyle) },
+        { "resizable_x", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_ResizeX) },
+        { "resizable_y", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_ResizeY) },
+        { "flattened_navigation", Keywords::flag(&mvChildWindowConfig::childFlags, ImGuiChildFlags_NavFlattened) },
     };
 
-    // window flags
-    flagop("no_scrollbar", ImGuiWindowFlags_NoScrollbar, outConfig.windowflags);
-    flagop("horizontal_scrollbar", ImGuiWindowFlags_HorizontalScrollbar, outConfig.windowflags);
-    flagop("menubar", ImGuiWindowFlags_MenuBar, outConfig.windowflags);
-    flagop("no_scroll_with_mouse", ImGuiWindowFlags_NoScrollWithMouse, outConfig.windowflags);
-
-    // child flags
-    flagop("border", ImGuiChildFlags_Borders, outConfig.childFlags);
-    flagop("always_auto_resize", ImGuiChildFlags_AlwaysAutoResize, outConfig.childFlags);
-    flagop("always_use_window_padding", ImGuiChildFlags_AlwaysUseWindowPadding, outConfig.childFlags);
-    flagop("auto_resize_x", ImGuiChildFlags_AutoResizeX, outConfig.childFlags);
-    flagop("auto_resize_y", ImGuiChildFlags_AutoResizeY, outConfig.childFlags);
-    flagop("frame_style", ImGuiChildFlags_FrameStyle, outConfig.childFlags);
-    flagop("resizable_x", ImGuiChildFlags_ResizeX, outConfig.childFlags);
-    flagop("resizable_y", ImGuiChildFlags_ResizeY, outConfig.childFlags);
-    flagop("flattened_navigation", ImGuiChildFlags_NavFlattened, outConfig.childFlags);
+    keywords.apply(inDict, outConfig);
 }
 
 void
@@ -313,9 +313,13 @@ DearPyGui::set_configuration(PyObject* inDict, mvGroupConfig& outConfig)
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "horizontal")) outConfig.horizontal = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "horizontal_spacing")) outConfig.hspacing = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "xoffset")) outConfig.xoffset = ToFloat(item);
+    static const mvKeywordTable<mvGroupConfig> keywords = {
+        { "horizontal", [](mvGroupConfig& config, PyObject* item) { config.horizontal = ToBool(item); } },
+        { "horizontal_spacing", [](mvGroupConfig& config, PyObject* item) { config.hspacing = ToFloat(item); } },
+        { "xoffset", [](mvGroupConfig& config, PyObject* item) { config.xoffset = ToFloat(item); } },
+    };
+
+    keywords.apply(inDict, outConfig);
 }
 
 void
@@ -324,17 +328,21 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragPayloadConfig& outConfig)
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "payload_type")) outConfig.payloadType = ToString(item);
+    static const mvKeywordTable<mvDragPayloadConfig> keywords = {
+        { "payload_type", [](mvDragPayloadConfig& config, PyObject* item) { config.payloadType = ToString(item); } },
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "drag_data"))
-    {
-        *outConfig.dragData = mvPyObject(item == Py_None? nullptr : item, true);
-    }
+        { "drag_data", [](mvDragPayloadConfig& config, PyObject* item)
+            {
+                *config.dragData = mvPyObject(item == Py_None? nullptr : item, true);
+            } },
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "drop_data"))
-    {
-        *outConfig.dropData = mvPyObject(item == Py_None? nullptr : item, true);
-    }
+        { "drop_data", [](mvDragPayloadConfig& config, PyObject* item)
+            {
+                *config.dropData = mvPyObject(item == Py_None? nullptr : item, true);
+            } },
+    };
+
+    keywords.apply(inDict, outConfig);
 }
 
 void
@@ -343,32 +351,35 @@ DearPyGui::set_configuration(PyObject* inDict, mvTreeNodeConfig& outConfig)
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "selectable")) outConfig.selectable = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "default_open")) *outConfig.value = ToBool(item);
-
-    // helper for bit flipping
-    auto flagop = [inDict](const char* keyword, int flag, int& flags)
-    {
-        if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+    using Keywords = mvKeywordTable<mvTreeNodeConfig>;
+    static const Keywords keywords = {
+        { "selectable", [](mvTreeNodeConfig& config, PyObject* item) { config.selectable = ToBool(item); } },
+        { "default_open", [](mvTreeNodeConfig& config, PyObject* item)
+            {
+                bool value = ToBool(item);
+                *config.value = value;
+                value ? config.flags |= ImGuiTreeNodeFlags_DefaultOpen : config.flags &= ~ImGuiTreeNodeFlags_DefaultOpen;
+            } },
+
+        // flags
+        { "open_on_double_click", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_OpenOnDoubleClick) },
+        { "open_on_arrow", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_OpenOnArrow) },
+        { "leaf", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_Leaf) },
+        { "bullet", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_Bullet) },
+        { "span_text_width", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_SpanLabelWidth) },
+        // { "span_available_width", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_SpanAvailWidth) },
+        { "span_full_width", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_SpanFullWidth) },
+        // { "span_all_columns", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_SpanAllColumns) },
+        { "catch_nav_left", Keywords::flag(&mvTreeNodeConfig::flags, ImGuiTreeNodeFlags_NavLeftJumpsToParent) },
+
+        { "lines", [](mvTreeNodeConfig& config, PyObject* item)
+            {
+                config.flags &= ~(ImGuiTreeNodeFlags_DrawLinesNone | ImGuiTreeNodeFlags_DrawLinesFull | ImGuiTreeNodeFlags_DrawLinesToNodes);
+                config.flags |= ToInt(item);
+            } },
     };
 
-    // flags
-    flagop("default_open", ImGuiTreeNodeFlags_DefaultOpen, outConfig.flags);
-    flagop("open_on_double_click", ImGuiTreeNodeFlags_OpenOnDoubleClick, outConfig.flags);
-    flagop("open_on_arrow", ImGuiTreeNodeFlags_OpenOnArrow, outConfig.flags);
-    flagop("leaf", ImGuiTreeNodeFlags_Leaf, outConfig.flags);
-    flagop("bullet", ImGuiTreeNodeFlags_Bullet, outConfig.flags);
-    flagop("span_text_width", ImGuiTreeNodeFlags_SpanLabelWidth, outConfig.flags);
-    // flagop("span_available_width", ImGuiTreeNodeFlags_SpanAvailWidth, outConfig.flags);
-    flagop("span_full_width", ImGuiTreeNodeFlags_SpanFullWidth, outConfig.flags);
-    // flagop("span_all_columns", ImGuiTreeNodeFlags_SpanAllColumns, outConfig.flags);
-    flagop("catch_nav_left", ImGuiTreeNodeFlags_NavLeftJumpsToParent, outConfig.flags);
-
-    if (PyObject* item = PyDict_GetItemString(inDict, "lines"))
-    {
-        outConfig.flags &= ~(ImGuiTreeNodeFlags_DrawLinesNone | ImGuiTreeNodeFlags_DrawLinesFull | ImGuiTreeNodeFlags_DrawLinesToNodes);
-        outConfig.flags |= ToInt(item);
-    }
+    keywords.apply(inDict, outConfig);
 }
 
 void
@@ -376,16 +387,18 @@ DearPyGui::set_configuration(PyObject* inDict, mvTabBarConfig& outConfig)
 {
     if (inDict == nullptr)
         return;
-    auto flagop = [inDict](const char* keyword, int flag, int& flags)
-    {
-        if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+
+    using Keywords = mvKeywordTable<mvTabBarConfig>;
+    static const Keywords keywords = {
+        { "reorderable", Keywords::flag(&mvTabBarConfig::flags, ImGuiTabBarFlags_Reorderable) },
+        { "tab_list_popup_button", Keywords::flag(&mvTabBarConfig::flags, ImGuiTabBarFlags_TabListPopupButton) },
+        { "no_close_with_middle_click", Keywords::flag(&mvTabBarConfig::flags, ImGuiTabBarFlags_NoCloseWithMiddleMouseButton) },
+        { "no_scrolling_buttons", Keywords::flag(&mvTabBarConfig::flags, ImGuiTabBarFlags_NoTabListScrollingButtons) },
+        { "no_tooltip", Keywords::flag(&mvTabBarConfig::flags, ImGuiTabBarFlags_NoTooltip) },
+        { "draw_selected_overline", Keywords::flag(&mvTabBarConfig::flags, ImGuiTabBarFlags_DrawSelectedOverline) },
     };
-    flagop("reorderable", ImGuiTabBarFlags_Reorderable, outConfig.flags);
-    flagop("tab_list_popup_button", ImGuiTabBarFlags_TabListPopupButton, outConfig.flags);
-    flagop("no_close_with_middle_click", ImGuiTabBarFlags_NoCloseWithMiddleMouseButton, outConfig.flags);
-    flagop("no_scrolling_buttons", ImGuiTabBarFlags_NoTabListScrollingButtons, outConfig.flags);
-    flagop("no_tooltip", ImGuiTabBarFlags_NoTooltip, outConfig.flags);
-    flagop("draw_selected_overline", ImGuiTabBarFlags_DrawSelectedOverline, outConfig.flags);
+
+    keywords.apply(inDict, outConfig);
 }
 
 void
@@ -394,20 +407,19 @@ DearPyGui::set_configuration(PyObject* inDict, mvCollapsingHeaderConfig& outConf
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "closable")) outConfig.closable = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "default_open")) *outConfig.value = ToBool(item);
+    using Keywords = mvKeywordTable<mvCollapsingHeaderConfig>;
+    static const Keywords keywords = {
+        { "closable", [](mvCollapsingHeaderConfig& config, PyObject* item) { config.closable = ToBool(item); } },
+        { "default_open", [](mvCollapsingHeaderConfig& config, PyObject* item) { *config.value = ToBool(item); } },
 
-    // helper for bit flipping
-    auto flagop = [inDict](const char* keyword, int flag, int& flags)
-    {
-        if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+        // flags
+        { "open_on_double_click", Keywords::flag(&mvCollapsingHeaderConfig::flags, ImGuiTreeNodeFlags_OpenOnDoubleClick) },
+        { "open_on_arrow", Keywords::flag(&mvCollapsingHeaderConfig::flags, ImGuiTreeNodeFlags_OpenOnArrow) },
+        { "leaf", Keywords::flag(&mvCollapsingHeaderConfig::flags, ImGuiTreeNodeFlags_Leaf) },
+        { "bullet", Keywords::flag(&mvCollapsingHeaderConfig::flags, ImGuiTreeNodeFlags_Bullet) },
     };
 
-    // flags
-    flagop("open_on_double_click", ImGuiTreeNodeFlags_OpenOnDoubleClick, outConfig.flags);
-    flagop("open_on_arrow", ImGuiTreeNodeFlags_OpenOnArrow, outConfig.flags);
-    flagop("leaf", ImGuiTreeNodeFlags_Leaf, outConfig.flags);
-    flagop("bullet", ImGuiTreeNodeFlags_Bullet, outConfig.flags);
+    keywords.apply(inDict, outConfig);
 }
 
 void
@@ -416,75 +428,80 @@ DearPyGui::set_configuration(PyObject* inDict, mvAppItem& itemc, mvWindowAppItem
     if (inDict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "modal"))
-    {
-        outConfig.modal = ToBool(item);
-        itemc.info.shownLastFrame = true;
-    }
-
-    if (PyObject* item = PyDict_GetItemString(inDict, "popup"))
-    {
-        outConfig.popup = ToBool(item);
-        itemc.info.shownLastFrame = true;
-    }
-
-    if (PyObject* item = PyDict_GetItemString(inDict, "label"))
+    // some keywords also mark the window itself dirty
+    struct Target
     {
-        if (item != Py_None)
-        {
-            itemc.info.dirtyPos = true;
-            itemc.info.dirty_size = true;
-        }
-    }
+        mvAppItem&             window;
+        mvWindowAppItemConfig& config;
+    };
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "no_open_over_existing_popup")) outConfig.no_open_over_existing_popup = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "no_close")) outConfig.no_close = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "copy_contents_shortcut")) outConfig.copy_contents_shortcut = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(inDict, "collapsed"))
-    {
-        outConfig._collapsedDirty = true;
-        outConfig.collapsed = ToBool(item);
-    }
+    using Keywords = mvKeywordTable<Target>;
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "min_size"))
-    {
-        auto min_size = ToIntVect(item);
-        outConfig.min_size = { (float)min_size[0], (float)min_size[1] };
-    }
-
-    if (PyObject* item = PyDict_GetItemString(inDict, "max_size"))
+    // helper for bit flipping
+    auto flagop = [](int flag) -> Keywords::Setter
     {
-        auto max_size = ToIntVect(item);
-        outConfig.max_size = { (float)max_size[0], (float)max_size[1] };
-    }
+        return [flag](Target& target, PyObject* item) { ToBool(item) ? target.config.windowflags |= flag : target.config.windowflags &= ~flag; };
+    };
 
-    if (PyObject* item = PyDict_GetItemString(inDict, "on_close"))
-    {
-        outConfig.on_close = mvPyObject(item == Py_None? nullptr : item, true);
-    }
+    static const Keywords keywords = {
+        { "modal", [](Target& target, PyObject* item)
+            {
+                target.config.modal = ToBool(item);
+                target.window.info.shownLastFrame = true;
+            } },
+        { "popup", [](Target& target, PyObject* item)
+            {
+                target.config.popup = ToBool(item);
+                target.window.info.shownLastFrame = true;
+            } },
+        { "label", [](Target& target, PyObject* item)
+            {
+                if (item != Py_None)
+                {
+                    target.window.info.dirtyPos = true;
+                    target.window.info.dirty_size = true;
+                }
+            } },
+        { "no_open_over_existing_popup", [](Target& target, PyObject* item) { target.config.no_open_over_existing_popup = ToBool(item); } },
+        { "no_close", [](Target& target, PyObject* item) { target.config.no_close = ToBool(item); } },
+        { "copy_contents_shortcut", [](Target& target, PyObject* item) { target.config.copy_contents_shortcut = ToBool(item); } },
+        { "collapsed", [](Target& target, PyObject* item)
+            {
+                target.config._collapsedDirty = true;
+                target.config.collapsed = ToBool(item);
+            } },
+        { "min_size", [](Target& target, PyObject* item)
+            {
+                auto min_size = ToIntVect(item);
+                target.config.min_size = { (float)min_size[0], (float)min_size[1] };
+            } },
+        { "max_size", [](Target& target, PyObject* item)
+            {
+                auto max_size = ToIntVect(item);
+                target.config.max_size = { (float)max_size[0], (float)max_size[1] };
+            } },
+        { "on_close", [](Target& target, PyObject* item) { target.config.on_close = mvPyCallback(item == Py_None? nullptr : item, true); } },
 
-    // helper for bit flipping
-    auto flagop = [inDict](const char* keyword, int flag, int& flags)
-    {
-        if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+        // window flags
+        { "autosize", flagop(ImGuiWindowFlags_AlwaysAutoResize) },
+        { "no_move", flagop(ImGuiWindowFlags_NoMove) },
+        { "no_resize", flagop(ImGuiWindowFlags_NoResize) },
+        { "no_title_bar", flagop(ImGuiWindowFlags_NoTitleBar) },
+        { "no_scrollbar", flagop(ImGuiWindowFlags_NoScrollbar) },
+        { "no_collapse", flagop(ImGuiWindowFlags_NoCollapse) },
+        { "horizontal_scrollbar", flagop(ImGuiWindowFlags_HorizontalScrollbar) },
+        { "no_focus_on_appearing", flagop(ImGuiWindowFlags_NoFocusOnAppearing) },
+        { "no_bring_to_front_on_focus", flagop(ImGuiWindowFlags_NoBringToFrontOnFocus) },
+        { "menubar", flagop(ImGuiWindowFlags_MenuBar) },
+        { "no_background", flagop(ImGuiWindowFlags_NoBackground) },
+        { "no_saved_settings", flagop(ImGuiWindowFlags_NoSavedSettings) },
+        { "no_scroll_with_mouse", flagop(ImGuiWindowFlags_NoScrollWithMouse) },
+        { "unsaved_document", flagop(ImGuiWindowFlags_UnsavedDocument) },
+        { "no_docking", flagop(ImGuiWindowFlags_NoDocking) },
     };
 
-    // window flags
-    flagop("autosize", ImGuiWindowFlags_AlwaysAutoResize, outConfig.windowflags);
-    flagop("no_move", ImGuiWindowFlags_NoMove, outConfig.windowflags);
-    flagop("no_resize", ImGuiWindowFlags_NoResize, outConfig.windowflags);
-    flagop("no_title_bar", ImGuiWindowFlags_NoTitleBar, outConfig.windowflags);
-    flagop("no_scrollbar", ImGuiWindowFlags_NoScrollbar, outConfig.windowflags);
-    flagop("no_collapse", ImGuiWindowFlags_NoCollapse, outConfig.windowflags);
-    flagop("horizontal_scrollbar", ImGuiWindowFlags_HorizontalScrollbar, outConfig.windowflags);
-    flagop("no_focus_on_appearing", ImGuiWindowFlags_NoFocusOnAppearing, outConfig.windowflags);
-    flagop("no_bring_to_front_on_focus", ImGuiWindowFlags_NoBringToFrontOnFocus, outConfig.windowflags);
-    flagop("menubar", ImGuiWindowFlags_MenuBar, outConfig.windowflags);
-    flagop("no_background", ImGuiWindowFlags_NoBackground, outConfig.windowflags);
-    flagop("no_saved_settings", ImGuiWindowFlags_NoSavedSettings, outConfig.windowflags);
-    flagop("no_scroll_with_mouse", ImGuiWindowFlags_NoScrollWithMouse, outConfig.windowflags);
-    flagop("unsaved_document", ImGuiWindowFlags_UnsavedDocument, outConfig.windowflags);
-    flagop("no_docking", ImGuiWindowFlags_NoDocking, outConfig.windowflags);
+    Target target{ itemc, outConfig };
+    keywords.apply(inDict, target);
 }
 
 //-----------------------------------------------------------------------------
@@ -972,7 +989,8 @@ DearPyGui::draw_child_window(ImDrawList* drawlist, mvAppItem& item, mvChildWindo
         }
 
         item.handleDelayedScroll();
-        item.config.scrollXFlags = item.config.scrollYFlags = mvSetScrollFlags_None;
+        if (item.config.coldConfig)
+            item.config.coldConfig->scrollXFlags = item.config.coldConfig->scrollYFlags = mvSetScrollFlags_None;
 
         // allows this item to have a render callback
         if (ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows))
@@ -1153,12 +1171,12 @@ DearPyGui::draw_drag_payload(ImDrawList* drawlist, mvAppItem& item, mvDragPayloa
         // call parentPtr->submitCallback(), as it would take user_data from the parent
         // instead of mvDragPayload.
         mvAppItem* parent = item.info.parentPtr;
-        if (parent->config.dragCallback)
+        if (parent->config.cold().dragCallback)
         {
             // We can't use mvAppItem::submitCallbackEx here because we need custom user_data.
             mvAddCallback(
                 parent->weak_from_this(),
-                parent->config.dragCallback,
+                parent->config.cold().dragCallback,
                 item.config.user_data,
                 parent->uuid, parent->config.alias,
                 [dragData=config.dragData] () {
@@ -1646,7 +1664,8 @@ DearPyGui::draw_window(ImDrawList* drawlist, mvAppItem& item, mvWindowAppItemCon
     cleanup_local_theming(&item);
 
     item.handleDelayedScroll();
-    item.config.scrollXFlags = item.config.scrollYFlags = mvSetScrollFlags_None;
+    if (item.config.coldConfig)
+        item.config.coldConfig->scrollXFlags = item.config.coldConfig->scrollYFlags = mvSetScrollFlags_None;
 
     UpdateAppItemScrollInfo(item.state);
 
@@ -1722,7 +1741,7 @@ DearPyGui::draw_window(ImDrawList* drawlist, mvAppItem& item, mvWindowAppItemCon
 void
 check_drop_event(mvAppItem* item)
 {
-    if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(item->config.payloadType.c_str()))
+    if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(item->config.cold().payloadType.c_str()))
     {
         IM_ASSERT(payload->DataSize == sizeof(mvUUID) && "Unexpected drag payload data size.");
         mvUUID payloadUUID = *(mvUUID*)payload->Data;
@@ -1738,7 +1757,7 @@ check_drop_event(mvAppItem* item)
             // We can't use mvAppItem::submitCallbackEx here because we need custom user_data.
             mvAddCallback(
                 item->weak_from_this(),
-                item->config.dropCallback,
+                item->config.cold().dropCallback,
                 std::make_shared<mvPyObject>(nullptr),
                 item->uuid, item->config.alias,
                 [dragData = payloadActual->configData.dragData] () {
@@ -1757,7 +1776,7 @@ apply_drag_drop(mvAppItem* item)
     for (auto& item : item->childslots[3])
         item->draw(nullptr, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
 
-    if (item->config.dropCallback)
+    if (item->config.cold().dropCallback)
     {
         ScopedID id(item->uuid);
         if (ImGui::BeginDragDropTarget())
@@ -1771,7 +1790,7 @@ apply_drag_drop(mvAppItem* item)
 void
 apply_drag_drop_nodraw(mvAppItem* item)
 {
-    if (item->config.dropCallback)
+    if (item->config.cold().dropCallback)
     {
         ScopedID id(item->uuid);
         if (ImGui::BeginDragDropTarget())
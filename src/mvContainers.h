@@ -75,13 +75,13 @@ namespace DearPyGui
 
 struct mvMenuConfig
 {
-    std::shared_ptr<bool> value = std::make_shared<bool>(false);
+    std::shared_ptr<bool> value = mvAllocateShared<bool>(false);
     bool        _disabled_value = false;
 };
 
 struct mvTabConfig
 {
-    std::shared_ptr<bool>       value = std::make_shared<bool>(false);
+    std::shared_ptr<bool>       value = mvAllocateShared<bool>(false);
     bool              closable = false;
     bool              _disabled_value = false;
     ImGuiTabItemFlags _flags = ImGuiTabItemFlags_None;
@@ -104,7 +104,7 @@ struct mvChildWindowConfig
 
 struct mvTreeNodeConfig
 {
-    std::shared_ptr<bool>        value = std::make_shared<bool>(false);
+    std::shared_ptr<bool>        value = mvAllocateShared<bool>(false);
     bool               disabled_value = false;
     ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_None;
     bool               selectable = false;
@@ -120,13 +120,13 @@ struct mvGroupConfig
 struct mvDragPayloadConfig
 {
     std::string payloadType = "$$DPG_PAYLOAD";
-    std::shared_ptr<mvPyObject> dragData = std::make_shared<mvPyObject>(nullptr);
-    std::shared_ptr<mvPyObject> dropData = std::make_shared<mvPyObject>(nullptr);
+    std::shared_ptr<mvPyObject> dragData = mvAllocateShared<mvPyObject>(nullptr);
+    std::shared_ptr<mvPyObject> dropData = mvAllocateShared<mvPyObject>(nullptr);
 };
 
 struct mvCollapsingHeaderConfig
 {
-    std::shared_ptr<bool>        value = std::make_shared<bool>(false);
+    std::shared_ptr<bool>        value = mvAllocateShared<bool>(false);
     bool               disabled_value = false;
     ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_None;
     bool               closable = false;
@@ -134,7 +134,7 @@ struct mvCollapsingHeaderConfig
 
 struct mvTabBarConfig
 {
-    std::shared_ptr<mvUUID>    value = std::make_shared<mvUUID>(0);
+    std::shared_ptr<mvUUID>    value = mvAllocateShared<mvUUID>(0);
     mvUUID           disabled_value = 0;
     ImGuiTabBarFlags flags = ImGuiTabBarFlags_None;
     mvUUID           uiValue = 0; // value suggested from UI
@@ -152,7 +152,7 @@ struct mvWindowAppItemConfig
     bool             collapsed = false;
     bool             no_open_over_existing_popup = true;
     bool             copy_contents_shortcut = false;
-    mvPyObject       on_close = nullptr;
+    mvPyCallback     on_close = nullptr;
     mvVec2           min_size = { 100.0f, 100.0f };
     mvVec2           max_size = { 30000.0f, 30000.0f };
     bool             _collapsedDirty = true;
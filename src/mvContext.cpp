@@ -15,8 +15,10 @@
 
 #include <thread>
 #include <future>
+#include <cmath>
 #include <thread>
 #include <implot.h>
+#include <imgui_internal.h>
 #include <frameobject.h>
 #include <imnodes.h>
 #include <stb_image.h>
@@ -75,6 +77,8 @@ UpdateInputs(mvInput& input)
 mvUUID 
 GenerateUUID() 
 { 
+    // Nothing says a UUID from generate_uuid() will ever be used, so it doesn't
+    // get a registry slot; items created with it are kept in taggedItems.
     return ++GContext->id; 
 }
 
@@ -166,6 +170,17 @@ SetDefaultTheme()
 
 }
 
+// Whether ImGui is in the middle of something that keeps changing without
+// input, so that wait_for_input must keep rendering.
+static b8
+IsAnimating()
+{
+    ImGuiContext& g = *GImGui;
+    return g.ActiveId != 0                 // dragging, text input with a blinking cursor, etc.
+        || g.DragDropActive
+        || g.NavWindowingTarget != nullptr;  // the Ctrl+Tab window list
+}
+
 void 
 Render()
 {
@@ -173,6 +188,9 @@ Render()
     // for API calls.
     std::lock_guard lk(GContext->mutex);
 
+    GContext->framesRendered++;
+    GContext->lastFrameTime = std::chrono::steady_clock::now();
+
     // update timing
     GContext->deltaTime = ImGui::GetIO().DeltaTime;
     GContext->time = ImGui::GetTime();
@@ -188,6 +206,7 @@ Render()
         ImGui::DockSpaceOverViewport();
 
     mvFrameCallback(ImGui::GetFrameCount());
+    mvRunTimers();
 
     // route input callbacks
     UpdateInputs(GContext->input);
@@ -204,6 +223,9 @@ Render()
     RenderItemRegistry(*GContext->itemRegistry);
     mvRunTasks();
 
+    if (GContext->IO.waitForInput && IsAnimating())
+        mvRequestRedraw();
+
     // release split_frame if it's waiting for the frame end
     {
         std::lock_guard lk(GContext->frameEndedMutex);
@@ -218,6 +240,44 @@ GetParsers()
     return const_cast<std::map<std::string, mvPythonParser>&>(GetModuleParsers());
 }
 
+// Flat tables pointing into the parser map (map nodes never move), resolved
+// once on first use during module init so hot paths skip the string lookup.
+static const mvPythonParser**
+GetParserTable()
+{
+    static const mvPythonParser* table[(size_t)mvAppItemType::ItemTypeCount + (size_t)mvCommand::CommandCount] = {};
+    static bool initialized = false;
+
+    if (!initialized)
+    {
+        const auto& parsers = GetModuleParsers();
+
+        #define X(el) table[(size_t)mvAppItemType::el] = &parsers.at(GetEntityCommand(mvAppItemType::el));
+        MV_ITEM_TYPES
+        #undef X
+
+        #define X(el) table[(size_t)mvAppItemType::ItemTypeCount + (size_t)mvCommand::el] = &parsers.at(#el);
+        MV_COMMANDS
+        #undef X
+
+        initialized = true;
+    }
+
+    return table;
+}
+
+const mvPythonParser&
+GetItemParser(mvAppItemType type)
+{
+    return *GetParserTable()[(size_t)type];
+}
+
+const mvPythonParser&
+GetCommandParser(mvCommand command)
+{
+    return *GetParserTable()[(size_t)mvAppItemType::ItemTypeCount + (size_t)command];
+}
+
 void StopRendering()
 {
     // While it may seem reasonable to set it to false with frameEndedMutex locked
@@ -236,6 +296,180 @@ void StopRendering()
     GContext->frameEndedEvent.notify_all();
 }
 
+void
+mvRequestRedraw()
+{
+    // Only the first request since the last frame needs to wake the loop up
+    if (!GContext->redrawRequested.exchange(true) && GContext->IO.waitForInput
+        && GContext->viewport && GContext->viewport->shown)
+        mvWakeViewport(*GContext->viewport);
+}
+
+static double
+SecondsSinceLastFrame()
+{
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - GContext->lastFrameTime;
+    return elapsed.count();
+}
+
+double
+mvTimeToNextFrame()
+{
+    if (GContext->redrawRequested || GContext->settleFrames > 0)
+        return 0.0;
+
+    // Timers must still fire while there's no input
+    double timeout = mvTimeToNextTimer();
+    if (GContext->IO.maxIdleInterval > 0.0f)
+    {
+        double idle = std::max(GContext->IO.maxIdleInterval - SecondsSinceLastFrame(), 0.0);
+        timeout = timeout < 0.0 ? idle : std::min(timeout, idle);
+    }
+    return timeout;
+}
+
+b8
+mvFrameNeeded()
+{
+    // After a change, ImGui needs a couple more frames to settle: hover states
+    // lag a frame behind, auto-sized windows and tables take two to lay out.
+    constexpr int settleFrameCount = 2;
+
+    if (GContext->redrawRequested.exchange(false) || GImGui->InputEventsQueue.Size > 0 || GContext->viewport->resized)
+    {
+        GContext->settleFrames = settleFrameCount;
+        return true;
+    }
+
+    if (GContext->settleFrames > 0)
+    {
+        GContext->settleFrames--;
+        return true;
+    }
+
+    return mvTimeToNextTimer() == 0.0
+        || (GContext->IO.maxIdleInterval > 0.0f && SecondsSinceLastFrame() >= GContext->IO.maxIdleInterval);
+}
+
+void
+mvPaceFrame(u32 maxFps)
+{
+    MV_PROFILE_SCOPE("Frame Pacing")
+
+    using clock = std::chrono::steady_clock;
+    mvFramePacer& pacer = GContext->pacer;
+
+    clock::duration period = clock::duration::zero();
+    if (maxFps > 0)
+    {
+        period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(1.0 / maxFps));
+
+        // Start over if we're more than a frame late (or the cap got raised)
+        // rather than rushing through frames to catch up.
+        auto now = clock::now();
+        pacer.deadline += period;
+        if (pacer.deadline < now - period || pacer.deadline > now + period)
+            pacer.deadline = now;
+
+        // sleep_for tends to wake up late, so sleep through most of the wait
+        // and spin for the rest
+        auto margin = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(
+            std::clamp(2.0 * pacer.sleepOvershoot, 0.0002, 0.002)));
+        if (pacer.deadline - now > margin)
+        {
+            auto request = pacer.deadline - now - margin;
+            std::this_thread::sleep_for(request);
+            std::chrono::duration<double> overshoot = clock::now() - now - request;
+            pacer.sleepOvershoot += (std::max(overshoot.count(), 0.0) - pacer.sleepOvershoot) / 8.0;
+        }
+        while (clock::now() < pacer.deadline)
+            std::this_thread::yield();
+    }
+
+    auto now = clock::now();
+    std::chrono::duration<double> elapsed = now - pacer.lastFrame;
+    pacer.lastFrame = now;
+
+    // longer pauses (wait_for_input being idle, a stall) aren't frame times
+    double frameTime = elapsed.count();
+    if (frameTime > 0.25)
+        return;
+
+    // only this thread writes them, so plain loads and stores will do
+    double average = pacer.frameTime.load(std::memory_order_relaxed);
+    if (average == 0.0)
+        average = frameTime;
+    average += (frameTime - average) / 16.0;
+    pacer.frameTime.store(average, std::memory_order_relaxed);
+
+    double target = maxFps > 0 ? std::chrono::duration<double>(period).count() : average;
+    double jitter = pacer.jitter.load(std::memory_order_relaxed);
+    pacer.jitter.store(jitter + (std::abs(frameTime - target) - jitter) / 16.0, std::memory_order_relaxed);
+}
+
+void
+mvRecordDrawStats(ImDrawData* drawData)
+{
+    i64 vertices = 0;
+    i64 indices = 0;
+    i64 drawCommands = 0;
+    i64 textureBinds = 0;
+
+    ImTextureRef texture;
+    for (int i = 0; i < drawData->CmdListsCount; i++)
+    {
+        const ImDrawList* drawList = drawData->CmdLists[i];
+        vertices += drawList->VtxBuffer.Size;
+        indices += drawList->IdxBuffer.Size;
+        for (const ImDrawCmd& cmd : drawList->CmdBuffer)
+        {
+            if (cmd.UserCallback)
+                continue;
+            drawCommands++;
+            // not GetTexID(): it asserts on textures that were never uploaded,
+            // and with null_renderer nothing is
+            if (textureBinds == 0 || cmd.TexRef._TexData != texture._TexData || cmd.TexRef._TexID != texture._TexID)
+            {
+                texture = cmd.TexRef;
+                textureBinds++;
+            }
+        }
+    }
+
+    mvDrawStats& stats = GContext->drawStats;
+    stats.drawLists = drawData->CmdListsCount;
+    stats.vertices = vertices;
+    stats.indices = indices;
+    stats.drawCommands = drawCommands;
+    stats.textureBinds = textureBinds;
+}
+
+void
+mvSkipDrawData(ImDrawData* drawData)
+{
+    if (drawData->Textures == nullptr)
+        return;
+
+    // Texture requests are normally served by the renderer backend while it
+    // draws. Without one, they are acknowledged here with a dummy id so that
+    // ImGui (e.g. the font atlas) doesn't keep asking every frame.
+    for (ImTextureData* tex : *drawData->Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            tex->SetTexID((ImTextureID)(intptr_t)1);
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+            tex->SetStatus(ImTextureStatus_OK);
+        else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+}
+
 void 
 InsertConstants_mvContext(std::vector<std::pair<std::string, long>>& constants)
 {
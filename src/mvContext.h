@@ -6,10 +6,12 @@
 #include <future>
 #include <atomic>
 #include <memory>
+#include <chrono>
 #include "mvCore.h"
 #include "mvPyUtils.h"
 #include "mvTypes.h"
 #include "mvGraphics.h"
+#include "mvCommands.inc"
 
 //-----------------------------------------------------------------------------
 // forward declarations
@@ -20,6 +22,18 @@ struct mvItemRegistry;
 struct mvIO;
 struct mvContext;
 struct mvInput;
+enum class mvAppItemType;
+
+//-----------------------------------------------------------------------------
+// mvCommand
+//-----------------------------------------------------------------------------
+enum class mvCommand
+{
+    #define X(el) el,
+    MV_COMMANDS
+    #undef X
+    CommandCount
+};
 
 //-----------------------------------------------------------------------------
 // public API
@@ -30,10 +44,29 @@ extern mvContext* GContext;
 mvUUID                                 GenerateUUID();
 void                                   SetDefaultTheme();
 void                                   Render();
-std::map<std::string, mvPythonParser>& GetParsers();
+std::map<std::string, mvPythonParser>& GetParsers(); // keyed by name, for docs/stub generation
+const mvPythonParser&                  GetItemParser(mvAppItemType type);
+const mvPythonParser&                  GetCommandParser(mvCommand command);
 // Signals the rendering loop via GContext->running to quit.
 void                                   StopRendering();
 
+// Event-driven rendering (wait_for_input)
+// Asks for another frame; wakes the render loop up if it's waiting. Thread-safe.
+void                                   mvRequestRedraw();
+// Used by the viewports: how long to wait for events before the next frame
+// (0 = don't wait, negative = until an event arrives), and whether the events
+// that came in (if any) need a frame at all.
+double                                 mvTimeToNextFrame();
+b8                                     mvFrameNeeded();
+// Called after a frame has been presented: waits until the next frame is due
+// with a frame rate cap (0 = none), and keeps the frame time statistics.
+void                                   mvPaceFrame(u32 maxFps);
+// Called by the backends right after ImGui::Render().
+void                                   mvRecordDrawStats(ImDrawData* drawData);
+// Called instead of the renderer backend with null_renderer: only serves the
+// texture requests of the draw data, with dummy textures.
+void                                   mvSkipDrawData(ImDrawData* drawData);
+
 struct mvInput
 {
     struct AtomicVec2
@@ -78,6 +111,8 @@ struct mvIO
     bool        loadIniFile = false;
     bool        autoSaveIniFile = false;
     bool        waitForInput = false;
+    float       maxIdleInterval = 0.0f;  // with waitForInput, seconds without a frame before one is rendered anyway (0 = no limit)
+    bool        nullRenderer = false;    // draw data isn't handed to the renderer backend (to measure the CPU side)
 
     // GPU selection
     bool        info_auto_device = false;
@@ -90,6 +125,10 @@ struct mvIO
     bool skipRequiredArgs = false;
     bool skipPositionalArgs = false;
     bool skipKeywordArgs = false;
+    bool skipKeywordValidation = false;
+    int  deferredDeletionThreshold = 1000; // subtrees this large are destroyed over several frames (0 = never)
+    int  deletionBudget = 2000;            // items destroyed per frame
+    bool commandBuffer = false;            // set_value/configure_item don't wait for the frame to end
 
     // callback registry
     bool manualCallbacks = false;
@@ -99,6 +138,37 @@ struct mvIO
     ImWchar decimalPoint = '.';
 };
 
+//-----------------------------------------------------------------------------
+// mvFramePacer
+//     - State of the frame rate cap and frame time statistics (mvPaceFrame).
+//       Frames are paced against absolute deadlines, so that a late frame
+//       doesn't delay all the following ones.
+//-----------------------------------------------------------------------------
+
+struct mvFramePacer
+{
+    std::chrono::steady_clock::time_point deadline;   // when the next frame is due
+    std::chrono::steady_clock::time_point lastFrame;
+    double sleepOvershoot = 0.0;  // how late sleep_for tends to wake up, seconds
+    // written by the render thread, read by get_render_stats
+    std::atomic<double> frameTime = 0.0;  // smoothed time between frames, seconds
+    std::atomic<double> jitter    = 0.0;  // smoothed deviation of frame times from the target (or average), seconds
+};
+
+//-----------------------------------------------------------------------------
+// mvDrawStats
+//     - Size of the draw data of the last frame (mvRecordDrawStats).
+//-----------------------------------------------------------------------------
+
+struct mvDrawStats
+{
+    std::atomic<i64> drawLists    = 0;
+    std::atomic<i64> vertices     = 0;
+    std::atomic<i64> indices      = 0;
+    std::atomic<i64> drawCommands = 0;
+    std::atomic<i64> textureBinds = 0; // draw commands using another texture than the one before
+};
+
 struct mvContext
 {
     std::mutex          frameEndedMutex;
@@ -115,7 +185,7 @@ struct mvContext
     double              time      = 0.0;    // total time since starting
     int                 frame     = 0;      // frame count
     int                 framerate = 0;      // frame rate
-    std::atomic<mvUUID> id = MV_START_UUID; // current ID
+    std::atomic<mvUUID> id = MV_START_UUID; // last UUID made by GenerateUUID
     mvViewport*         viewport = nullptr;
     mvGraphics          graphics;
     bool                resetTheme = false;
@@ -126,6 +196,16 @@ struct mvContext
     mvUUID              activeWindow = 0;
     mvUUID              focusedItem = 0;
 
+    // event-driven rendering (see mvRequestRedraw)
+    std::atomic_bool    redrawRequested = true;
+    int                 settleFrames = 0;   // frames still to render after the last change
+    std::chrono::steady_clock::time_point lastFrameTime;
+    std::atomic<i64>    framesRendered = 0;
+    std::atomic<i64>    framesSkipped = 0;  // render_dearpygui_frame calls that didn't render anything
+
+    mvFramePacer        pacer;
+    mvDrawStats         drawStats;
+
 };
     
 //-----------------------------------------------------------------------------
@@ -78,3 +78,6 @@ struct mvColor
 #define MV_RESERVED_UUIDs 11
 #define MV_RESERVED_UUID_start MV_TOOL_FONT_UUID+1
 #define MV_START_UUID MV_TOOL_FONT_UUID+MV_RESERVED_UUIDs+1
+// UUIDs made by ReserveItemSlot: flag | slot generation << 32 | slot index (see mvItemSlot)
+#define MV_SLOT_UUID_FLAG (1ull << 62)
+#define MV_SLOT_GENERATION_MASK 0x3FFFFFFFu
@@ -107,11 +107,16 @@ void mvDatePicker::handleSpecificKeywordArgs(PyObject* dict)
 {
 	if (dict == nullptr)
 		return;
-		 
-	if (PyObject* item = PyDict_GetItemString(dict, "level")) {
-		_level = ToInt(item);
-		if (_level > 2) _level = 0;
-	}
+
+	static const mvKeywordTable<mvDatePicker> keywords = {
+		{ "level", [](mvDatePicker& self, PyObject* item)
+			{
+				self._level = ToInt(item);
+				if (self._level > 2) self._level = 0;
+			} },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvDatePicker::getSpecificConfiguration(PyObject* dict)
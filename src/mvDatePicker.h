@@ -27,8 +27,8 @@ public:
 
 private:
 
-    std::shared_ptr<tm>         _value = std::make_shared<tm>();
-    std::shared_ptr<ImPlotTime> _imvalue = std::make_shared<ImPlotTime>();
+    std::shared_ptr<tm>         _value = mvAllocateShared<tm>();
+    std::shared_ptr<ImPlotTime> _imvalue = mvAllocateShared<ImPlotTime>();
     int               _level = 0;
 
 };
\ No newline at end of file
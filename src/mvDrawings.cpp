@@ -114,7 +114,7 @@ void mvDrawArrow::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawArrow::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_p1 = ToVec4(PyTuple_GetItem(dict, 0));
@@ -130,12 +130,15 @@ void mvDrawArrow::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
+	static const mvKeywordTable<mvDrawArrow> keywords = {
+		{ "p1", [](mvDrawArrow& self, PyObject* item) { self._p1 = ToVec4(item); } },
+		{ "p2", [](mvDrawArrow& self, PyObject* item) { self._p2 = ToVec4(item); } },
+		{ "color", [](mvDrawArrow& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "thickness", [](mvDrawArrow& self, PyObject* item) { self._thickness = ToFloat(item); } },
+		{ "size", [](mvDrawArrow& self, PyObject* item) { self._size = ToFloat(item); } },
+	};
 
-	if (PyObject* item = PyDict_GetItemString(dict, "p1")) _p1 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p2")) _p2 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "size")) _size = ToFloat(item);
+	keywords.apply(dict, *this);
 
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
@@ -204,7 +207,7 @@ void mvDrawBezierCubic::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawBezierCubic::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_p1 = ToVec4(PyTuple_GetItem(dict, 0));
@@ -222,13 +225,17 @@ void mvDrawBezierCubic::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "p1")) _p1 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p2")) _p2 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p3")) _p3 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p4")) _p4 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "segments")) _segments = ToInt(item);
+	static const mvKeywordTable<mvDrawBezierCubic> keywords = {
+		{ "p1", [](mvDrawBezierCubic& self, PyObject* item) { self._p1 = ToVec4(item); } },
+		{ "p2", [](mvDrawBezierCubic& self, PyObject* item) { self._p2 = ToVec4(item); } },
+		{ "p3", [](mvDrawBezierCubic& self, PyObject* item) { self._p3 = ToVec4(item); } },
+		{ "p4", [](mvDrawBezierCubic& self, PyObject* item) { self._p4 = ToVec4(item); } },
+		{ "color", [](mvDrawBezierCubic& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "thickness", [](mvDrawBezierCubic& self, PyObject* item) { self._thickness = ToFloat(item); } },
+		{ "segments", [](mvDrawBezierCubic& self, PyObject* item) { self._segments = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
@@ -293,7 +300,7 @@ void mvDrawBezierQuadratic::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawBezierQuadratic::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_p1 = ToVec4(PyTuple_GetItem(dict, 0));
@@ -309,12 +316,16 @@ void mvDrawBezierQuadratic::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "p1")) _p1 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p2")) _p2 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p3")) _p3 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "segments")) _segments = ToInt(item);
+	static const mvKeywordTable<mvDrawBezierQuadratic> keywords = {
+		{ "p1", [](mvDrawBezierQuadratic& self, PyObject* item) { self._p1 = ToVec4(item); } },
+		{ "p2", [](mvDrawBezierQuadratic& self, PyObject* item) { self._p2 = ToVec4(item); } },
+		{ "p3", [](mvDrawBezierQuadratic& self, PyObject* item) { self._p3 = ToVec4(item); } },
+		{ "color", [](mvDrawBezierQuadratic& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "thickness", [](mvDrawBezierQuadratic& self, PyObject* item) { self._thickness = ToFloat(item); } },
+		{ "segments", [](mvDrawBezierQuadratic& self, PyObject* item) { self._segments = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
@@ -368,7 +379,7 @@ void mvDrawCircle::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawCircle::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_center = ToVec4(PyTuple_GetItem(dict, 0));
@@ -381,13 +392,16 @@ void mvDrawCircle::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
+	static const mvKeywordTable<mvDrawCircle> keywords = {
+		{ "center", [](mvDrawCircle& self, PyObject* item) { self._center = ToVec4(item); } },
+		{ "color", [](mvDrawCircle& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "fill", [](mvDrawCircle& self, PyObject* item) { self._fill = ToColor(item); } },
+		{ "thickness", [](mvDrawCircle& self, PyObject* item) { self._thickness = ToFloat(item); } },
+		{ "radius", [](mvDrawCircle& self, PyObject* item) { self._radius = ToFloat(item); } },
+		{ "segments", [](mvDrawCircle& self, PyObject* item) { self._segments = ToInt(item); } },
+	};
 
-	if (PyObject* item = PyDict_GetItemString(dict, "center")) _center = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "fill")) _fill = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "radius")) _radius = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "segments")) _segments = ToInt(item);
+	keywords.apply(dict, *this);
 
 	_center.w = 1.0f;
 }
@@ -488,7 +502,7 @@ void mvDrawEllipse::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawEllipse::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_pmin = ToVec4(PyTuple_GetItem(dict, 0));
@@ -503,13 +517,16 @@ void mvDrawEllipse::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
+	static const mvKeywordTable<mvDrawEllipse> keywords = {
+		{ "color", [](mvDrawEllipse& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "fill", [](mvDrawEllipse& self, PyObject* item) { self._fill = ToColor(item); } },
+		{ "thickness", [](mvDrawEllipse& self, PyObject* item) { self._thickness = ToFloat(item); } },
+		{ "pmax", [](mvDrawEllipse& self, PyObject* item) { self._pmax = ToVec4(item); self._dirty = true; } },
+		{ "pmin", [](mvDrawEllipse& self, PyObject* item) { self._pmin = ToVec4(item); self._dirty = true; } },
+		{ "segments", [](mvDrawEllipse& self, PyObject* item) { self._segments = ToInt(item); } },
+	};
 
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "fill")) _fill = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "pmax")) { _pmax = ToVec4(item); _dirty = true; }
-	if (PyObject* item = PyDict_GetItemString(dict, "pmin")) { _pmin = ToVec4(item); _dirty = true; }
-	if (PyObject* item = PyDict_GetItemString(dict, "segments")) _segments = ToInt(item);
+	keywords.apply(dict, *this);
 
 	_pmin.w = 1.0f;
 	_pmax.w = 1.0f;
@@ -573,7 +590,7 @@ void mvDrawImage::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawImage::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	mvUUID _textureUUID = GetIDFromPyObject(PyTuple_GetItem(dict, 0));
@@ -599,25 +616,29 @@ void mvDrawImage::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "pmax")) _pmax = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "pmin")) _pmin = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "uv_min")) _uv_min = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "uv_max")) _uv_max = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "texture_tag"))
-	{
-		mvUUID _textureUUID = GetIDFromPyObject(item);
-		if (_textureUUID == MV_ATLAS_UUID)
-		{
-			_texture = std::make_shared<mvStaticTexture>(_textureUUID);
-		}
-		else
-		{
-			_texture = GetRefItem(*GContext->itemRegistry, _textureUUID);
-			if (!_texture)
-				mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(type), "Texture not found.", this);
-		}
-	}
+	static const mvKeywordTable<mvDrawImage> keywords = {
+		{ "pmax", [](mvDrawImage& self, PyObject* item) { self._pmax = ToVec4(item); } },
+		{ "pmin", [](mvDrawImage& self, PyObject* item) { self._pmin = ToVec4(item); } },
+		{ "uv_min", [](mvDrawImage& self, PyObject* item) { self._uv_min = ToVec2(item); } },
+		{ "uv_max", [](mvDrawImage& self, PyObject* item) { self._uv_max = ToVec2(item); } },
+		{ "color", [](mvDrawImage& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "texture_tag", [](mvDrawImage& self, PyObject* item)
+			{
+				mvUUID _textureUUID = GetIDFromPyObject(item);
+				if (_textureUUID == MV_ATLAS_UUID)
+				{
+					self._texture = std::make_shared<mvStaticTexture>(_textureUUID);
+				}
+				else
+				{
+					self._texture = GetRefItem(*GContext->itemRegistry, _textureUUID);
+					if (!self._texture)
+						mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(self.type), "Texture not found.", &self);
+				}
+			} },
+	};
+
+	keywords.apply(dict, *this);
 
 	_pmin.w = 1.0f;
 	_pmax.w = 1.0f;
@@ -693,7 +714,7 @@ void mvDrawImageQuad::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawImageQuad::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	mvUUID _textureUUID = GetIDFromPyObject(PyTuple_GetItem(dict, 0));
@@ -724,29 +745,33 @@ void mvDrawImageQuad::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "p1")) _p1 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p2")) _p2 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p3")) _p3 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p4")) _p4 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "uv1")) _uv1 = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "uv2")) _uv2 = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "uv3")) _uv3 = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "uv4")) _uv4 = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "texture_tag"))
-	{
-		mvUUID _textureUUID = GetIDFromPyObject(item);
-		if (_textureUUID == MV_ATLAS_UUID)
-		{
-			_texture = std::make_shared<mvStaticTexture>(_textureUUID);
-		}
-		else
-		{
-			_texture = GetRefItem(*GContext->itemRegistry, _textureUUID);
-			if (!_texture)
-				mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(type), "Texture not found.", this);
-		}
-	}
+	static const mvKeywordTable<mvDrawImageQuad> keywords = {
+		{ "p1", [](mvDrawImageQuad& self, PyObject* item) { self._p1 = ToVec4(item); } },
+		{ "p2", [](mvDrawImageQuad& self, PyObject* item) { self._p2 = ToVec4(item); } },
+		{ "p3", [](mvDrawImageQuad& self, PyObject* item) { self._p3 = ToVec4(item); } },
+		{ "p4", [](mvDrawImageQuad& self, PyObject* item) { self._p4 = ToVec4(item); } },
+		{ "uv1", [](mvDrawImageQuad& self, PyObject* item) { self._uv1 = ToVec2(item); } },
+		{ "uv2", [](mvDrawImageQuad& self, PyObject* item) { self._uv2 = ToVec2(item); } },
+		{ "uv3", [](mvDrawImageQuad& self, PyObject* item) { self._uv3 = ToVec2(item); } },
+		{ "uv4", [](mvDrawImageQuad& self, PyObject* item) { self._uv4 = ToVec2(item); } },
+		{ "color", [](mvDrawImageQuad& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "texture_tag", [](mvDrawImageQuad& self, PyObject* item)
+			{
+				mvUUID _textureUUID = GetIDFromPyObject(item);
+				if (_textureUUID == MV_ATLAS_UUID)
+				{
+					self._texture = std::make_shared<mvStaticTexture>(_textureUUID);
+				}
+				else
+				{
+					self._texture = GetRefItem(*GContext->itemRegistry, _textureUUID);
+					if (!self._texture)
+						mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(self.type), "Texture not found.", &self);
+				}
+			} },
+	};
+
+	keywords.apply(dict, *this);
 
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
@@ -807,9 +832,13 @@ void mvDrawLayer::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "perspective_divide")) drawInfo->perspectiveDivide = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "depth_clipping")) drawInfo->depthClipping = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "cull_mode")) drawInfo->cullMode = ToInt(item);
+	static const mvKeywordTable<mvDrawLayer> keywords = {
+		{ "perspective_divide", [](mvDrawLayer& self, PyObject* item) { self.drawInfo->perspectiveDivide = ToBool(item); } },
+		{ "depth_clipping", [](mvDrawLayer& self, PyObject* item) { self.drawInfo->depthClipping = ToBool(item); } },
+		{ "cull_mode", [](mvDrawLayer& self, PyObject* item) { self.drawInfo->cullMode = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 }
 
@@ -859,7 +888,7 @@ void mvDrawLine::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawLine::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_p1 = ToVec4(PyTuple_GetItem(dict, 0));
@@ -874,11 +903,14 @@ void mvDrawLine::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
+	static const mvKeywordTable<mvDrawLine> keywords = {
+		{ "p1", [](mvDrawLine& self, PyObject* item) { self._p1 = ToVec4(item); } },
+		{ "p2", [](mvDrawLine& self, PyObject* item) { self._p2 = ToVec4(item); } },
+		{ "color", [](mvDrawLine& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "thickness", [](mvDrawLine& self, PyObject* item) { self._thickness = ToFloat(item); } },
+	};
 
-	if (PyObject* item = PyDict_GetItemString(dict, "p1")) _p1 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p2")) _p2 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
+	keywords.apply(dict, *this);
 
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
@@ -941,7 +973,7 @@ void mvDrawlist::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawlist::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	config.width = ToInt(PyTuple_GetItem(dict, 0));
@@ -1136,7 +1168,7 @@ void mvDrawPolygon::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawPolygon::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_points = ToVectVec4(PyTuple_GetItem(dict, 0));
@@ -1149,10 +1181,14 @@ void mvDrawPolygon::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "points")) _points = ToVectVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "fill")) _fill = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
+	static const mvKeywordTable<mvDrawPolygon> keywords = {
+		{ "points", [](mvDrawPolygon& self, PyObject* item) { self._points = ToVectVec4(item); } },
+		{ "fill", [](mvDrawPolygon& self, PyObject* item) { self._fill = ToColor(item); } },
+		{ "color", [](mvDrawPolygon& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "thickness", [](mvDrawPolygon& self, PyObject* item) { self._thickness = ToFloat(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	for (auto& point : _points)
 		point.w = 1.0f;
@@ -1231,7 +1267,7 @@ void mvDrawPolyline::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawPolyline::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_points = ToVectVec4(PyTuple_GetItem(dict, 0));
@@ -1242,10 +1278,14 @@ void mvDrawPolyline::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "points")) _points = ToVectVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "closed")) _closed = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
+	static const mvKeywordTable<mvDrawPolyline> keywords = {
+		{ "points", [](mvDrawPolyline& self, PyObject* item) { self._points = ToVectVec4(item); } },
+		{ "closed", [](mvDrawPolyline& self, PyObject* item) { self._closed = ToBool(item); } },
+		{ "color", [](mvDrawPolyline& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "thickness", [](mvDrawPolyline& self, PyObject* item) { self._thickness = ToFloat(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	for (auto& point : _points)
 		point.w = 1.0f;
@@ -1316,7 +1356,7 @@ void mvDrawQuad::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawQuad::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_p1 = ToVec4(PyTuple_GetItem(dict, 0));
@@ -1334,20 +1374,23 @@ void mvDrawQuad::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "p1")) _p1 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p2")) _p2 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p3")) _p3 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p4")) _p4 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "fill")) _fill = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
+	static const mvKeywordTable<mvDrawQuad> keywords = {
+		{ "p1", [](mvDrawQuad& self, PyObject* item) { self._p1 = ToVec4(item); } },
+		{ "p2", [](mvDrawQuad& self, PyObject* item) { self._p2 = ToVec4(item); } },
+		{ "p3", [](mvDrawQuad& self, PyObject* item) { self._p3 = ToVec4(item); } },
+		{ "p4", [](mvDrawQuad& self, PyObject* item) { self._p4 = ToVec4(item); } },
+		{ "color", [](mvDrawQuad& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "fill", [](mvDrawQuad& self, PyObject* item) { self._fill = ToColor(item); } },
+		{ "thickness", [](mvDrawQuad& self, PyObject* item) { self._thickness = ToFloat(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
 	_p3.w = 1.0f;
 	_p4.w = 1.0f;
 
-
 }
 
 void mvDrawQuad::getSpecificConfiguration(PyObject* dict)
@@ -1409,7 +1452,7 @@ void mvDrawRect::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawRect::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_pmin = ToVec4(PyTuple_GetItem(dict, 0));
@@ -1423,52 +1466,56 @@ void mvDrawRect::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "pmax")) _pmax = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "pmin")) _pmin = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color_upper_left")) _color_upper_left = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color_upper_right")) _color_upper_right = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color_bottom_left")) _color_bottom_left = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color_bottom_right")) _color_bottom_right = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "fill")) _fill = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "rounding")) _rounding = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "multicolor")) _multicolor = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "corner_colors"))
-	{
-        if (item != Py_None)
-		{
-            if (PyTuple_Check(item))
-			{
-				if (PyTuple_Size(item) != 4)
-					mvThrowPythonError(mvErrorCode::mvNone, "The corner_colors parm on draw_rectangle must contain 4 colors.");
-				else
-				{
-					// Note: the variables are named incorrectly, e.g. _color_bottom_right
-					// actually controls upper-left corner.  That's how old Python parms
-					// were named so we're keeping the names for a while until we drop the
-					// old parms altogether (if this ever happens).
-					// For now, we're just filling them in appropriate order.
-					_color_bottom_right = ToColor(PyTuple_GetItem(item, 0));
-					_color_bottom_left = ToColor(PyTuple_GetItem(item, 1));
-					_color_upper_left = ToColor(PyTuple_GetItem(item, 2));
-					_color_upper_right = ToColor(PyTuple_GetItem(item, 3));
-				}
-			}
-            else if (PyList_Check(item))
+	static const mvKeywordTable<mvDrawRect> keywords = {
+		{ "pmax", [](mvDrawRect& self, PyObject* item) { self._pmax = ToVec4(item); } },
+		{ "pmin", [](mvDrawRect& self, PyObject* item) { self._pmin = ToVec4(item); } },
+		{ "color", [](mvDrawRect& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "color_upper_left", [](mvDrawRect& self, PyObject* item) { self._color_upper_left = ToColor(item); } },
+		{ "color_upper_right", [](mvDrawRect& self, PyObject* item) { self._color_upper_right = ToColor(item); } },
+		{ "color_bottom_left", [](mvDrawRect& self, PyObject* item) { self._color_bottom_left = ToColor(item); } },
+		{ "color_bottom_right", [](mvDrawRect& self, PyObject* item) { self._color_bottom_right = ToColor(item); } },
+		{ "fill", [](mvDrawRect& self, PyObject* item) { self._fill = ToColor(item); } },
+		{ "rounding", [](mvDrawRect& self, PyObject* item) { self._rounding = ToFloat(item); } },
+		{ "thickness", [](mvDrawRect& self, PyObject* item) { self._thickness = ToFloat(item); } },
+		{ "multicolor", [](mvDrawRect& self, PyObject* item) { self._multicolor = ToBool(item); } },
+		{ "corner_colors", [](mvDrawRect& self, PyObject* item)
 			{
-				if (PyList_Size(item) != 4)
-					mvThrowPythonError(mvErrorCode::mvNone, "The corner_colors parm on draw_rectangle must contain 4 colors.");
-				else
+				if (item != Py_None)
 				{
-					_color_bottom_right = ToColor(PyList_GetItem(item, 0));
-					_color_bottom_left = ToColor(PyList_GetItem(item, 1));
-					_color_upper_left = ToColor(PyList_GetItem(item, 2));
-					_color_upper_right = ToColor(PyList_GetItem(item, 3));
+					if (PyTuple_Check(item))
+					{
+						if (PyTuple_Size(item) != 4)
+							mvThrowPythonError(mvErrorCode::mvNone, "The corner_colors parm on draw_rectangle must contain 4 colors.");
+						else
+						{
+							// Note: the variables are named incorrectly, e.g. _color_bottom_right
+							// actually controls upper-left corner.  That's how old Python parms
+							// were named so we're keeping the names for a while until we drop the
+							// old parms altogether (if this ever happens).
+							// For now, we're just filling them in appropriate order.
+							self._color_bottom_right = ToColor(PyTuple_GetItem(item, 0));
+							self._color_bottom_left = ToColor(PyTuple_GetItem(item, 1));
+							self._color_upper_left = ToColor(PyTuple_GetItem(item, 2));
+							self._color_upper_right = ToColor(PyTuple_GetItem(item, 3));
+						}
+					}
+					else if (PyList_Check(item))
+					{
+						if (PyList_Size(item) != 4)
+							mvThrowPythonError(mvErrorCode::mvNone, "The corner_colors parm on draw_rectangle must contain 4 colors.");
+						else
+						{
+							self._color_bottom_right = ToColor(PyList_GetItem(item, 0));
+							self._color_bottom_left = ToColor(PyList_GetItem(item, 1));
+							self._color_upper_left = ToColor(PyList_GetItem(item, 2));
+							self._color_upper_right = ToColor(PyList_GetItem(item, 3));
+						}
+					}
 				}
-			}
-		}
-	}
+			} },
+	};
+
+	keywords.apply(dict, *this);
 
 	_pmin.w = 1.0f;
 	_pmax.w = 1.0f;
@@ -1524,7 +1571,7 @@ void mvDrawText::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawText::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_pos = ToVec4(PyTuple_GetItem(dict, 0));
@@ -1538,10 +1585,15 @@ void mvDrawText::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "text")) _text = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "pos")) _pos = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "size")) _size = ToFloat(item);
+	static const mvKeywordTable<mvDrawText> keywords = {
+		{ "text", [](mvDrawText& self, PyObject* item) { self._text = ToString(item); } },
+		{ "pos", [](mvDrawText& self, PyObject* item) { self._pos = ToVec4(item); } },
+		{ "color", [](mvDrawText& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "size", [](mvDrawText& self, PyObject* item) { self._size = ToFloat(item); } },
+	};
+
+	keywords.apply(dict, *this);
+
 	_pos.w = 1.0f;
 
 }
@@ -1623,7 +1675,7 @@ void mvDrawTriangle::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDrawTriangle::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_p1 = ToVec4(PyTuple_GetItem(dict, 0));
@@ -1639,13 +1691,17 @@ void mvDrawTriangle::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "p1")) _p1 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p2")) _p2 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "p3")) _p3 = ToVec4(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "fill")) _fill = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "cull_mode")) drawInfo->cullMode = ToInt(item);
+	static const mvKeywordTable<mvDrawTriangle> keywords = {
+		{ "p1", [](mvDrawTriangle& self, PyObject* item) { self._p1 = ToVec4(item); } },
+		{ "p2", [](mvDrawTriangle& self, PyObject* item) { self._p2 = ToVec4(item); } },
+		{ "p3", [](mvDrawTriangle& self, PyObject* item) { self._p3 = ToVec4(item); } },
+		{ "color", [](mvDrawTriangle& self, PyObject* item) { self._color = ToColor(item); } },
+		{ "fill", [](mvDrawTriangle& self, PyObject* item) { self._fill = ToColor(item); } },
+		{ "thickness", [](mvDrawTriangle& self, PyObject* item) { self._thickness = ToFloat(item); } },
+		{ "cull_mode", [](mvDrawTriangle& self, PyObject* item) { self.drawInfo->cullMode = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
@@ -1688,7 +1744,11 @@ void mvViewportDrawlist::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "front")) _front = ToBool(item);
+	static const mvKeywordTable<mvViewportDrawlist> keywords = {
+		{ "front", [](mvViewportDrawlist& self, PyObject* item) { self._front = ToBool(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 }
 
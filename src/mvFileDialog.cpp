@@ -168,28 +168,32 @@ void mvFileDialog::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "file_count")) _fileCount = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "default_filename")) _defaultFilename = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "default_path")) _defaultPath = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "modal")) _modal = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "directory_selector")) _directory = ToBool(item);
+	static const mvKeywordTable<mvFileDialog> keywords = {
+		{ "file_count", [](mvFileDialog& self, PyObject* item) { self._fileCount = ToInt(item); } },
+		{ "default_filename", [](mvFileDialog& self, PyObject* item) { self._defaultFilename = ToString(item); } },
+		{ "default_path", [](mvFileDialog& self, PyObject* item) { self._defaultPath = ToString(item); } },
+		{ "modal", [](mvFileDialog& self, PyObject* item) { self._modal = ToBool(item); } },
+		{ "directory_selector", [](mvFileDialog& self, PyObject* item) { self._directory = ToBool(item); } },
+
+		{ "min_size", [](mvFileDialog& self, PyObject* item)
+			{
+				auto min_size = ToIntVect(item);
+				self._min_size = { (float)min_size[0], (float)min_size[1] };
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(dict, "min_size"))
-	{
-		auto min_size = ToIntVect(item);
-		_min_size = { (float)min_size[0], (float)min_size[1] };
-	}
+		{ "max_size", [](mvFileDialog& self, PyObject* item)
+			{
+				auto max_size = ToIntVect(item);
+				self._max_size = { (float)max_size[0], (float)max_size[1] };
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(dict, "max_size"))
-	{
-		auto max_size = ToIntVect(item);
-		_max_size = { (float)max_size[0], (float)max_size[1] };
-	}
+		{ "cancel_callback", [](mvFileDialog& self, PyObject* item)
+			{
+				self._cancelCallback = mvPyCallback(item == Py_None? nullptr : item, true);
+			} },
+	};
 
-	if (PyObject* item = PyDict_GetItemString(dict, "cancel_callback"))
-	{
-		_cancelCallback = mvPyObject(item == Py_None? nullptr : item, true);
-	}
+	keywords.apply(dict, *this);
 
 }
 
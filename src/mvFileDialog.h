@@ -34,7 +34,7 @@ public:
 
 public:
 
-    std::shared_ptr<bool>     _value = std::make_shared<bool>(false);
+    std::shared_ptr<bool>     _value = mvAllocateShared<bool>(false);
     bool            _disabled_value = false;
     ImGuiFileDialog _instance;
     bool            _dirtySettings = true;
@@ -46,5 +46,5 @@ public:
     bool            _directory = false;
     mvVec2          _min_size = { 100.0f, 100.0f };
     mvVec2          _max_size = { 30000.0f, 30000.0f };
-    mvPyObject      _cancelCallback = nullptr;
+    mvPyCallback    _cancelCallback = nullptr;
 };
\ No newline at end of file
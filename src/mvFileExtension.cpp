@@ -19,7 +19,7 @@ void mvFileExtension::draw(ImDrawList* drawlist, float x, float y)
 
 void mvFileExtension::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 	_extension = ToString(PyTuple_GetItem(dict, 0));
 
@@ -30,8 +30,12 @@ void mvFileExtension::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "custom_text"))_customText = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
+	static const mvKeywordTable<mvFileExtension> keywords = {
+		{ "custom_text", [](mvFileExtension& self, PyObject* item) { self._customText = ToString(item); } },
+		{ "color", [](mvFileExtension& self, PyObject* item) { self._color = ToColor(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	if (info.parentPtr)
 		static_cast<mvFileDialog*>(info.parentPtr)->markDirty();
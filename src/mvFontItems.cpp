@@ -26,7 +26,7 @@ void mvFontRegistry::draw(ImDrawList* drawlist, float x, float y)
 
 void mvCharRemap::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_source = ToInt(PyTuple_GetItem(dict, 0));
@@ -83,7 +83,7 @@ void mvFont::customAction(void* data)
 
 void mvFont::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_file = ToString(PyTuple_GetItem(dict, 0));
@@ -106,9 +106,13 @@ void mvFont::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-    if (PyObject* item = PyDict_GetItemString(dict, "size")) _size = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "pixel_snapH")) _pixelSnapH = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "pixel_snapV")) _pixelSnapV = ToBool(item);
+    static const mvKeywordTable<mvFont> keywords = {
+        { "size", [](mvFont& self, PyObject* item) { self._size = ToFloat(item); } },
+        { "pixel_snapH", [](mvFont& self, PyObject* item) { self._pixelSnapH = ToBool(item); } },
+        { "pixel_snapV", [](mvFont& self, PyObject* item) { self._pixelSnapV = ToBool(item); } },
+    };
+
+    keywords.apply(dict, *this);
 }
 
 void mvFont::getSpecificConfiguration(PyObject* dict)
@@ -34,7 +34,7 @@ void mvKeyDownHandler::draw(ImDrawList* drawlist, float x, float y)
 
 void mvKeyDownHandler::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_key = (ImGuiKey)ToInt(PyTuple_GetItem(dict, 0));
@@ -45,7 +45,11 @@ void mvKeyDownHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "key")) _key = (ImGuiKey)ToInt(item);
+	static const mvKeywordTable<mvKeyDownHandler> keywords = {
+		{ "key", [](mvKeyDownHandler& self, PyObject* item) { self._key = (ImGuiKey)ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvKeyDownHandler::getSpecificConfiguration(PyObject* dict)
@@ -77,7 +81,7 @@ void mvKeyPressHandler::draw(ImDrawList* drawlist, float x, float y)
 
 void mvKeyPressHandler::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -100,7 +104,11 @@ void mvKeyPressHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "key")) _key = (ImGuiKey)ToInt(item);
+	static const mvKeywordTable<mvKeyPressHandler> keywords = {
+		{ "key", [](mvKeyPressHandler& self, PyObject* item) { self._key = (ImGuiKey)ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvKeyPressHandler::getSpecificConfiguration(PyObject* dict)
@@ -132,7 +140,7 @@ void mvKeyReleaseHandler::draw(ImDrawList* drawlist, float x, float y)
 
 void mvKeyReleaseHandler::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -155,7 +163,11 @@ void mvKeyReleaseHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "key")) _key = (ImGuiKey)ToInt(item);
+	static const mvKeywordTable<mvKeyReleaseHandler> keywords = {
+		{ "key", [](mvKeyReleaseHandler& self, PyObject* item) { self._key = (ImGuiKey)ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvKeyReleaseHandler::getSpecificConfiguration(PyObject* dict)
@@ -187,7 +199,7 @@ void mvMouseClickHandler::draw(ImDrawList* drawlist, float x, float y)
 
 void mvMouseClickHandler::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -210,7 +222,11 @@ void mvMouseClickHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+	static const mvKeywordTable<mvMouseClickHandler> keywords = {
+		{ "button", [](mvMouseClickHandler& self, PyObject* item) { self._button = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvMouseClickHandler::getSpecificConfiguration(PyObject* dict)
@@ -242,7 +258,7 @@ void mvMouseDoubleClickHandler::draw(ImDrawList* drawlist, float x, float y)
 
 void mvMouseDoubleClickHandler::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -265,7 +281,11 @@ void mvMouseDoubleClickHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+	static const mvKeywordTable<mvMouseDoubleClickHandler> keywords = {
+		{ "button", [](mvMouseDoubleClickHandler& self, PyObject* item) { self._button = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvMouseDoubleClickHandler::getSpecificConfiguration(PyObject* dict)
@@ -297,7 +317,7 @@ void mvMouseDownHandler::draw(ImDrawList* drawlist, float x, float y)
 
 void mvMouseDownHandler::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -320,7 +340,11 @@ void mvMouseDownHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+	static const mvKeywordTable<mvMouseDownHandler> keywords = {
+		{ "button", [](mvMouseDownHandler& self, PyObject* item) { self._button = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvMouseDownHandler::getSpecificConfiguration(PyObject* dict)
@@ -358,7 +382,7 @@ void mvMouseDragHandler::draw(ImDrawList* drawlist, float x, float y)
 
 void mvMouseDragHandler::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -384,8 +408,12 @@ void mvMouseDragHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "threshold")) _threshold = ToFloat(item);
+	static const mvKeywordTable<mvMouseDragHandler> keywords = {
+		{ "button", [](mvMouseDragHandler& self, PyObject* item) { self._button = ToInt(item); } },
+		{ "threshold", [](mvMouseDragHandler& self, PyObject* item) { self._threshold = ToFloat(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvMouseDragHandler::getSpecificConfiguration(PyObject* dict)
@@ -436,7 +464,7 @@ void mvMouseReleaseHandler::draw(ImDrawList* drawlist, float x, float y)
 
 void mvMouseReleaseHandler::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -459,7 +487,11 @@ void mvMouseReleaseHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+	static const mvKeywordTable<mvMouseReleaseHandler> keywords = {
+		{ "button", [](mvMouseReleaseHandler& self, PyObject* item) { self._button = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvMouseReleaseHandler::getSpecificConfiguration(PyObject* dict)
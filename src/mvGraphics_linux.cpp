@@ -38,19 +38,29 @@ present(mvGraphics& graphics, mvColor& clearColor, bool vsync)
     mvViewport* viewport = GContext->viewport;
     auto viewportData = (mvViewportData*)viewport->platformSpecifics;
 
-    glfwGetWindowPos(viewportData->handle, &viewport->xpos, &viewport->ypos);
+    if (viewportData->handle)
+    {
+        glfwGetWindowPos(viewportData->handle, &viewport->xpos, &viewport->ypos);
 
-    glfwSwapInterval(viewport->vsync ? 1 : 0); // Enable vsync
+        glfwSwapInterval(viewport->vsync ? 1 : 0); // Enable vsync
+    }
 
     // Rendering
     ImGui::Render();
+    mvRecordDrawStats(ImGui::GetDrawData());
     int display_w, display_h;
-    glfwGetFramebufferSize(viewportData->handle, &display_w, &display_h);
+    mvGetFramebufferSize(viewportData, &display_w, &display_h);
 
     glViewport(0, 0, display_w, display_h);
     glClearColor(viewport->clearColor.r, viewport->clearColor.g, viewport->clearColor.b, viewport->clearColor.a);
     glClear(GL_COLOR_BUFFER_BIT);
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    if (!GContext->IO.nullRenderer)
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    else
+        mvSkipDrawData(ImGui::GetDrawData());
 
-    glfwSwapBuffers(viewportData->handle);
+    if (viewportData->handle)
+        glfwSwapBuffers(viewportData->handle);
+    else
+        glFlush(); // headless: the frame stays in the offscreen framebuffer
 }
\ No newline at end of file
@@ -203,9 +203,13 @@ present(mvGraphics& graphics, mvColor& clearColor, bool vsync)
 
 	// Rendering
 	ImGui::Render();
+	mvRecordDrawStats(ImGui::GetDrawData());
 	graphicsData->deviceContext->OMSetRenderTargets(1, &graphicsData->target, nullptr);
 	graphicsData->deviceContext->ClearRenderTargetView(graphicsData->target, clearColor);
-	ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+	if (!GContext->IO.nullRenderer)
+		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+	else
+		mvSkipDrawData(ImGui::GetDrawData());
 
 	static UINT presentFlags = 0;
 	if (graphicsData->swapChain->Present(vsync ? 1 : 0, presentFlags) == DXGI_STATUS_OCCLUDED)
@@ -160,11 +160,15 @@ void mvBoolStateHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "event_type"))
-	{
-		if (item != Py_None)
-			trackedEventType = static_cast<mvEventType>(ToInt(item));
-	}
+	static const mvKeywordTable<mvBoolStateHandler> keywords = {
+		{ "event_type", [](mvBoolStateHandler& self, PyObject* item)
+			{
+				if (item != Py_None)
+					self.trackedEventType = static_cast<mvEventType>(ToInt(item));
+			} },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvBoolStateHandler::getSpecificConfiguration(PyObject* dict)
@@ -222,7 +226,7 @@ void mvClickedHandler::customAction(void* data)
 
 void mvClickedHandler::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_button = ToInt(PyTuple_GetItem(dict, 0));
@@ -233,7 +237,11 @@ void mvClickedHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+	static const mvKeywordTable<mvClickedHandler> keywords = {
+		{ "button", [](mvClickedHandler& self, PyObject* item) { self._button = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvClickedHandler::getSpecificConfiguration(PyObject* dict)
@@ -268,7 +276,7 @@ void mvDoubleClickedHandler::customAction(void* data)
 
 void mvDoubleClickedHandler::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_button = ToInt(PyTuple_GetItem(dict, 0));
@@ -279,7 +287,11 @@ void mvDoubleClickedHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+	static const mvKeywordTable<mvDoubleClickedHandler> keywords = {
+		{ "button", [](mvDoubleClickedHandler& self, PyObject* item) { self._button = ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvDoubleClickedHandler::getSpecificConfiguration(PyObject* dict)
@@ -354,7 +366,11 @@ void mvToggledOpenHandler::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "two_way")) twoWay = ToBool(item);
+	static const mvKeywordTable<mvToggledOpenHandler> keywords = {
+		{ "two_way", [](mvToggledOpenHandler& self, PyObject* item) { self.twoWay = ToBool(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvToggledOpenHandler::getSpecificConfiguration(PyObject* dict)
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include "mvTypes.h"
+
+//-----------------------------------------------------------------------------
+// mvItemPool
+//     - Recycles the memory behind items and other per-item objects. Every
+//       allocated type (for std::allocate_shared, that's the control block
+//       with the object in it, so effectively every item type) gets its own
+//       free list. Memory of a destroyed item goes back to that list and is
+//       handed out to the next item of the same type, so once an app has
+//       warmed up, the items and their value storage no longer come from the
+//       heap (strings, child lists and the buffers of vector values still do;
+//       the latter are reused when a value of the same size comes in).
+//     - Free lists never shrink on their own; mvTrimItemPools() hands the
+//       blocks back to the heap (destroy_context and
+//       get_allocation_stats(trim=True) call it).
+//-----------------------------------------------------------------------------
+
+struct mvItemPoolStats
+{
+    std::atomic<i64> allocations = 0; // blocks taken from the heap
+    std::atomic<i64> reuses      = 0; // blocks handed out again from a free list
+
+    // Not pool blocks: vector values (series columns, float vects, textures)
+    // whose storage had to grow when a new value was converted into it.
+    std::atomic<i64> valueBufferAllocations = 0;
+};
+
+class mvItemPoolBase
+{
+
+public:
+
+    mvItemPoolBase(size_t blockSize) : blockSize(blockSize)
+    {
+        std::lock_guard<std::mutex> lk(GetPoolsMutex());
+        GetPools().push_back(this);
+    }
+
+    void* allocate()
+    {
+        {
+            std::lock_guard<std::mutex> lk(mutex);
+            if (!freeBlocks.empty())
+            {
+                void* block = freeBlocks.back();
+                freeBlocks.pop_back();
+                GetStats().reuses++;
+                return block;
+            }
+        }
+        GetStats().allocations++;
+        return ::operator new(blockSize);
+    }
+
+    void deallocate(void* block)
+    {
+        std::lock_guard<std::mutex> lk(mutex);
+        freeBlocks.push_back(block);
+    }
+
+    // returns all free blocks to the heap
+    void trim()
+    {
+        std::vector<void*> blocks;
+        {
+            std::lock_guard<std::mutex> lk(mutex);
+            blocks.swap(freeBlocks);
+        }
+        for (void* block : blocks)
+            ::operator delete(block);
+    }
+
+    size_t freeCount()
+    {
+        std::lock_guard<std::mutex> lk(mutex);
+        return freeBlocks.size();
+    }
+
+    const size_t blockSize;
+
+    static mvItemPoolStats& GetStats() { static mvItemPoolStats stats; return stats; }
+
+    // Pools are never destroyed (blocks may be released after static destructors run).
+    static std::vector<mvItemPoolBase*>& GetPools() { static auto pools = new std::vector<mvItemPoolBase*>(); return *pools; }
+    static std::mutex& GetPoolsMutex() { static auto poolsMutex = new std::mutex(); return *poolsMutex; }
+
+private:
+
+    std::mutex         mutex;
+    std::vector<void*> freeBlocks;
+
+};
+
+template<typename T>
+struct mvItemPool
+{
+    static mvItemPoolBase& Get() { static auto pool = new mvItemPoolBase(sizeof(T)); return *pool; }
+};
+
+template<typename T>
+struct mvItemPoolAllocator
+{
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "mvItemPoolAllocator doesn't support over-aligned types");
+
+    using value_type = T;
+
+    mvItemPoolAllocator() = default;
+    template<typename U> mvItemPoolAllocator(const mvItemPoolAllocator<U>&) {}
+
+    T* allocate(size_t n)
+    {
+        if (n == 1)
+            return static_cast<T*>(mvItemPool<T>::Get().allocate());
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n)
+    {
+        if (n == 1)
+            mvItemPool<T>::Get().deallocate(p);
+        else
+            ::operator delete(p);
+    }
+
+    template<typename U> bool operator==(const mvItemPoolAllocator<U>&) const { return true; }
+    template<typename U> bool operator!=(const mvItemPoolAllocator<U>&) const { return false; }
+};
+
+// std::make_shared, but with pooled memory
+template<typename T, typename... Args>
+std::shared_ptr<T>
+mvAllocateShared(Args&&... args)
+{
+    return std::allocate_shared<T>(mvItemPoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
+inline void
+mvTrimItemPools()
+{
+    std::lock_guard<std::mutex> lk(mvItemPoolBase::GetPoolsMutex());
+    for (mvItemPoolBase* pool : mvItemPoolBase::GetPools())
+        pool->trim();
+}
@@ -9,19 +9,14 @@
 #include "mvFontManager.h"
 #include "mvContainers.h"
 #include "mvTables.h"
+#include "mvViewport.h"
 
 #include "mvProfiler.h"
 
-thread_local mvThreadContext mvItemRegistry::threadContext;
+#include <algorithm>
+#include <limits>
 
-mvItemRegistry::mvItemRegistry()
-{
-    // We seldom need to do a GetItem(0), and an explicit check for uuid == 0 in GetItem
-    // slows it down.  Instead of this, we add a fake entry to the allItems map,
-    // mapping 0 to nullptr.  This entry will never go away because map items are only
-    // removed in the mvAppItem destructor.
-    allItems[0] = nullptr;
-}
+thread_local mvThreadContext mvItemRegistry::threadContext;
 
 static b8
 DoesAliasExist(mvItemRegistry& registry, const std::string& alias)
@@ -64,10 +59,59 @@ UpdateChildLocations(std::vector<std::shared_ptr<mvAppItem>>* children, i32 slot
     }
 }
 
+// Same as UpdateChildLocations, but only for children[start:], where
+// `location` is the location the child at `start` should get.
+static void
+UpdateChildLocationsFrom(std::vector<std::shared_ptr<mvAppItem>>& children, size_t start, i32 location)
+{
+    for (size_t i = start; i < children.size(); i++)
+    {
+        if (children[i])
+            children[i]->info.location = location++;
+    }
+}
+
+// Finds the item in its parent's childslots. The item's location is checked
+// first, which makes this O(1) for anything but the odd slots that hold
+// nullptr entries (e.g. table tooltips) where we fall back to a linear scan.
+// Note that inserting or erasing a child still renumbers the locations of all
+// the children after it (UpdateChildLocationsFrom), which is why DeleteItem
+// batches runs of sibling deletions and DeleteItems removes in one pass.
 static b8
-AddRuntimeChild(mvAppItem* rootitem, mvUUID before, std::shared_ptr<mvAppItem> item)
+FindChild(mvAppItem* parent, mvAppItem* item, i32& slot, size_t& index)
 {
-    if (before == 0)
+    size_t location = (size_t)item->info.location;
+    for (i32 i = 0; i < 4; i++)
+    {
+        auto& childset = parent->childslots[i];
+        if (location < childset.size() && childset[location].get() == item)
+        {
+            slot = i;
+            index = location;
+            return true;
+        }
+    }
+
+    for (i32 i = 0; i < 4; i++)
+    {
+        auto& childset = parent->childslots[i];
+        for (size_t j = 0; j < childset.size(); j++)
+        {
+            if (childset[j].get() == item)
+            {
+                slot = i;
+                index = j;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static b8
+AddRuntimeChild(mvAppItem* rootitem, mvAppItem* beforeItem, std::shared_ptr<mvAppItem> item)
+{
+    if (beforeItem == nullptr)
     {
         i32 targetSlot = DearPyGui::GetEntityTargetSlot(item->type);
         item->info.location = (i32)rootitem->childslots[targetSlot].size();
@@ -77,29 +121,18 @@ AddRuntimeChild(mvAppItem* rootitem, mvUUID before, std::shared_ptr<mvAppItem> i
         DearPyGui::OnChildAdded(rootitem, item);
         return true;
     }
-    else
+
+    i32 slot;
+    size_t index;
+    if (FindChild(rootitem, beforeItem, slot, index))
     {
-        for (auto& childslot : rootitem->childslots)
-        {
-            for (auto it = childslot.begin(); it != childslot.end(); ++it)
-            {
-                auto child = *it;
-                if (!child)
-                    continue;
-
-                if (child->uuid == before)
-                {
-                    childslot.insert(it, item);
-                    item->info.parentPtr = rootitem;
-                    item->config.parent = rootitem->uuid;
-                    // TODO: this one can be optimized by updating locations in the tail
-                    // of the `childslot` only
-                    UpdateChildLocations(&childslot, 1);
-                    DearPyGui::OnChildAdded(rootitem, item);
-                    return true;
-                }
-            }
-        }
+        auto& childslot = rootitem->childslots[slot];
+        childslot.insert(childslot.begin() + index, item);
+        item->info.parentPtr = rootitem;
+        item->config.parent = rootitem->uuid;
+        UpdateChildLocationsFrom(childslot, index, beforeItem->info.location);
+        DearPyGui::OnChildAdded(rootitem, item);
+        return true;
     }
     IM_ASSERT(false && "We could not find `before` in its parent's childslots.");
     return false;
@@ -119,21 +152,17 @@ AddItemAfter(mvItemRegistry& registry, mvUUID prev, std::shared_ptr<mvAppItem> i
     mvAppItem* parent = prevItem->info.parentPtr;
     if (parent)
     {
-        for (auto& childset : parent->childslots)
+        i32 slot;
+        size_t index;
+        if (FindChild(parent, prevItem, slot, index))
         {
-            for (auto it = childset.begin(); it != childset.end(); ++it)
-            {
-                if (it->get() == prevItem)
-                {
-                    ++it;
-                    childset.insert(it, item);
-                    item->info.parentPtr = parent;
-                    item->config.parent = parent->uuid;
-                    UpdateChildLocations(&childset, 1);
-                    DearPyGui::OnChildAdded(parent, item);
-                    return true;
-                }
-            }
+            auto& childset = parent->childslots[slot];
+            childset.insert(childset.begin() + index + 1, item);
+            item->info.parentPtr = parent;
+            item->config.parent = parent->uuid;
+            UpdateChildLocationsFrom(childset, index + 1, prevItem->info.location + 1);
+            DearPyGui::OnChildAdded(parent, item);
+            return true;
         }
         // This must never happen
         IM_ASSERT(false && "Could not find item in parent's childslots.");
@@ -253,21 +282,16 @@ RemoveItemFromTree(mvItemRegistry& registry, mvAppItem* item)
     mvAppItem* parent = item->info.parentPtr;
     if (parent)
     {
-        for (auto& childset : parent->childslots)
+        i32 slot;
+        size_t index;
+        if (FindChild(parent, item, slot, index))
         {
-            for (auto it = childset.begin(); it != childset.end(); ++it)
-            {
-                if (it->get() == item)
-                {
-                    auto child = *it;
-                    childset.erase(it);
-                    // TODO: this one can be optimized by updating locations in the tail
-                    // of the `childset` only
-                    UpdateChildLocations(&childset, 1);
-                    DearPyGui::OnChildRemoved(parent, child);
-                    return true;
-                }
-            }
+            auto& childset = parent->childslots[slot];
+            auto child = std::move(childset[index]);
+            childset.erase(childset.begin() + index);
+            UpdateChildLocationsFrom(childset, index, child->info.location);
+            DearPyGui::OnChildRemoved(parent, child);
+            return true;
         }
         // This must never happen
         IM_ASSERT(false && "Could not find item in parent's childslots.");
@@ -292,9 +316,407 @@ RemoveItemFromTree(mvItemRegistry& registry, mvAppItem* item)
     return false;
 }
 
+// Counts items in the subtree, stopping at `limit`.
+static i64
+CountItems(mvAppItem* root, i64 limit)
+{
+    i64 count = 0;
+    std::vector<mvAppItem*> stack = { root };
+    while (!stack.empty() && count < limit)
+    {
+        mvAppItem* item = stack.back();
+        stack.pop_back();
+        count++;
+        for (auto& childset : item->childslots)
+        {
+            for (auto& child : childset)
+            {
+                if (child)
+                    stack.push_back(child.get());
+            }
+        }
+    }
+    return count;
+}
+
+// Does what ~mvAppItem does to the registry, but for the whole subtree and
+// right away, so that its UUIDs and aliases are free before the items are
+// actually destroyed. Returns the number of items in the subtree.
+static i64
+UnregisterSubtree(mvItemRegistry& registry, mvAppItem* root)
+{
+    i64 count = 0;
+    std::vector<mvAppItem*> stack = { root };
+    while (!stack.empty())
+    {
+        mvAppItem* item = stack.back();
+        stack.pop_back();
+        count++;
+
+        if (registry.aliases.count(item->config.alias) != 0 && !GContext->IO.manualAliasManagement)
+        {
+            registry.aliases.erase(item->config.alias);
+            // the destructor must not touch the alias if it gets reused by then
+            item->config.alias.clear();
+        }
+        UnregisterItem(registry, item);
+        item->info.retired = true;
+
+        for (auto& childset : item->childslots)
+        {
+            for (auto& child : childset)
+            {
+                if (child)
+                    stack.push_back(child.get());
+            }
+        }
+    }
+    return count;
+}
+
+// Releases items that have already been unlinked from the tree. Small batches
+// are destroyed right here; large ones are retired to ReclaimRetiredItems so
+// that a big delete doesn't stall the frame.
+static void
+DiscardItems(mvItemRegistry& registry, std::vector<std::shared_ptr<mvAppItem>>& items)
+{
+    i64 threshold = GContext->IO.deferredDeletionThreshold;
+    i64 count = 0;
+    for (auto& item : items)
+    {
+        if (item && count < threshold)
+            count += CountItems(item.get(), threshold - count);
+    }
+
+    if (threshold > 0 && count >= threshold)
+    {
+        for (auto& item : items)
+        {
+            if (!item)
+                continue;
+            registry.pendingDeletions += UnregisterSubtree(registry, item.get());
+            registry.retiredItems.push_back(std::move(item));
+        }
+
+        // with wait_for_input, the next frame might otherwise be far away
+        if (GContext->viewport && GContext->viewport->shown)
+            mvWakeViewport(*GContext->viewport);
+    }
+
+    items.clear();
+}
+
+void
+ReclaimRetiredItems(mvItemRegistry& registry, i32 budget)
+{
+    auto& retired = registry.retiredItems;
+    for (i32 i = 0; i < budget && !retired.empty(); i++)
+    {
+        std::shared_ptr<mvAppItem> item = std::move(retired.back());
+        retired.pop_back();
+
+        if (item.use_count() > 1)
+        {
+            // Still owned elsewhere (e.g. a deleted theme that's still bound to
+            // an item): the subtree goes away intact with the last reference.
+            registry.pendingDeletions -= CountItems(item.get(), std::numeric_limits<i64>::max());
+            continue;
+        }
+
+        // Take the children out so that destroying the item itself is cheap;
+        // they will get their own turn.
+        for (auto& childset : item->childslots)
+        {
+            for (auto& child : childset)
+            {
+                if (child)
+                    retired.push_back(std::move(child));
+            }
+            childset.clear();
+        }
+        registry.pendingDeletions--;
+    }
+}
+
+// Unlinks `children` from the parent's childslots in one pass per slot.
+static void
+RemoveChildren(mvAppItem* parent, const std::unordered_set<mvAppItem*>& children)
+{
+    std::vector<std::shared_ptr<mvAppItem>> removed;
+    for (auto& childset : parent->childslots)
+    {
+        removed.clear();
+        size_t kept = 0;
+        for (size_t i = 0; i < childset.size(); i++)
+        {
+            if (childset[i] && children.count(childset[i].get()) != 0)
+                removed.push_back(std::move(childset[i]));
+            else
+                childset[kept++] = std::move(childset[i]);
+        }
+
+        if (removed.empty())
+            continue;
+
+        childset.resize(kept);
+        UpdateChildLocations(&childset, 1);
+
+        // Removed children still carry their old locations. Parents (tables)
+        // erase their per-child data by location, so go from the back.
+        for (auto it = removed.rbegin(); it != removed.rend(); ++it)
+            DearPyGui::OnChildRemoved(parent, *it);
+    }
+}
+
+void
+FlushItemRemovals(mvItemRegistry& registry)
+{
+    // OnChildRemoved may delete more items (node links), which starts a new
+    // batch, so take this one out first and go until nothing is left.
+    while (!registry.pendingRemovals.empty())
+    {
+        MV_PROFILE_SCOPE("Flush item removals")
+
+        std::vector<std::shared_ptr<mvAppItem>> removed;
+        removed.swap(registry.pendingRemovals);
+        mvAppItem* parent = registry.removalParent;
+        registry.removalParent = nullptr;
+
+        std::unordered_set<mvAppItem*> children;
+        children.reserve(removed.size());
+        for (auto& item : removed)
+            children.insert(item.get());
+
+        RemoveChildren(parent, children);
+        DiscardItems(registry, removed);
+    }
+}
+
+// Resolves an item the way GetIDFromPyObject does, but only among the watched
+// items, so that it doesn't need mvContext::mutex. Returns 0 if not watched.
+static mvUUID
+GetSnapshotID(mvValueSnapshot& snapshot, PyObject* item)
+{
+    if (isPyObject_Int(item))
+        return ToUUID(item);
+    else if (isPyObject_String(item))
+    {
+        auto found = snapshot.aliases.find(ToString(item));
+        if (found != snapshot.aliases.end())
+            return found->second;
+    }
+    return 0;
+}
+
+void
+PushItemCommand(mvItemRegistry& registry, PyObject* item, PyObject* value, PyObject* kwargs)
+{
+    mvItemCommand command;
+    command.item = mvPyObject(item, true);
+    if (!value)
+        command.kwargs = mvPyObject(kwargs ? PyDict_Copy(kwargs) : PyDict_New());
+    else
+    {
+        command.value = mvPyObject(value, true);
+
+        // get_value should see the new value right away rather than when the
+        // command gets applied
+        mvPyObject replaced(nullptr);
+        {
+            auto& snapshot = registry.valueSnapshot;
+            std::lock_guard<std::mutex> lk(snapshot.mutex);
+            auto found = snapshot.values.find(GetSnapshotID(snapshot, item));
+            if (found != snapshot.values.end())
+            {
+                replaced = std::move(found->second.value);
+                found->second.value = mvPyObject(value, true);
+                command.watched = found->first;
+                snapshot.pending[found->first]++;
+            }
+        }
+    }
+
+    registry.pendingItemCommands++;
+    registry.itemCommands.push(std::move(command));
+    mvRequestRedraw();
+}
+
+// Republishes the value of a watched item once its set_value was applied, so
+// that get_value keeps returning it until the next PublishValueSnapshot.
+static void
+UpdateWatchedValue(mvItemRegistry& registry, mvUUID uuid, mvAppItem* item)
+{
+    mvPyObject value(item ? item->getPyValue() : nullptr);
+
+    auto& snapshot = registry.valueSnapshot;
+    std::lock_guard<std::mutex> lk(snapshot.mutex);
+
+    auto pending = snapshot.pending.find(uuid);
+    if (pending != snapshot.pending.end() && --pending->second == 0)
+        snapshot.pending.erase(pending);
+
+    // a newer set_value is still buffered; its value stays in the snapshot
+    if (snapshot.pending.count(uuid))
+        return;
+
+    auto found = snapshot.values.find(uuid);
+    if (found == snapshot.values.end())
+        return;
+    if (value.isOk())
+        std::swap(found->second.value, value);
+    else
+    {
+        value = std::move(found->second.value);
+        snapshot.values.erase(found);
+    }
+}
+
+void
+ApplyItemCommands(mvItemRegistry& registry)
+{
+    MV_PROFILE_SCOPE("Apply item commands")
+
+    mvItemCommand command;
+    while (registry.itemCommands.try_pop(command))
+    {
+        registry.pendingItemCommands--;
+
+        // The call that recorded the command has returned long ago, so errors
+        // can only be reported here.
+        mvUUID uuid = GetIDFromPyObject(command.item);
+        mvAppItem* item = GetItem(registry, uuid);
+        if (!item)
+            mvThrowPythonError(mvErrorCode::mvItemNotFound, command.kwargs.isOk() ? "configure_item" : "set_value",
+                "Item not found: " + std::to_string(uuid), nullptr);
+        else if (command.kwargs.isOk())
+            item->handleKeywordArgs(command.kwargs, GetItemParser(item->type));
+        else
+            item->setPyValue(command.value);
+
+        if (PyErr_Occurred())
+            PyErr_Print();
+
+        if (command.watched)
+            UpdateWatchedValue(registry, command.watched, item);
+    }
+}
+
+void
+FlushItemCommands(mvItemRegistry& registry)
+{
+    FlushItemRemovals(registry);
+    if (registry.pendingItemCommands > 0)
+        ApplyItemCommands(registry);
+}
+
+PyObject*
+ReadValueSnapshot(mvItemRegistry& registry, PyObject* item)
+{
+    auto& snapshot = registry.valueSnapshot;
+    std::lock_guard<std::mutex> lk(snapshot.mutex);
+
+    auto found = snapshot.values.find(GetSnapshotID(snapshot, item));
+    if (found == snapshot.values.end())
+        return nullptr;
+
+    found->second.lastRead = GContext->frame;
+    PyObject* value = found->second.value;
+    Py_XINCREF(value);
+    return value;
+}
+
+void
+WatchValue(mvItemRegistry& registry, PyObject* item, mvUUID uuid, PyObject* value)
+{
+    mvPyObject replaced(nullptr);
+
+    auto& snapshot = registry.valueSnapshot;
+    std::lock_guard<std::mutex> lk(snapshot.mutex);
+
+    mvSnapshotValue& entry = snapshot.values[uuid];
+    replaced = std::move(entry.value);
+    entry.value = mvPyObject(value, true);
+    entry.lastRead = GContext->frame;
+    if (isPyObject_String(item))
+        snapshot.aliases[ToString(item)] = uuid;
+}
+
+void
+PublishValueSnapshot(mvItemRegistry& registry)
+{
+    MV_PROFILE_SCOPE("Publish value snapshot")
+
+    // values that haven't been read for this many frames are no longer tracked
+    constexpr i32 maxIdleFrames = 120;
+
+    struct Update
+    {
+        mvUUID     uuid;
+        b8         idle;
+        mvPyObject value;
+    };
+
+    // Python objects are only ever swapped while the snapshot is locked;
+    // whatever they get replaced with is released along with `updates`.
+    auto& snapshot = registry.valueSnapshot;
+    std::vector<Update> updates;
+    {
+        std::lock_guard<std::mutex> lk(snapshot.mutex);
+        if (snapshot.values.empty())
+            return;
+
+        updates.reserve(snapshot.values.size());
+        for (auto it = snapshot.values.begin(); it != snapshot.values.end();)
+        {
+            b8 idle = GContext->frame - it->second.lastRead > maxIdleFrames;
+            updates.push_back({ it->first, idle, idle ? std::move(it->second.value) : mvPyObject(nullptr) });
+            it = idle ? snapshot.values.erase(it) : std::next(it);
+        }
+
+        for (auto it = snapshot.aliases.begin(); it != snapshot.aliases.end();)
+        {
+            auto found = registry.aliases.find(it->first);
+            if (found == registry.aliases.end() || found->second != it->second || snapshot.values.count(it->second) == 0)
+                it = snapshot.aliases.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // reading values may run Python code, so this is done without the lock
+    for (auto& update : updates)
+    {
+        if (update.idle)
+            continue;
+        if (mvAppItem* item = GetItem(registry, update.uuid))
+            update.value = mvPyObject(item->getPyValue());
+    }
+
+    std::lock_guard<std::mutex> lk(snapshot.mutex);
+    for (auto& update : updates)
+    {
+        if (update.idle)
+            continue;
+        auto found = snapshot.values.find(update.uuid);
+        if (found == snapshot.values.end())
+            continue;
+
+        // the item still has the value from before a buffered set_value
+        if (snapshot.pending.count(update.uuid))
+            continue;
+
+        b8 deleted = !update.value.isOk();
+        std::swap(found->second.value, update.value);
+        if (deleted)
+            snapshot.values.erase(found);
+    }
+}
+
 b8
 DeleteItem(mvItemRegistry& registry, mvUUID uuid, b8 childrenOnly, i32 slot)
 {
+    mvRequestRedraw();
+
     mvAppItem* item = GetItem(registry, uuid);
     if (!item)
     {
@@ -303,24 +725,39 @@ DeleteItem(mvItemRegistry& registry, mvUUID uuid, b8 childrenOnly, i32 slot)
         return false;
     }
 
+    // Deleting children one by one would renumber the siblings after each of
+    // them every time, so a run of deletions within one parent is only
+    // recorded here and unlinked in one pass by FlushItemRemovals, which
+    // anything else touching the tree calls first. The items are unregistered
+    // right away, so they are gone as far as the API is concerned.
+    mvAppItem* parent = item->info.parentPtr;
+    if (!childrenOnly && parent && parent == registry.removalParent)
+    {
+        RemoveDebugWindow(registry, uuid);
+        UnregisterSubtree(registry, item);
+        registry.pendingRemovals.push_back(item->shared_from_this());
+        return true;
+    }
+    FlushItemRemovals(registry);
+
     // delete item's children only
     if (childrenOnly)
     {
-        if (slot > -1 && slot < 4)
+        std::vector<std::shared_ptr<mvAppItem>> children;
+        for (i32 i = 0; i < 4; i++)
         {
-            item->childslots[slot].clear();
-        }
-        else
-        {
-            for(size_t i = 0; i < 4; i++)
-            {
-                item->childslots[i].clear();
-            }
+            if (slot > -1 && slot < 4 && slot != i)
+                continue;
+
+            auto& childset = item->childslots[i];
+            children.insert(children.end(), std::make_move_iterator(childset.begin()), std::make_move_iterator(childset.end()));
+            childset.clear();
         }
             
         if(item->type == mvAppItemType::mvTable)
             static_cast<mvTable*>(item)->onChildrenRemoved();
 
+        DiscardItems(registry, children);
         return true;
     }
 
@@ -332,7 +769,17 @@ DeleteItem(mvItemRegistry& registry, mvUUID uuid, b8 childrenOnly, i32 slot)
         return true;
     }
 
-    // Now this is just a regular item in the tree
+    // Now this is just a regular item in the tree; children start a new batch
+    if (parent)
+    {
+        RemoveDebugWindow(registry, uuid);
+        UnregisterSubtree(registry, item);
+        registry.removalParent = parent;
+        registry.pendingRemovals.push_back(item->shared_from_this());
+        return true;
+    }
+
+    std::vector<std::shared_ptr<mvAppItem>> removed = { item->shared_from_this() };
     RemoveDebugWindow(registry, uuid);
     if (!RemoveItemFromTree(registry, item))
     {
@@ -341,6 +788,73 @@ DeleteItem(mvItemRegistry& registry, mvUUID uuid, b8 childrenOnly, i32 slot)
         return false;
     }
 
+    DiscardItems(registry, removed);
+    return true;
+}
+
+b8
+DeleteItems(mvItemRegistry& registry, const std::vector<mvUUID>& uuids)
+{
+    mvRequestRedraw();
+    FlushItemRemovals(registry);
+
+    // Hold a reference to everything first: items may be descendants of other
+    // items in the list, and none of them must go away before we're done.
+    std::vector<std::shared_ptr<mvAppItem>> doomed;
+    doomed.reserve(uuids.size());
+    for (mvUUID uuid : uuids)
+    {
+        if (uuid == 0)
+            continue;
+
+        mvAppItem* item = GetItem(registry, uuid);
+        if (!item)
+        {
+            mvThrowPythonError(mvErrorCode::mvItemNotFound, "delete_items",
+                "Item not found: " + std::to_string(uuid), nullptr);
+            return false;
+        }
+        doomed.push_back(item->shared_from_this());
+    }
+    std::sort(doomed.begin(), doomed.end());
+    doomed.erase(std::unique(doomed.begin(), doomed.end()), doomed.end());
+
+    // Roots, the captured item and debug windows are few, so they go one by one.
+    // Children are grouped by parent and removed in one pass over each childslot.
+    std::unordered_set<mvAppItem*> children;
+    std::vector<mvAppItem*> parents;
+    auto& capturedItem = mvItemRegistry::threadContext.capturedItem;
+    for (auto& item : doomed)
+    {
+        if (capturedItem == item)
+        {
+            capturedItem = nullptr;
+            continue;
+        }
+
+        RemoveDebugWindow(registry, item->uuid);
+        mvAppItem* parent = item->info.parentPtr;
+        if (parent)
+        {
+            if (children.insert(item.get()).second)
+                parents.push_back(parent);
+        }
+        else if (!RemoveItemFromTree(registry, item.get()))
+        {
+            mvThrowPythonError(mvErrorCode::mvItemNotFound, "delete_items",
+                "Unable to delete item: " + std::to_string(item->uuid), item.get());
+            return false;
+        }
+    }
+
+    std::sort(parents.begin(), parents.end());
+    parents.erase(std::unique(parents.begin(), parents.end()), parents.end());
+
+    for (mvAppItem* parent : parents)
+        RemoveChildren(parent, children);
+
+    DiscardItems(registry, doomed);
+    FlushItemRemovals(registry);
     return true;
 }
 
@@ -348,6 +862,8 @@ b8
 MoveItem(mvItemRegistry& registry, mvUUID uuid, mvUUID parent, mvUUID before)
 {
 
+    mvRequestRedraw();
+
     std::shared_ptr<mvAppItem> child = nullptr;
 
     auto& capturedItem = mvItemRegistry::threadContext.capturedItem;
@@ -381,6 +897,8 @@ MoveItem(mvItemRegistry& registry, mvUUID uuid, mvUUID parent, mvUUID before)
 b8
 MoveItemUp(mvItemRegistry& registry, mvUUID uuid)
 {
+    mvRequestRedraw();
+
     mvAppItem* item = GetItem(registry, uuid);
     if (!item)
     {
@@ -392,23 +910,19 @@ MoveItemUp(mvItemRegistry& registry, mvUUID uuid)
     mvAppItem* parent = item->info.parentPtr;
     if (parent)
     {
-        for (auto& childset : parent->childslots)
+        i32 slot;
+        size_t index;
+        if (FindChild(parent, item, slot, index))
         {
-            for (auto it = childset.begin(), prev_it = childset.begin(); it != childset.end(); ++it)
+            auto& childset = parent->childslots[slot];
+            if (index > 0)
             {
-                if (it->get() == item)
-                {
-                    if (it != childset.begin())
-                    {
-                        // Swapping locations so that we don't need to recalculate them on all children
-                        std::swap((*prev_it)->info.location, (*it)->info.location);
-                        // Now swap the child items themselves
-                        std::iter_swap(prev_it, it);
-                    }
-                    return true;
-                }
-                prev_it = it;
+                // Swapping locations so that we don't need to recalculate them on all children
+                std::swap(childset[index - 1]->info.location, childset[index]->info.location);
+                // Now swap the child items themselves
+                std::swap(childset[index - 1], childset[index]);
             }
+            return true;
         }
         // This must never happen
         IM_ASSERT(false && "Could not find item in parent's childslots.");
@@ -427,6 +941,8 @@ MoveItemUp(mvItemRegistry& registry, mvUUID uuid)
 b8
 MoveItemDown(mvItemRegistry& registry, mvUUID uuid)
 {
+    mvRequestRedraw();
+
     mvAppItem* item = GetItem(registry, uuid);
     if (!item)
     {
@@ -438,23 +954,19 @@ MoveItemDown(mvItemRegistry& registry, mvUUID uuid)
     mvAppItem* parent = item->info.parentPtr;
     if (parent)
     {
-        for (auto& childset : parent->childslots)
+        i32 slot;
+        size_t index;
+        if (FindChild(parent, item, slot, index))
         {
-            for (auto it = childset.begin(); it != childset.end(); ++it)
+            auto& childset = parent->childslots[slot];
+            if (index + 1 < childset.size())
             {
-                if (it->get() == item)
-                {
-                    auto next_it = std::next(it);
-                    if (next_it != childset.end())
-                    {
-                        // Swapping locations so that we don't need to recalculate them on all children
-                        std::swap((*it)->info.location, (*next_it)->info.location);
-                        // Now swap the child items themselves
-                        std::iter_swap(it, next_it);
-                    }
-                    return true;
-                }
+                // Swapping locations so that we don't need to recalculate them on all children
+                std::swap(childset[index]->info.location, childset[index + 1]->info.location);
+                // Now swap the child items themselves
+                std::swap(childset[index], childset[index + 1]);
             }
+            return true;
         }
         // This must never happen
         IM_ASSERT(false && "Could not find item in parent's childslots.");
@@ -473,6 +985,8 @@ MoveItemDown(mvItemRegistry& registry, mvUUID uuid)
 b8
 ReorderChildren(mvItemRegistry& registry, mvUUID parent, i32 slot, const std::vector<mvUUID>& new_order)
 {
+	mvRequestRedraw();
+
 	mvAppItem* parentItem = GetItem(registry, parent);
 	if (parentItem == nullptr)
 	{
@@ -483,22 +997,24 @@ ReorderChildren(mvItemRegistry& registry, mvUUID parent, i32 slot, const std::ve
 
 	std::vector<std::shared_ptr<mvAppItem>>& children = parentItem->childslots[slot];
 
+	std::unordered_map<mvUUID, size_t> indices;
+	indices.reserve(children.size());
+	for (size_t i = 0; i < children.size(); i++)
+	{
+		if (children[i])
+			indices.emplace(children[i]->uuid, i);
+	}
+
 	std::vector<std::shared_ptr<mvAppItem>> newchildren;
 	newchildren.reserve(children.size());
 
-	// todo: better sorting algorithm
 	for (const auto& item : new_order)
 	{
-		for (auto& child : children)
-		{
-			if (child->uuid == item)
-			{
-				newchildren.emplace_back(child);
-				break;
-			}
-		}
+		auto found = indices.find(item);
+		if (found != indices.end())
+			newchildren.emplace_back(children[found->second]);
 	}
-	children = newchildren;
+	children = std::move(newchildren);
     UpdateChildLocations(&children, 1);
 	return true;
 }
@@ -583,7 +1099,7 @@ RenderItemRegistry(mvItemRegistry& registry)
         DebugItem("Alias:", root->config.alias.c_str());
         DebugItem("Type:", DearPyGui::GetEntityTypeString(root->type));
         DebugItem("Filter:", root->config.filter.c_str());
-        DebugItem("Payload Type:", root->config.payloadType.c_str());
+        DebugItem("Payload Type:", root->config.cold().payloadType.c_str());
         DebugItem("Location:", std::to_string(root->info.location).c_str());
         DebugItem("Track Offset:", std::to_string(root->config.trackOffset).c_str());
         DebugItem("Container:", DearPyGui::GetEntityDesciptionFlags(root->type) & MV_ITEM_DESC_CONTAINER ? ts : fs);
@@ -596,8 +1112,8 @@ RenderItemRegistry(mvItemRegistry& registry)
         DebugItem("Tracked:", root->config.tracked ? ts : fs);
         DebugItem("Callback:", root->config.callback ? ts : fs);
         DebugItem("User Data:", *(root->config.user_data) ? ts : fs);
-        DebugItem("Drop Callback:", root->config.dropCallback ? ts : fs);
-        DebugItem("Drag Callback:", root->config.dragCallback ? ts : fs);
+        DebugItem("Drop Callback:", root->config.cold().dropCallback ? ts : fs);
+        DebugItem("Drag Callback:", root->config.cold().dragCallback ? ts : fs);
 
         ImGui::Spacing();
         ImGui::Spacing();
@@ -655,8 +1171,81 @@ GetItem(mvItemRegistry& registry, mvUUID uuid)
     if (capturedItem && capturedItem->uuid == uuid)
         return capturedItem.get();
 
-    auto found = registry.allItems.find(uuid);
-    return found != registry.allItems.end()? found->second : nullptr;
+    if (uuid & MV_SLOT_UUID_FLAG)
+    {
+        u32 index = (u32)uuid;
+        if (index < registry.slots.size() && registry.slots[index].uuid == uuid)
+            return registry.slots[index].item;
+        // A stale generated UUID may have been reused as a tag.
+    }
+
+    auto found = registry.taggedItems.find(uuid);
+    return found != registry.taggedItems.end()? found->second : nullptr;
+}
+
+mvUUID
+ReserveItemSlot(mvItemRegistry& registry)
+{
+    u32 index;
+    if (!registry.freeSlots.empty())
+    {
+        index = registry.freeSlots.back();
+        registry.freeSlots.pop_back();
+    }
+    else
+    {
+        index = (u32)registry.slots.size();
+        registry.slots.emplace_back();
+    }
+
+    mvItemSlot& slot = registry.slots[index];
+    slot.item = nullptr;
+    slot.uuid = MV_SLOT_UUID_FLAG | ((mvUUID)slot.generation << 32) | index;
+    return slot.uuid;
+}
+
+void
+RegisterItem(mvItemRegistry& registry, mvAppItem* item)
+{
+    mvUUID uuid = item->uuid;
+    if (uuid & MV_SLOT_UUID_FLAG)
+    {
+        u32 index = (u32)uuid;
+        if (index < registry.slots.size() && registry.slots[index].uuid == uuid)
+        {
+            registry.slots[index].item = item;
+            return;
+        }
+    }
+
+    registry.taggedItems[uuid] = item;
+}
+
+void
+UnregisterItem(mvItemRegistry& registry, mvAppItem* item)
+{
+    mvUUID uuid = item->uuid;
+    if (uuid & MV_SLOT_UUID_FLAG)
+    {
+        u32 index = (u32)uuid;
+        if (index < registry.slots.size() && registry.slots[index].uuid == uuid)
+        {
+            mvItemSlot& slot = registry.slots[index];
+            // another item with the same UUID has taken the slot over
+            if (slot.item != nullptr && slot.item != item)
+                return;
+
+            slot.item = nullptr;
+            slot.uuid = 0;
+            slot.generation = (slot.generation + 1) & MV_SLOT_GENERATION_MASK;
+            registry.freeSlots.push_back(index);
+            return;
+        }
+    }
+
+    auto found = registry.taggedItems.find(uuid);
+    if (found != registry.taggedItems.end() && found->second == item)
+        registry.taggedItems.erase(found);
 }
 
 std::shared_ptr<mvAppItem>
@@ -700,12 +1289,30 @@ ClearItemRegistry(mvItemRegistry& registry)
     registry.itemTemplatesRoots.clear();
     registry.itemHandlerRegistryRoots.clear();
     registry.viewportDrawlistRoots.clear();
+    registry.retiredItems.clear();
+    registry.pendingDeletions = 0;
+    registry.pendingRemovals.clear();
+    registry.removalParent = nullptr;
+
+    mvItemCommand command;
+    while (registry.itemCommands.try_pop(command)) {}
+    registry.pendingItemCommands = 0;
+
+    std::unordered_map<mvUUID, mvSnapshotValue> values;
+    {
+        std::lock_guard<std::mutex> lk(registry.valueSnapshot.mutex);
+        values.swap(registry.valueSnapshot.values);
+        registry.valueSnapshot.aliases.clear();
+        registry.valueSnapshot.pending.clear();
+    }
 }
 
 b8
 AddItemWithRuntimeChecks(mvItemRegistry& registry, std::shared_ptr<mvAppItem> item, mvUUID parent, mvUUID before)
 {
 
+    mvRequestRedraw();
+
     auto& threadContext = mvItemRegistry::threadContext;
 
     if (threadContext.captureCallback)
@@ -724,6 +1331,9 @@ AddItemWithRuntimeChecks(mvItemRegistry& registry, std::shared_ptr<mvAppItem> it
     if (item == nullptr)
         return false;
 
+    // locations in the target parent must be up to date
+    FlushItemRemovals(registry);
+
     // check if item is ok
     if (!item->state.ok)
         return false;
@@ -770,10 +1380,11 @@ AddItemWithRuntimeChecks(mvItemRegistry& registry, std::shared_ptr<mvAppItem> it
         parent = item->config.parent;
 
     mvAppItem* parentPtr = nullptr;
+    mvAppItem* beforeItem = nullptr;
     if (before > 0)
     {
         // Adding it before the "before" item - let's find it!
-        mvAppItem* beforeItem = GetItem(registry, before);
+        beforeItem = GetItem(registry, before);
         if (beforeItem == nullptr)
         {
             mvThrowPythonError(mvErrorCode::mvItemNotFound, "add_*", "Item not found: " + std::to_string(before), nullptr);
@@ -913,7 +1524,7 @@ AddItemWithRuntimeChecks(mvItemRegistry& registry, std::shared_ptr<mvAppItem> it
     //---------------------------------------------------------------------------
     // STEP 8: Either append it to parent's children or insert before the "before"
     //---------------------------------------------------------------------------
-    return AddRuntimeChild(parentPtr, before, item);
+    return AddRuntimeChild(parentPtr, beforeItem, item);
 }
 
 void 
@@ -5,6 +5,8 @@
 #include <unordered_map>
 #include <string>
 #include <map>
+#include <atomic>
+#include <mutex>
 #include "mvAppItem.h"
 #include "mvPyUtils.h"
 
@@ -22,7 +24,10 @@ void             RenderItemRegistry(mvItemRegistry& registry);
 
 // cleanup
 void             ClearItemRegistry(mvItemRegistry& registry);
-b8               DeleteItem       (mvItemRegistry& registry, mvUUID uuid, b8 childrenOnly = false, i32 slot = -1);
+b8               DeleteItem       (mvItemRegistry& registry, mvUUID uuid, b8 childrenOnly = false, i32 slot = -1); // sibling runs are batched, see FlushItemRemovals
+b8               DeleteItems      (mvItemRegistry& registry, const std::vector<mvUUID>& uuids); // siblings are removed in one pass
+// Note: must be called with mvContext::mutex and the GIL locked
+void             ReclaimRetiredItems(mvItemRegistry& registry, i32 budget);
 
 // aliases
 void             AddAlias      (mvItemRegistry& registry, const std::string& alias, mvUUID id);
@@ -43,6 +48,25 @@ std::shared_ptr<mvAppItem> GetRefItem     (mvItemRegistry& registry, mvUUID uuid
 mvWindowAppItem* GetWindow      (mvItemRegistry& registry, mvUUID uuid);
 mvAppItem*       GetItemRoot    (mvItemRegistry& registry, mvUUID uuid);
 
+// UUID bookkeeping (all of these must be called with mvContext::mutex locked)
+mvUUID           ReserveItemSlot(mvItemRegistry& registry);                   // UUID for an item about to be registered
+void             RegisterItem   (mvItemRegistry& registry, mvAppItem* item);  // makes the item reachable via GetItem
+void             UnregisterItem (mvItemRegistry& registry, mvAppItem* item);
+
+// command buffer (see mvIO::commandBuffer)
+// Note: PushItemCommand and ReadValueSnapshot only need the GIL; the rest must
+//       be called with mvContext::mutex and the GIL locked
+void             PushItemCommand     (mvItemRegistry& registry, PyObject* item, PyObject* value, PyObject* kwargs);  // value for set_value, kwargs otherwise
+void             ApplyItemCommands   (mvItemRegistry& registry);
+// API commands call this right after locking the context: buffered commands
+// are older than the command and must be applied before it touches any item.
+// Also unlinks the children batched by DeleteItem (FlushItemRemovals).
+void             FlushItemCommands   (mvItemRegistry& registry);
+void             FlushItemRemovals   (mvItemRegistry& registry);
+PyObject*        ReadValueSnapshot   (mvItemRegistry& registry, PyObject* item);  // new reference or nullptr if not watched
+void             WatchValue          (mvItemRegistry& registry, PyObject* item, mvUUID uuid, PyObject* value);
+void             PublishValueSnapshot(mvItemRegistry& registry);
+
 // item operations
 b8               AddItemWithRuntimeChecks(mvItemRegistry& registry, std::shared_ptr<mvAppItem> item, mvUUID parent, mvUUID before);
 void             ResetTheme              (mvItemRegistry& registry);
@@ -67,6 +91,57 @@ struct mvThreadContext
     mvPyObject                              captureCallbackUserData = nullptr;
 };
 
+//-----------------------------------------------------------------------------
+// mvItemSlot
+//     - An entry of mvItemRegistry::slots. UUIDs made by ReserveItemSlot encode
+//       the slot index and generation, so that GetItem on them is a bounds
+//       check and an array load. The generation is bumped whenever the slot
+//       is freed, so a stale UUID never reaches the next item in that slot.
+//-----------------------------------------------------------------------------
+
+struct mvItemSlot
+{
+    mvAppItem* item = nullptr;
+    mvUUID     uuid = 0;        // UUID the slot is reserved for; 0 if free
+    u32        generation = 0;
+};
+
+//-----------------------------------------------------------------------------
+// mvItemCommand
+//     - A set_value or configure_item call recorded while a frame was holding
+//       mvContext::mutex. The item is kept the way it was passed in (UUID or
+//       alias) and only resolved when the command is applied.
+//-----------------------------------------------------------------------------
+
+struct mvItemCommand
+{
+    mvPyObject item   = nullptr;
+    mvPyObject value  = nullptr;  // set_value
+    mvPyObject kwargs = nullptr;  // configure_item (a copy of the call's kwargs)
+    mvUUID     watched = 0;       // set_value on a watched item; see mvValueSnapshot::pending
+};
+
+//-----------------------------------------------------------------------------
+// mvValueSnapshot
+//     - Values of items that were read recently, republished after every
+//       frame, so that get_value doesn't have to wait for the frame to end.
+//       Guarded by its own mutex, which is only held for map lookups.
+//-----------------------------------------------------------------------------
+
+struct mvSnapshotValue
+{
+    mvPyObject value = nullptr;
+    i32        lastRead = 0;      // frame of the last get_value
+};
+
+struct mvValueSnapshot
+{
+    std::mutex                                  mutex;
+    std::unordered_map<mvUUID, mvSnapshotValue> values;
+    std::unordered_map<std::string, mvUUID>     aliases;  // aliases of the watched items
+    std::unordered_map<mvUUID, i32>             pending;  // set_value commands not applied yet; not republished
+};
+
 //-----------------------------------------------------------------------------
 // mvItemRegistry
 //     - Responsibilities:
@@ -82,7 +157,11 @@ struct mvItemRegistry
 
     // misc
     std::unordered_map<std::string, mvUUID> aliases;
-    std::unordered_map<mvUUID, mvAppItem*>  allItems;        // used for quick access to items by UUID
+
+    // quick access to items by UUID
+    std::vector<mvItemSlot>                 slots;           // items with generated UUIDs
+    std::vector<u32>                        freeSlots;
+    std::unordered_map<mvUUID, mvAppItem*>  taggedItems;     // items with user-specified integer tags
 
     static thread_local mvThreadContext     threadContext;
 
@@ -106,5 +185,19 @@ struct mvItemRegistry
     std::vector<std::shared_ptr<mvAppItem>> itemTemplatesRoots;
     std::vector<std::shared_ptr<mvAppItem>> viewportDrawlistRoots;
 
-    mvItemRegistry();
+    // Deleted subtrees that are too large to destroy in one go. They are
+    // already unlinked and unregistered; ReclaimRetiredItems destroys them
+    // a few items per frame.
+    std::vector<std::shared_ptr<mvAppItem>> retiredItems;
+    std::atomic<i64>                        pendingDeletions = 0;  // items in retiredItems, counting descendants
+
+    // delete_item on siblings, batched (see DeleteItem). The items are already
+    // unregistered but still sit in removalParent's childslots.
+    mvAppItem*                              removalParent = nullptr;
+    std::vector<std::shared_ptr<mvAppItem>> pendingRemovals;
+
+    // command buffer
+    mvQueue<mvItemCommand>                  itemCommands{ 4096 };
+    std::atomic<i64>                        pendingItemCommands = 0;
+    mvValueSnapshot                         valueSnapshot;
 };
\ No newline at end of file
@@ -477,9 +477,9 @@ void mvLayoutWindow::drawWidgets()
 
                             DebugItem("Callback:", _itemref->config.callback ? ts : fs);
                             DebugItem("User Data:", *(_itemref->config.user_data) ? ts : fs);
-                            DebugItem("Drop Callback:", _itemref->config.dropCallback ? ts : fs);
-                            DebugItem("Drag Callback:", _itemref->config.dragCallback ? ts : fs);
-                            DebugItem("Payload Type:", _itemref->config.payloadType.c_str());
+                            DebugItem("Drop Callback:", _itemref->config.cold().dropCallback ? ts : fs);
+                            DebugItem("Drag Callback:", _itemref->config.cold().dragCallback ? ts : fs);
+                            DebugItem("Payload Type:", _itemref->config.cold().payloadType.c_str());
 
                             renderTypeSpecificInfo();
 
@@ -2,8 +2,39 @@
 
 #include <GL/gl3w.h>
 #include <GLFW/glfw3.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 
 struct mvViewportData
 {
     GLFWwindow* handle = nullptr;
+
+    // headless viewports (no window): an EGL context rendering into
+    // an offscreen framebuffer
+    void*  eglDisplay  = nullptr;
+    void*  eglSurface  = nullptr;
+    void*  eglContext  = nullptr;
+    GLuint framebuffer = 0;
+    GLuint colorbuffer = 0;
+    int    width       = 0;
+    int    height      = 0;
+    std::chrono::steady_clock::time_point lastFrameTime;
+
+    // wakes up a headless viewport waiting for input (mvWakeViewport)
+    std::mutex              wakeMutex;
+    std::condition_variable wakeCondition;
+    bool                    woken = false;
 };
+
+inline void
+mvGetFramebufferSize(mvViewportData* viewportData, int* width, int* height)
+{
+    if (viewportData->handle)
+        glfwGetFramebufferSize(viewportData->handle, width, height);
+    else
+    {
+        *width = viewportData->width;
+        *height = viewportData->height;
+    }
+}
@@ -82,6 +82,10 @@ void mvLoadingIndicator::draw(ImDrawList* drawlist, float x, float y)
             }
             break;
         }
+
+        // keep spinning with wait_for_input
+        if (ImGui::IsItemVisible())
+            mvRequestRedraw();
     }
 
     //-----------------------------------------------------------------------------
@@ -119,19 +123,23 @@ void mvLoadingIndicator::handleSpecificKeywordArgs(PyObject* dict)
     if (dict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(dict, "style")) _style = static_cast<Style>(ToInt(item));
-    if (PyObject* item = PyDict_GetItemString(dict, "circle_count")) _circleCount = ToInt(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "radius")) _radius = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "speed")) _speed = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "color"))
-    {
-        _mainColor = (item != Py_None)? ToColor(item) : mvColor();
-    }
-    if (PyObject* item = PyDict_GetItemString(dict, "secondary_color"))
-    {
-        _optionalColor = (item != Py_None)? ToColor(item) : mvColor();
-    }
+    static const mvKeywordTable<mvLoadingIndicator> keywords = {
+        { "style", [](mvLoadingIndicator& self, PyObject* item) { self._style = static_cast<Style>(ToInt(item)); } },
+        { "circle_count", [](mvLoadingIndicator& self, PyObject* item) { self._circleCount = ToInt(item); } },
+        { "radius", [](mvLoadingIndicator& self, PyObject* item) { self._radius = ToFloat(item); } },
+        { "thickness", [](mvLoadingIndicator& self, PyObject* item) { self._thickness = ToFloat(item); } },
+        { "speed", [](mvLoadingIndicator& self, PyObject* item) { self._speed = ToFloat(item); } },
+        { "color", [](mvLoadingIndicator& self, PyObject* item)
+            {
+                self._mainColor = (item != Py_None)? ToColor(item) : mvColor();
+            } },
+        { "secondary_color", [](mvLoadingIndicator& self, PyObject* item)
+            {
+                self._optionalColor = (item != Py_None)? ToColor(item) : mvColor();
+            } },
+    };
+
+    keywords.apply(dict, *this);
 }
 
 void mvLoadingIndicator::getSpecificConfiguration(PyObject* dict)
@@ -56,22 +56,21 @@ void mvNodeEditor::handleSpecificKeywordArgs(PyObject* dict)
     if (dict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(dict, "delink_callback"))
-    {
-        _delinkCallback = mvPyObject(item == Py_None? nullptr : item, true);
-    }
+    using Keywords = mvKeywordTable<mvNodeEditor>;
+    static const Keywords keywords = {
+        { "delink_callback", [](mvNodeEditor& self, PyObject* item)
+            {
+                self._delinkCallback = mvPyCallback(item == Py_None? nullptr : item, true);
+            } },
 
-    // helper for bit flipping
-    auto flagop = [dict](const char* keyword, int flag, int& flags)
-    {
-        if (PyObject* item = PyDict_GetItemString(dict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
-    };
+        // window flags
+        { "menubar", Keywords::flag(&mvNodeEditor::_windowflags, ImGuiWindowFlags_MenuBar) },
 
-    // window flags
-    flagop("menubar", ImGuiWindowFlags_MenuBar, _windowflags);
+        { "minimap", [](mvNodeEditor& self, PyObject* item) { self._minimap = ToBool(item); } },
+        { "minimap_location", [](mvNodeEditor& self, PyObject* item) { self._minimapLocation = ToInt(item); } },
+    };
 
-    if (PyObject* item = PyDict_GetItemString(dict, "minimap")) _minimap = ToBool(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "minimap_location")) _minimapLocation = ToInt(item);
+    keywords.apply(dict, *this);
 }
 
 void mvNodeEditor::getSpecificConfiguration(PyObject* dict)
@@ -105,6 +104,10 @@ void mvNodeEditor::onChildRemoved(std::shared_ptr<mvAppItem> item)
 
             for (const auto& child : childslots[0])
             {
+                // already deleted, waiting to be unlinked (see DeleteItem)
+                if (child->info.retired)
+                    continue;
+
                 if (child->type == mvAppItemType::mvNodeLink)
                 {
 
@@ -502,7 +505,11 @@ void mvNode::handleSpecificKeywordArgs(PyObject* dict)
     if (dict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(dict, "draggable")) _draggable = ToBool(item);
+    static const mvKeywordTable<mvNode> keywords = {
+        { "draggable", [](mvNode& self, PyObject* item) { self._draggable = ToBool(item); } },
+    };
+
+    keywords.apply(dict, *this);
 
 }
 
@@ -615,12 +622,16 @@ void mvNodeAttribute::handleSpecificKeywordArgs(PyObject* dict)
     if (dict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(dict, "category")) _category = ToString(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "attribute_type")) _attrType = (mvNodeAttribute::AttributeType)ToUUID(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "shape"))
-    {
-        _shape = (ImNodesPinShape)ToInt(item);
-    }
+    static const mvKeywordTable<mvNodeAttribute> keywords = {
+        { "category", [](mvNodeAttribute& self, PyObject* item) { self._category = ToString(item); } },
+        { "attribute_type", [](mvNodeAttribute& self, PyObject* item) { self._attrType = (mvNodeAttribute::AttributeType)ToUUID(item); } },
+        { "shape", [](mvNodeAttribute& self, PyObject* item)
+            {
+                self._shape = (ImNodesPinShape)ToInt(item);
+            } },
+    };
+
+    keywords.apply(dict, *this);
 }
 
 void mvNodeAttribute::getSpecificConfiguration(PyObject* dict)
@@ -643,7 +654,7 @@ mvNodeLink::mvNodeLink(mvUUID uuid)
 
 void mvNodeLink::handleSpecificRequiredArgs(PyObject* dict)
 {
-    if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+    if (!VerifyRequiredArguments(GetItemParser(type), dict))
         return;
 
     mvUUID node1 = GetIDFromPyObject(PyTuple_GetItem(dict, 0));
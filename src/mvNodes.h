@@ -106,7 +106,7 @@ private:
     bool _clearNodes = false;
     bool _clearLinks = false;
 
-    mvPyObject            _delinkCallback = nullptr;
+    mvPyCallback          _delinkCallback = nullptr;
     ImNodesEditorContext* _context = nullptr;
 
     bool                   _minimap = false;
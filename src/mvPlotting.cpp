@@ -14,6 +14,14 @@
 
 #include <utility>
 
+// ImPlot's drag tools take an int ID; hash all 64 bits of the UUID into it,
+// the same way ScopedID does, so a reused slot doesn't inherit their state
+static int
+DragToolID(mvUUID uuid)
+{
+	return (int)ImHashData(&uuid, sizeof(uuid));
+}
+
 static void
 draw_polygon(const mvAreaSeriesConfig& config)
 {
@@ -355,9 +363,136 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, std::shared_ptr<s
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
+	share_series_value(*srcItem);
 	outValue = *static_cast<std::shared_ptr<std::vector<std::vector<double>>>*>(srcItem->getValue());
 }
 
+void
+DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, _mvBasicSeriesConfig& outConfig)
+{
+	auto previousValue = outConfig.value;
+	set_data_source(item, dataSource, outConfig.value);
+
+	// values are now shared with the source, so local views must not shadow them
+	if (outConfig.value != previousValue)
+	{
+		for (auto& view : *outConfig.views)
+			view.release();
+	}
+}
+
+struct mvSeriesColumn
+{
+	const double* data  = nullptr;
+	int           count = 0;
+};
+
+static mvSeriesColumn
+GetSeriesColumn(const _mvBasicSeriesConfig& config, int column)
+{
+	if (column < (int)config.views->size() && (*config.views)[column].isValid())
+		return { (*config.views)[column].data(), (*config.views)[column].size() };
+
+	const std::vector<double>& values = (*config.value)[column];
+	return { values.data(), (int)values.size() };
+}
+
+// the series that may keep their columns in views
+static _mvBasicSeriesConfig*
+GetViewedSeriesConfig(mvAppItem& item)
+{
+	switch (item.type)
+	{
+	case mvAppItemType::mvBarSeries:     return &static_cast<mvBarSeries&>(item).configData;
+	case mvAppItemType::mvLineSeries:    return &static_cast<mvLineSeries&>(item).configData;
+	case mvAppItemType::mvScatterSeries: return &static_cast<mvScatterSeries&>(item).configData;
+	case mvAppItemType::mvShadeSeries:   return &static_cast<mvShadeSeries&>(item).configData;
+	case mvAppItemType::mvStairSeries:   return &static_cast<mvStairSeries&>(item).configData;
+	case mvAppItemType::mvStemSeries:    return &static_cast<mvStemSeries&>(item).configData;
+	default:                             return nullptr;
+	}
+}
+
+void
+DearPyGui::share_series_value(mvAppItem& source)
+{
+	_mvBasicSeriesConfig* config = GetViewedSeriesConfig(source);
+	if (!config)
+		return;
+
+	// items using `source` as their data source only see `value`
+	if (config->value->size() < config->views->size())
+		config->value->resize(config->views->size());
+	for (size_t i = 0; i < config->views->size(); i++)
+	{
+		mvDoubleBufferView& view = (*config->views)[i];
+		if (!view.isValid())
+			continue;
+		(*config->value)[i].assign(view.data(), view.data() + view.size());
+		view.release();
+	}
+}
+
+void
+DearPyGui::set_series_column(PyObject* value, _mvBasicSeriesConfig& outConfig, int column)
+{
+	// float64 contiguous buffers are referenced in place, anything else
+	// (lists, tuples, other dtypes, strided views) is converted and copied.
+	// So is everything while `value` is shared with other items via `source`.
+	if (outConfig.value.use_count() == 1 && (*outConfig.views)[column].acquire(value))
+		(*outConfig.value)[column].clear();
+	else
+	{
+		(*outConfig.views)[column].release();
+		ToDoubleVect(value, (*outConfig.value)[column]);
+	}
+}
+
+void
+DearPyGui::set_series_value(PyObject* value, _mvBasicSeriesConfig& outConfig)
+{
+	Py_ssize_t count = 0;
+	if (PyTuple_Check(value))
+		count = PyTuple_Size(value);
+	else if (PyList_Check(value))
+		count = PyList_Size(value);
+
+	if (outConfig.value->size() < outConfig.views->size())
+		outConfig.value->resize(outConfig.views->size());
+
+	for (int i = 0; i < (int)outConfig.views->size(); i++)
+	{
+		if (i < count)
+			set_series_column(PyTuple_Check(value) ? PyTuple_GetItem(value, i) : PyList_GetItem(value, i), outConfig, i);
+		else
+		{
+			(*outConfig.views)[i].release();
+			(*outConfig.value)[i].clear();
+		}
+	}
+}
+
+PyObject*
+DearPyGui::get_series_value(const _mvBasicSeriesConfig& config, bool asBuffer)
+{
+	PyObject* result = PyList_New(config.value->size());
+	if (result == nullptr)
+		return nullptr;
+
+	for (size_t i = 0; i < config.value->size(); i++)
+	{
+		mvSeriesColumn column = GetSeriesColumn(config, (int)i);
+		PyObject* item = asBuffer ? ToPyMemoryView(column.data, column.count) : ToPyFloatList(column.data, column.count);
+		if (item == nullptr)
+		{
+			Py_DECREF(result);
+			return nullptr;
+		}
+		PyList_SET_ITEM(result, i, item);
+	}
+	return result;
+}
+
 void
 DearPyGui::draw_plot(ImDrawList* drawlist, mvAppItem& item, mvPlotConfig& config)
 {
@@ -421,6 +556,9 @@ DearPyGui::draw_plot(ImDrawList* drawlist, mvAppItem& item, mvPlotConfig& config
 			}
 		}
 		config._fitDirty = false;
+
+		// ImPlot fits the axes over the next frame
+		mvRequestRedraw();
 	}
 
 	if (ImPlot::BeginPlot(item.info.internalLabel.c_str(), ImVec2((float)item.config.width, (float)item.config.height), config._flags))
@@ -600,7 +738,7 @@ DearPyGui::draw_plot(ImDrawList* drawlist, mvAppItem& item, mvPlotConfig& config
 		}
 
 		// todo: resolve clipping
-		if (item.config.dropCallback)
+		if (item.config.cold().dropCallback)
 		{
 			ScopedID id(item.uuid);
 			if (ImPlot::BeginDragDropTargetPlot())
@@ -707,7 +845,7 @@ DearPyGui::draw_plot_axis(ImDrawList* drawlist, mvAppItem& item, mvPlotAxisConfi
 	if (item.theme)
 		static_cast<mvTheme*>(item.theme.get())->customAction();
 
-	if (item.config.dropCallback)
+	if (item.config.cold().dropCallback)
 	{
 		ScopedID id(item.uuid);
 		if (ImPlot::BeginDragDropTargetAxis(config.axis))
@@ -759,7 +897,7 @@ DearPyGui::draw_plot_legend(ImDrawList* drawlist, mvAppItem& item, mvPlotLegendC
 		static_cast<mvTheme*>(item.theme.get())->customAction();
 	}
 
-	if (item.config.dropCallback)
+	if (item.config.cold().dropCallback)
 	{
 		if (ImPlot::BeginDragDropTargetLegend())
 		{
@@ -782,7 +920,7 @@ DearPyGui::draw_drag_line(ImDrawList* drawlist, mvAppItem& item, mvDragLineConfi
 
 	if (config.vertical)
 	{
-		if (ImPlot::DragLineX((int)item.uuid, config.value.get(), config.color, config.thickness, config.flags, nullptr, &hovered, &held))
+		if (ImPlot::DragLineX(DragToolID(item.uuid), config.value.get(), config.color, config.thickness, config.flags, nullptr, &hovered, &held))
 		{
 			item.submitCallback();
 		}
@@ -798,7 +936,7 @@ DearPyGui::draw_drag_line(ImDrawList* drawlist, mvAppItem& item, mvDragLineConfi
 	}
 	else
 	{
-		if (ImPlot::DragLineY((int)item.uuid, config.value.get(), config.color, config.thickness, config.flags, nullptr, &hovered, &held))
+		if (ImPlot::DragLineY(DragToolID(item.uuid), config.value.get(), config.color, config.thickness, config.flags, nullptr, &hovered, &held))
 		{
 			item.submitCallback();
 		}
@@ -859,7 +997,7 @@ DearPyGui::draw_drag_rect(ImDrawList* drawlist, mvAppItem& item, mvDragRectConfi
 	ymax = (*config.value.get())[3];
 
 	// item.config.specifiedLabel.c_str(),
-	if (ImPlot::DragRect((int)item.uuid, &xmin, &ymin, &xmax, &ymax, config.color, config.flags))
+	if (ImPlot::DragRect(DragToolID(item.uuid), &xmin, &ymin, &xmax, &ymax, config.color, config.flags))
 	{
 		(*config.value.get())[0] = xmin;
 		(*config.value.get())[1] = ymin;
@@ -884,7 +1022,7 @@ DearPyGui::draw_drag_point(ImDrawList* drawlist, mvAppItem& item, mvDragPointCon
 
 	bool hovered = false;
 	bool held = false;
-	if (ImPlot::DragPoint((int)item.uuid, &dummyx, &dummyy, config.color, config.radius, config.flags, nullptr, &hovered, &held))
+	if (ImPlot::DragPoint(DragToolID(item.uuid), &dummyx, &dummyy, config.color, config.radius, config.flags, nullptr, &hovered, &held))
 	{
 		(*config.value.get())[0] = dummyx;
 		(*config.value.get())[1] = dummyy;
@@ -925,13 +1063,10 @@ DearPyGui::draw_bar_series(ImDrawList* drawlist, mvAppItem& item, const mvBarSer
 	//-----------------------------------------------------------------------------
 	{
 
-		static const std::vector<double>* xptr;
-		static const std::vector<double>* yptr;
-
-		xptr = &(*config.value.get())[0];
-		yptr = &(*config.value.get())[1];
+		mvSeriesColumn x = GetSeriesColumn(config, 0);
+		mvSeriesColumn y = GetSeriesColumn(config, 1);
 
-		ImPlot::PlotBars(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), config.weight, config.flags);
+		ImPlot::PlotBars(item.info.internalLabel.c_str(), x.data, y.data, ImMin(x.count, y.count), config.weight, config.flags);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1061,13 +1196,10 @@ DearPyGui::draw_line_series(ImDrawList* drawlist, mvAppItem& item, const mvLineS
 	//-----------------------------------------------------------------------------
 	{
 
-		static const std::vector<double>* xptr;
-		static const std::vector<double>* yptr;
+		mvSeriesColumn x = GetSeriesColumn(config, 0);
+		mvSeriesColumn y = GetSeriesColumn(config, 1);
 
-		xptr = &(*config.value.get())[0];
-		yptr = &(*config.value.get())[1];
-
-		ImPlot::PlotLine(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), config.flags);
+		ImPlot::PlotLine(item.info.internalLabel.c_str(), x.data, y.data, ImMin(x.count, y.count), config.flags);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1126,13 +1258,10 @@ DearPyGui::draw_scatter_series(ImDrawList* drawlist, mvAppItem& item, const mvSc
 	//-----------------------------------------------------------------------------
 	{
 
-		static const std::vector<double>* xptr;
-		static const std::vector<double>* yptr;
+		mvSeriesColumn x = GetSeriesColumn(config, 0);
+		mvSeriesColumn y = GetSeriesColumn(config, 1);
 
-		xptr = &(*config.value.get())[0];
-		yptr = &(*config.value.get())[1];
-
-		ImPlot::PlotScatter(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), config.flags);
+		ImPlot::PlotScatter(item.info.internalLabel.c_str(), x.data, y.data, ImMin(x.count, y.count), config.flags);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1191,13 +1320,10 @@ DearPyGui::draw_stair_series(ImDrawList* drawlist, mvAppItem& item, const mvStai
 	//-----------------------------------------------------------------------------
 	{
 
-		static const std::vector<double>* xptr;
-		static const std::vector<double>* yptr;
+		mvSeriesColumn x = GetSeriesColumn(config, 0);
+		mvSeriesColumn y = GetSeriesColumn(config, 1);
 
-		xptr = &(*config.value.get())[0];
-		yptr = &(*config.value.get())[1];
-
-		ImPlot::PlotStairs(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), config.flags);
+		ImPlot::PlotStairs(item.info.internalLabel.c_str(), x.data, y.data, ImMin(x.count, y.count), config.flags);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1256,13 +1382,10 @@ DearPyGui::draw_stem_series(ImDrawList* drawlist, mvAppItem& item, const mvStemS
 	//-----------------------------------------------------------------------------
 	{
 
-		static const std::vector<double>* xptr;
-		static const std::vector<double>* yptr;
-
-		xptr = &(*config.value.get())[0];
-		yptr = &(*config.value.get())[1];
+		mvSeriesColumn x = GetSeriesColumn(config, 0);
+		mvSeriesColumn y = GetSeriesColumn(config, 1);
 
-		ImPlot::PlotStems(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), 0.0, config.flags);
+		ImPlot::PlotStems(item.info.internalLabel.c_str(), x.data, y.data, ImMin(x.count, y.count), 0.0, config.flags);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1321,16 +1444,12 @@ DearPyGui::draw_shade_series(ImDrawList* drawlist, mvAppItem& item, const mvShad
 	//-----------------------------------------------------------------------------
 	{
 
-		static const std::vector<double>* xptr;
-		static const std::vector<double>* y1ptr;
-		static const std::vector<double>* y2ptr;
-
-		xptr = &(*config.value.get())[0];
-		y1ptr = &(*config.value.get())[1];
-		y2ptr = &(*config.value.get())[2];
+		mvSeriesColumn x = GetSeriesColumn(config, 0);
+		mvSeriesColumn y1 = GetSeriesColumn(config, 1);
+		mvSeriesColumn y2 = GetSeriesColumn(config, 2);
 
-		ImPlot::PlotShaded(item.info.internalLabel.c_str(), xptr->data(), y1ptr->data(),
-			y2ptr->data(), (int)xptr->size(), config.flags);
+		ImPlot::PlotShaded(item.info.internalLabel.c_str(), x.data, y1.data,
+			y2.data, ImMin(x.count, ImMin(y1.count, y2.count)), config.flags);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), ImGuiMouseButton_Right))
@@ -2297,31 +2416,31 @@ DearPyGui::draw_plot_annotation(ImDrawList* drawlist, mvAppItem& item, mvAnnotat
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvLineSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvLineSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvLineSeries), inDict))
 		return;
 
 	for(int i = 0; i < PyTuple_Size(inDict); i++)
-		(*outConfig.value)[i] = ToDoubleVect(PyTuple_GetItem(inDict, i));
+		set_series_column(PyTuple_GetItem(inDict, i), outConfig, i);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvDigitalSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvDigitalSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvDigitalSeries), inDict))
 		return;
 
 	for(int i = 0; i < PyTuple_Size(inDict); i++)
-		(*outConfig.value)[i] = ToDoubleVect(PyTuple_GetItem(inDict, i));
+		ToDoubleVect(PyTuple_GetItem(inDict, i), (*outConfig.value)[i]);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvBarSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvBarSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvBarSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
-	(*outConfig.value)[1] = ToDoubleVect(PyTuple_GetItem(inDict, 1));
+	set_series_column(PyTuple_GetItem(inDict, 0), outConfig, 0);
+	set_series_column(PyTuple_GetItem(inDict, 1), outConfig, 1);
 }
 
 static bool ValidateBarGroupConfig(mvBarGroupSeriesConfig& outConfig) 
@@ -2352,14 +2471,14 @@ static bool ValidateBarGroupConfig(mvBarGroupSeriesConfig& outConfig)
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvBarGroupSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvBarGroupSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvBarGroupSeries), inDict))
 		return;
 
 	auto backup_value = (*outConfig.value)[0];
 	auto backup_label_ids = outConfig.label_ids;
 	int backup_group_size = outConfig.group_size;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
 	outConfig.label_ids = ToStringVect(PyTuple_GetItem(inDict, 1));
 	outConfig.group_size = ToInt(PyTuple_GetItem(inDict, 2));
 
@@ -2373,85 +2492,84 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvBarGroupSeriesConfig
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvStairSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvStairSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvStairSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
-	(*outConfig.value)[1] = ToDoubleVect(PyTuple_GetItem(inDict, 1));
+	set_series_column(PyTuple_GetItem(inDict, 0), outConfig, 0);
+	set_series_column(PyTuple_GetItem(inDict, 1), outConfig, 1);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvInfLineSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvInfLineSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvInfLineSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvShadeSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvShadeSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvShadeSeries), inDict))
 		return;
 
 	for(int i = 0; i < PyTuple_Size(inDict); i++)
-		(*outConfig.value)[i] = ToDoubleVect(PyTuple_GetItem(inDict, i));
+		set_series_column(PyTuple_GetItem(inDict, i), outConfig, i);
 
-	(*outConfig.value)[2] = (*outConfig.value)[1];
-	for (auto& item : (*outConfig.value)[2])
-		item = 0.0;
+	(*outConfig.views)[2].release();
+	(*outConfig.value)[2].assign(GetSeriesColumn(outConfig, 1).count, 0.0);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvStemSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvStemSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvStemSeries), inDict))
 		return;
 
 	for(int i = 0; i < PyTuple_Size(inDict); i++)
-		(*outConfig.value)[i] = ToDoubleVect(PyTuple_GetItem(inDict, i));
+		set_series_column(PyTuple_GetItem(inDict, i), outConfig, i);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mv2dHistogramSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mv2dHistogramSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mv2dHistogramSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
-	(*outConfig.value)[1] = ToDoubleVect(PyTuple_GetItem(inDict, 1));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 1), (*outConfig.value)[1]);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvScatterSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvScatterSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvScatterSeries), inDict))
 		return;
 
 	for(int i = 0; i < PyTuple_Size(inDict); i++)
-		(*outConfig.value)[i] = ToDoubleVect(PyTuple_GetItem(inDict, i));
+		set_series_column(PyTuple_GetItem(inDict, i), outConfig, i);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvErrorSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvErrorSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvErrorSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
-	(*outConfig.value)[1] = ToDoubleVect(PyTuple_GetItem(inDict, 1));
-	(*outConfig.value)[2] = ToDoubleVect(PyTuple_GetItem(inDict, 2));
-	(*outConfig.value)[3] = ToDoubleVect(PyTuple_GetItem(inDict, 3));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 1), (*outConfig.value)[1]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 2), (*outConfig.value)[2]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 3), (*outConfig.value)[3]);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvHeatSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvHeatSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvHeatSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
 	outConfig.rows = ToInt(PyTuple_GetItem(inDict, 1));
 	outConfig.cols = ToInt(PyTuple_GetItem(inDict, 2));
 	(*outConfig.value)[1].push_back(outConfig.bounds_min.y);
@@ -2461,22 +2579,22 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvHeatSeriesConfig& ou
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvHistogramSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvHistogramSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvHistogramSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
 }
 
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvPieSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvPieSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvPieSeries), inDict))
 		return;
 
 	outConfig.x = ToDouble(PyTuple_GetItem(inDict, 0));
 	outConfig.y = ToDouble(PyTuple_GetItem(inDict, 1));
 	outConfig.radius = ToDouble(PyTuple_GetItem(inDict, 2));
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 3));
+	ToDoubleVect(PyTuple_GetItem(inDict, 3), (*outConfig.value)[0]);
 	outConfig.labels = ToStringVect(PyTuple_GetItem(inDict, 4));
 	outConfig.clabels.clear();
 	for (const auto& label : outConfig.labels)
@@ -2486,7 +2604,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvPieSeriesConfig& out
 void
 DearPyGui::set_positional_configuration(PyObject* inDict, mvLabelSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvLabelSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvLabelSeries), inDict))
 		return;
 
 	(*outConfig.value)[0] = std::vector<double>{ToDouble(PyTuple_GetItem(inDict, 0))};
@@ -2496,7 +2614,7 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvLabelSeriesConfig& o
 void
 DearPyGui::set_required_configuration(PyObject* inDict, mvImageSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvImageSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvImageSeries), inDict))
 		return;
 
 	mvUUID textureUUID = GetIDFromPyObject(PyTuple_GetItem(inDict, 0));
@@ -2521,7 +2639,7 @@ DearPyGui::set_required_configuration(PyObject* inDict, mvImageSeriesConfig& out
 void
 DearPyGui::set_required_configuration(PyObject* inDict, mvSubPlotsConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvSubPlots)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvSubPlots), inDict))
 		return;
 
 	outConfig.rows = ToInt(PyTuple_GetItem(inDict, 0));
@@ -2531,41 +2649,41 @@ DearPyGui::set_required_configuration(PyObject* inDict, mvSubPlotsConfig& outCon
 void
 DearPyGui::set_required_configuration(PyObject* inDict, mvAreaSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvAreaSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvAreaSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
-	(*outConfig.value)[1] = ToDoubleVect(PyTuple_GetItem(inDict, 1));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 1), (*outConfig.value)[1]);
 }
 
 void
 DearPyGui::set_required_configuration(PyObject* inDict, mvCandleSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvCandleSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvCandleSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
-	(*outConfig.value)[1] = ToDoubleVect(PyTuple_GetItem(inDict, 1));
-	(*outConfig.value)[2] = ToDoubleVect(PyTuple_GetItem(inDict, 2));
-	(*outConfig.value)[3] = ToDoubleVect(PyTuple_GetItem(inDict, 3));
-	(*outConfig.value)[4] = ToDoubleVect(PyTuple_GetItem(inDict, 4));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 1), (*outConfig.value)[1]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 2), (*outConfig.value)[2]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 3), (*outConfig.value)[3]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 4), (*outConfig.value)[4]);
 }
 
 void
 DearPyGui::set_required_configuration(PyObject* inDict, mvCustomSeriesConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvCustomSeries)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvCustomSeries), inDict))
 		return;
 
-	(*outConfig.value)[0] = ToDoubleVect(PyTuple_GetItem(inDict, 0));
-	(*outConfig.value)[1] = ToDoubleVect(PyTuple_GetItem(inDict, 1));
+	ToDoubleVect(PyTuple_GetItem(inDict, 0), (*outConfig.value)[0]);
+	ToDoubleVect(PyTuple_GetItem(inDict, 1), (*outConfig.value)[1]);
 	outConfig.channelCount = ToInt(PyTuple_GetItem(inDict, 2));
 }
 
 void
 DearPyGui::set_required_configuration(PyObject* inDict, mvPlotAxisConfig& outConfig)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(mvAppItemType::mvPlotAxis)], inDict))
+	if (!VerifyRequiredArguments(GetItemParser(mvAppItemType::mvPlotAxis), inDict))
 		return;
 
 	outConfig.axis = ToInt(PyTuple_GetItem(inDict, 0));
@@ -2577,22 +2695,21 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragLineConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "color")) outConfig.color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "thickness")) outConfig.thickness = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "show_label")) outConfig.show_label = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "vertical")) outConfig.vertical = ToBool(item);
+	using Keywords = mvKeywordTable<mvDragLineConfig>;
+	static const Keywords keywords = {
+		{ "color", [](mvDragLineConfig& config, PyObject* item) { config.color = ToColor(item); } },
+		{ "thickness", [](mvDragLineConfig& config, PyObject* item) { config.thickness = ToFloat(item); } },
+		{ "show_label", [](mvDragLineConfig& config, PyObject* item) { config.show_label = ToBool(item); } },
+		{ "vertical", [](mvDragLineConfig& config, PyObject* item) { config.vertical = ToBool(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// drag line flags
+		{ "delayed", Keywords::flag(&mvDragLineConfig::flags, ImPlotDragToolFlags_Delayed) },
+		{ "no_cursor", Keywords::flag(&mvDragLineConfig::flags, ImPlotDragToolFlags_NoCursors) },
+		{ "no_fit", Keywords::flag(&mvDragLineConfig::flags, ImPlotDragToolFlags_NoFit) },
+		{ "no_inputs", Keywords::flag(&mvDragLineConfig::flags, ImPlotDragToolFlags_NoInputs) },
 	};
 
-	// drag line flags
-	flagop("delayed", ImPlotDragToolFlags_Delayed, outConfig.flags);
-	flagop("no_cursor", ImPlotDragToolFlags_NoCursors, outConfig.flags);
-	flagop("no_fit", ImPlotDragToolFlags_NoFit, outConfig.flags);
-	flagop("no_inputs", ImPlotDragToolFlags_NoInputs, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2601,19 +2718,18 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragRectConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "color")) outConfig.color = ToColor(item);
+	using Keywords = mvKeywordTable<mvDragRectConfig>;
+	static const Keywords keywords = {
+		{ "color", [](mvDragRectConfig& config, PyObject* item) { config.color = ToColor(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// drag rect flags
+		{ "delayed", Keywords::flag(&mvDragRectConfig::flags, ImPlotDragToolFlags_Delayed) },
+		{ "no_cursor", Keywords::flag(&mvDragRectConfig::flags, ImPlotDragToolFlags_NoCursors) },
+		{ "no_fit", Keywords::flag(&mvDragRectConfig::flags, ImPlotDragToolFlags_NoFit) },
+		{ "no_inputs", Keywords::flag(&mvDragRectConfig::flags, ImPlotDragToolFlags_NoInputs) },
 	};
 
-	// drag rect flags
-	flagop("delayed", ImPlotDragToolFlags_Delayed, outConfig.flags);
-	flagop("no_cursor", ImPlotDragToolFlags_NoCursors, outConfig.flags);
-	flagop("no_fit", ImPlotDragToolFlags_NoFit, outConfig.flags);
-	flagop("no_inputs", ImPlotDragToolFlags_NoInputs, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 
 }
 
@@ -2623,42 +2739,47 @@ DearPyGui::set_configuration(PyObject* inDict, mvPlotConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "pan_button")) outConfig.pan = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "fit_button")) outConfig.fit = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "context_menu_button")) outConfig.menu = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "box_select_button")) outConfig.select = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "box_select_cancel_button")) outConfig.select_cancel = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "box_select_mod_button")) outConfig.select_mod = static_cast<ImGuiKey>(ToInt(item));
-	if (PyObject* item = PyDict_GetItemString(inDict, "query_toggle_mod")) outConfig.query_toggle_mod = static_cast<ImGuiKey>(ToInt(item));
-	if (PyObject* item = PyDict_GetItemString(inDict, "horizontal_mod")) outConfig.select_horz_mod = static_cast<ImGuiKey>(ToInt(item));
-	if (PyObject* item = PyDict_GetItemString(inDict, "vertical_mod")) outConfig.select_vert_mod = static_cast<ImGuiKey>(ToInt(item));
-	if (PyObject* item = PyDict_GetItemString(inDict, "use_local_time")) outConfig.localTime = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "use_ISO8601")) outConfig.iSO8601 = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "use_24hour_clock")) outConfig.clock24Hour = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "pan_mod")) outConfig.pan_mod = static_cast<ImGuiKey>(ToInt(item));
-	if (PyObject* item = PyDict_GetItemString(inDict, "override_mod")) outConfig.override_mod = static_cast<ImGuiKey>(ToInt(item));
-	if (PyObject* item = PyDict_GetItemString(inDict, "zoom_mod")) outConfig.zoom_mod = static_cast<ImGuiKey>(ToInt(item));
-	if (PyObject* item = PyDict_GetItemString(inDict, "zoom_rate")) outConfig.zoom_rate = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "query")) outConfig.query_enabled = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "query_color")) outConfig.query_color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_query_rects")) outConfig.min_query_rects = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_query_rects")) outConfig.max_query_rects = ToInt(item);
 	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
+	auto flagop = [](int flag) -> mvKeywordTable<mvPlotConfig>::Setter
 	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		return [flag](mvPlotConfig& config, PyObject* item) { ToBool(item) ? config._flags |= flag : config._flags &= ~flag; };
 	};
 
-	// plot flags
-	flagop("no_title", ImPlotFlags_NoTitle, outConfig._flags);
-	flagop("no_menus", ImPlotFlags_NoMenus, outConfig._flags);
-	flagop("no_box_select", ImPlotFlags_NoBoxSelect, outConfig._flags);
-	flagop("no_mouse_pos", ImPlotFlags_NoMouseText, outConfig._flags);
-	flagop("crosshairs", ImPlotFlags_Crosshairs, outConfig._flags);
-	flagop("equal_aspects", ImPlotFlags_Equal, outConfig._flags);
-	flagop("no_inputs", ImPlotFlags_NoInputs, outConfig._flags);
-	flagop("no_frame", ImPlotFlags_NoFrame, outConfig._flags);	
-	// flagop("canvas_only", ImPlotFlags_CanvasOnly, outConfig._flags);
+	static const mvKeywordTable<mvPlotConfig> keywords = {
+		{ "pan_button", [](mvPlotConfig& config, PyObject* item) { config.pan = ToInt(item); } },
+		{ "fit_button", [](mvPlotConfig& config, PyObject* item) { config.fit = ToInt(item); } },
+		{ "context_menu_button", [](mvPlotConfig& config, PyObject* item) { config.menu = ToInt(item); } },
+		{ "box_select_button", [](mvPlotConfig& config, PyObject* item) { config.select = ToInt(item); } },
+		{ "box_select_cancel_button", [](mvPlotConfig& config, PyObject* item) { config.select_cancel = ToInt(item); } },
+		{ "box_select_mod_button", [](mvPlotConfig& config, PyObject* item) { config.select_mod = static_cast<ImGuiKey>(ToInt(item)); } },
+		{ "query_toggle_mod", [](mvPlotConfig& config, PyObject* item) { config.query_toggle_mod = static_cast<ImGuiKey>(ToInt(item)); } },
+		{ "horizontal_mod", [](mvPlotConfig& config, PyObject* item) { config.select_horz_mod = static_cast<ImGuiKey>(ToInt(item)); } },
+		{ "vertical_mod", [](mvPlotConfig& config, PyObject* item) { config.select_vert_mod = static_cast<ImGuiKey>(ToInt(item)); } },
+		{ "use_local_time", [](mvPlotConfig& config, PyObject* item) { config.localTime = ToBool(item); } },
+		{ "use_ISO8601", [](mvPlotConfig& config, PyObject* item) { config.iSO8601 = ToBool(item); } },
+		{ "use_24hour_clock", [](mvPlotConfig& config, PyObject* item) { config.clock24Hour = ToBool(item); } },
+		{ "pan_mod", [](mvPlotConfig& config, PyObject* item) { config.pan_mod = static_cast<ImGuiKey>(ToInt(item)); } },
+		{ "override_mod", [](mvPlotConfig& config, PyObject* item) { config.override_mod = static_cast<ImGuiKey>(ToInt(item)); } },
+		{ "zoom_mod", [](mvPlotConfig& config, PyObject* item) { config.zoom_mod = static_cast<ImGuiKey>(ToInt(item)); } },
+		{ "zoom_rate", [](mvPlotConfig& config, PyObject* item) { config.zoom_rate = ToFloat(item); } },
+		{ "query", [](mvPlotConfig& config, PyObject* item) { config.query_enabled = ToBool(item); } },
+		{ "query_color", [](mvPlotConfig& config, PyObject* item) { config.query_color = ToColor(item); } },
+		{ "min_query_rects", [](mvPlotConfig& config, PyObject* item) { config.min_query_rects = ToInt(item); } },
+		{ "max_query_rects", [](mvPlotConfig& config, PyObject* item) { config.max_query_rects = ToInt(item); } },
+
+		// plot flags
+		{ "no_title", flagop(ImPlotFlags_NoTitle) },
+		{ "no_menus", flagop(ImPlotFlags_NoMenus) },
+		{ "no_box_select", flagop(ImPlotFlags_NoBoxSelect) },
+		{ "no_mouse_pos", flagop(ImPlotFlags_NoMouseText) },
+		{ "crosshairs", flagop(ImPlotFlags_Crosshairs) },
+		{ "equal_aspects", flagop(ImPlotFlags_Equal) },
+		{ "no_inputs", flagop(ImPlotFlags_NoInputs) },
+		{ "no_frame", flagop(ImPlotFlags_NoFrame) },
+		// { "canvas_only", flagop(ImPlotFlags_CanvasOnly) },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2667,52 +2788,55 @@ DearPyGui::set_configuration(PyObject* inDict, mvDragPointConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "color")) outConfig.color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "radius")) outConfig.radius = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "show_label")) outConfig.show_label = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "clamped")) outConfig.clamped = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "offset")) outConfig.pixOffset = ToVec2(item);
+	using Keywords = mvKeywordTable<mvDragPointConfig>;
+	static const Keywords keywords = {
+		{ "color", [](mvDragPointConfig& config, PyObject* item) { config.color = ToColor(item); } },
+		{ "radius", [](mvDragPointConfig& config, PyObject* item) { config.radius = ToFloat(item); } },
+		{ "show_label", [](mvDragPointConfig& config, PyObject* item) { config.show_label = ToBool(item); } },
+		{ "clamped", [](mvDragPointConfig& config, PyObject* item) { config.clamped = ToBool(item); } },
+		{ "offset", [](mvDragPointConfig& config, PyObject* item) { config.pixOffset = ToVec2(item); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// drag point flags
+		{ "delayed", Keywords::flag(&mvDragPointConfig::flags, ImPlotDragToolFlags_Delayed) },
+		{ "no_cursor", Keywords::flag(&mvDragPointConfig::flags, ImPlotDragToolFlags_NoCursors) },
+		{ "no_fit", Keywords::flag(&mvDragPointConfig::flags, ImPlotDragToolFlags_NoFit) },
+		{ "no_inputs", Keywords::flag(&mvDragPointConfig::flags, ImPlotDragToolFlags_NoInputs) },
 	};
 
-	// drag point flags
-	flagop("delayed", ImPlotDragToolFlags_Delayed, outConfig.flags);
-	flagop("no_cursor", ImPlotDragToolFlags_NoCursors, outConfig.flags);
-	flagop("no_fit", ImPlotDragToolFlags_NoFit, outConfig.flags);
-	flagop("no_inputs", ImPlotDragToolFlags_NoInputs, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 
 }
 
 void
-
 DearPyGui::set_configuration(PyObject* inDict, mvPlotLegendConfig& outConfig, mvAppItem& item)
 {
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "location")) { outConfig.legendLocation = ToInt(item); outConfig.dirty = true; }
-
 	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, mvPlotLegendConfig& outConfig)
+	auto flagop = [](int flag) -> mvKeywordTable<mvPlotLegendConfig>::Setter
 	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) { 
-			ToBool(item) ? outConfig.flags |= flag : outConfig.flags &= ~flag; 
-			outConfig.dirty = true; 
-		}
+		return [flag](mvPlotLegendConfig& config, PyObject* item)
+		{
+			ToBool(item) ? config.flags |= flag : config.flags &= ~flag;
+			config.dirty = true;
+		};
 	};
 
-	// plot flags
-	flagop("no_buttons", ImPlotLegendFlags_NoButtons, outConfig);
-	flagop("no_highlight_item", ImPlotLegendFlags_NoHighlightItem, outConfig);
-	flagop("no_highlight_axis", ImPlotLegendFlags_NoHighlightAxis, outConfig);
-	flagop("no_menus", ImPlotLegendFlags_NoMenus, outConfig);
-	flagop("outside", ImPlotLegendFlags_Outside, outConfig);
-	flagop("horizontal", ImPlotLegendFlags_Horizontal, outConfig);
-	flagop("sort", ImPlotLegendFlags_Sort, outConfig);
+	static const mvKeywordTable<mvPlotLegendConfig> keywords = {
+		{ "location", [](mvPlotLegendConfig& config, PyObject* item) { config.legendLocation = ToInt(item); config.dirty = true; } },
+
+		// plot flags
+		{ "no_buttons", flagop(ImPlotLegendFlags_NoButtons) },
+		{ "no_highlight_item", flagop(ImPlotLegendFlags_NoHighlightItem) },
+		{ "no_highlight_axis", flagop(ImPlotLegendFlags_NoHighlightAxis) },
+		{ "no_menus", flagop(ImPlotLegendFlags_NoMenus) },
+		{ "outside", flagop(ImPlotLegendFlags_Outside) },
+		{ "horizontal", flagop(ImPlotLegendFlags_Horizontal) },
+		{ "sort", flagop(ImPlotLegendFlags_Sort) },
+	};
+
+	keywords.apply(inDict, outConfig);
 
 	if (item.info.shownLastFrame)
 	{
@@ -2741,21 +2865,20 @@ DearPyGui::set_configuration(PyObject* inDict, mvLineSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
+	using Keywords = mvKeywordTable<mvLineSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mvLineSeriesConfig& config, PyObject* item) { set_series_column(item, config, 0); } },
+		{ "y", [](mvLineSeriesConfig& config, PyObject* item) { set_series_column(item, config, 1); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "segments", Keywords::flag(&mvLineSeriesConfig::flags, ImPlotLineFlags_Segments) },
+		{ "loop", Keywords::flag(&mvLineSeriesConfig::flags, ImPlotLineFlags_Loop) },
+		{ "skip_nan", Keywords::flag(&mvLineSeriesConfig::flags, ImPlotLineFlags_SkipNaN) },
+		{ "no_clip", Keywords::flag(&mvLineSeriesConfig::flags, ImPlotLineFlags_NoClip) },
+		{ "shaded", Keywords::flag(&mvLineSeriesConfig::flags, ImPlotLineFlags_Shaded) },
 	};
 
-	// flags
-	flagop("segments", ImPlotLineFlags_Segments, outConfig.flags);
-	flagop("loop", ImPlotLineFlags_Loop, outConfig.flags);
-	flagop("skip_nan", ImPlotLineFlags_SkipNaN, outConfig.flags);
-	flagop("no_clip", ImPlotLineFlags_NoClip, outConfig.flags);
-	flagop("shaded", ImPlotLineFlags_Shaded, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2764,18 +2887,17 @@ DearPyGui::set_configuration(PyObject* inDict, mvBarSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "weight")) outConfig.weight = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
+	using Keywords = mvKeywordTable<mvBarSeriesConfig>;
+	static const Keywords keywords = {
+		{ "weight", [](mvBarSeriesConfig& config, PyObject* item) { config.weight = ToFloat(item); } },
+		{ "x", [](mvBarSeriesConfig& config, PyObject* item) { set_series_column(item, config, 0); } },
+		{ "y", [](mvBarSeriesConfig& config, PyObject* item) { set_series_column(item, config, 1); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "horizontal", Keywords::flag(&mvBarSeriesConfig::flags, ImPlotBarsFlags_Horizontal) },
 	};
 
-	// flags
-	flagop("horizontal", ImPlotBarsFlags_Horizontal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2788,9 +2910,25 @@ DearPyGui::set_configuration(PyObject* inDict, mvBarGroupSeriesConfig& outConfig
 	auto backup_label_ids = outConfig.label_ids;
 	auto backup_group_size = outConfig.group_size;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "values")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "label_ids")) { outConfig.label_ids = ToStringVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "group_size")) { outConfig.group_size = ToInt(item); }
+	using Keywords = mvKeywordTable<mvBarGroupSeriesConfig>;
+
+	// the data keywords are validated together before anything else is applied
+	static const Keywords data_keywords = {
+		{ "values", [](mvBarGroupSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
+		{ "label_ids", [](mvBarGroupSeriesConfig& config, PyObject* item) { config.label_ids = ToStringVect(item); } },
+		{ "group_size", [](mvBarGroupSeriesConfig& config, PyObject* item) { config.group_size = ToInt(item); } },
+	};
+
+	static const Keywords keywords = {
+		{ "group_width", [](mvBarGroupSeriesConfig& config, PyObject* item) { config.group_width = ToFloat(item); } },
+		{ "shift", [](mvBarGroupSeriesConfig& config, PyObject* item) { config.shift = ToInt(item); } },
+
+		// flags
+		{ "horizontal", Keywords::flag(&mvBarGroupSeriesConfig::flags, ImPlotBarGroupsFlags_Horizontal) },
+		{ "stacked", Keywords::flag(&mvBarGroupSeriesConfig::flags, ImPlotBarGroupsFlags_Stacked) },
+	};
+
+	data_keywords.apply(inDict, outConfig);
 
 	if (!ValidateBarGroupConfig(outConfig)) {
 		(*outConfig.value)[0] = backup_value;
@@ -2799,18 +2937,7 @@ DearPyGui::set_configuration(PyObject* inDict, mvBarGroupSeriesConfig& outConfig
 		return;
 	}
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "group_width")) outConfig.group_width = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "shift")) outConfig.shift = ToInt(item);
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
-	};
-
-	// flags
-	flagop("horizontal", ImPlotBarGroupsFlags_Horizontal, outConfig.flags);
-	flagop("stacked", ImPlotBarGroupsFlags_Stacked, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2819,20 +2946,21 @@ DearPyGui::set_configuration(PyObject* inDict, mvShadeSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	bool valueChanged = false;
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { valueChanged = true; (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { valueChanged = true; (*outConfig.value)[1] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y1")) { valueChanged = true; (*outConfig.value)[1] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y2")) { valueChanged = true; (*outConfig.value)[2] = ToDoubleVect(item); }
+	static const mvKeywordTable<mvShadeSeriesConfig> keywords = {
+		{ "x", [](mvShadeSeriesConfig& config, PyObject* item) { set_series_column(item, config, 0); } },
+		{ "y", [](mvShadeSeriesConfig& config, PyObject* item) { set_series_column(item, config, 1); } },
+		{ "y1", [](mvShadeSeriesConfig& config, PyObject* item) { set_series_column(item, config, 1); } },
+		{ "y2", [](mvShadeSeriesConfig& config, PyObject* item) { set_series_column(item, config, 2); } },
+	};
 
+	const bool valueChanged = keywords.apply(inDict, outConfig) > 0;
 	if (valueChanged)
 	{
-		if ((*outConfig.value)[1].size() != (*outConfig.value)[2].size())
+		const int count = GetSeriesColumn(outConfig, 1).count;
+		if (count != GetSeriesColumn(outConfig, 2).count)
 		{
-			(*outConfig.value)[2].clear();
-			for (size_t i = 0; i < (*outConfig.value)[1].size(); i++)
-				(*outConfig.value)[2].push_back(0.0);
-
+			(*outConfig.views)[2].release();
+			(*outConfig.value)[2].assign(count, 0.0);
 		}
 	}
 }
@@ -2843,17 +2971,16 @@ DearPyGui::set_configuration(PyObject* inDict, mvStemSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
+	using Keywords = mvKeywordTable<mvStemSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mvStemSeriesConfig& config, PyObject* item) { set_series_column(item, config, 0); } },
+		{ "y", [](mvStemSeriesConfig& config, PyObject* item) { set_series_column(item, config, 1); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "horizontal", Keywords::flag(&mvStemSeriesConfig::flags, ImPlotStemsFlags_Horizontal) },
 	};
 
-	// flags
-	flagop("horizontal", ImPlotStemsFlags_Horizontal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2862,18 +2989,17 @@ DearPyGui::set_configuration(PyObject* inDict, mvStairSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
+	using Keywords = mvKeywordTable<mvStairSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mvStairSeriesConfig& config, PyObject* item) { set_series_column(item, config, 0); } },
+		{ "y", [](mvStairSeriesConfig& config, PyObject* item) { set_series_column(item, config, 1); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "pre_step", Keywords::flag(&mvStairSeriesConfig::flags, ImPlotStairsFlags_PreStep) },
+		{ "shaded", Keywords::flag(&mvStairSeriesConfig::flags, ImPlotStairsFlags_Shaded) },
 	};
 
-	// flags
-	flagop("pre_step", ImPlotStairsFlags_PreStep, outConfig.flags);
-	flagop("shaded", ImPlotStairsFlags_Shaded, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2882,16 +3008,15 @@ DearPyGui::set_configuration(PyObject* inDict, mvInfLineSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
+	using Keywords = mvKeywordTable<mvInfLineSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mvInfLineSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "horizontal", Keywords::flag(&mvInfLineSeriesConfig::flags, ImPlotInfLinesFlags_Horizontal) },
 	};
 
-	// flags
-	flagop("horizontal", ImPlotInfLinesFlags_Horizontal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2900,17 +3025,16 @@ DearPyGui::set_configuration(PyObject* inDict, mvScatterSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
+	using Keywords = mvKeywordTable<mvScatterSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mvScatterSeriesConfig& config, PyObject* item) { set_series_column(item, config, 0); } },
+		{ "y", [](mvScatterSeriesConfig& config, PyObject* item) { set_series_column(item, config, 1); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// flags
+		{ "no_clip", Keywords::flag(&mvScatterSeriesConfig::flags, ImPlotScatterFlags_NoClip) },
 	};
 
-	// flags
-	flagop("no_clip", ImPlotScatterFlags_NoClip, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2919,29 +3043,23 @@ DearPyGui::set_configuration(PyObject* inDict, mv2dHistogramSeriesConfig& outCon
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "xbins")) { outConfig.xbins = ToInt(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "ybins")) { outConfig.ybins = ToInt(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "xmin_range")) { outConfig.xmin = ToDouble(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "xmax_range")) { outConfig.xmax = ToDouble(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "ymin_range")) { outConfig.ymin = ToDouble(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "ymax_range")) { outConfig.ymax = ToDouble(item); }
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mv2dHistogramSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mv2dHistogramSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
+		{ "xbins", [](mv2dHistogramSeriesConfig& config, PyObject* item) { config.xbins = ToInt(item); } },
+		{ "ybins", [](mv2dHistogramSeriesConfig& config, PyObject* item) { config.ybins = ToInt(item); } },
+		{ "xmin_range", [](mv2dHistogramSeriesConfig& config, PyObject* item) { config.xmin = ToDouble(item); } },
+		{ "xmax_range", [](mv2dHistogramSeriesConfig& config, PyObject* item) { config.xmax = ToDouble(item); } },
+		{ "ymin_range", [](mv2dHistogramSeriesConfig& config, PyObject* item) { config.ymin = ToDouble(item); } },
+		{ "ymax_range", [](mv2dHistogramSeriesConfig& config, PyObject* item) { config.ymax = ToDouble(item); } },
+
+		// 2D histogram series flags
+		{ "density", Keywords::flag(&mv2dHistogramSeriesConfig::flags, ImPlotHistogramFlags_Density) },
+		{ "outliers", Keywords::flag(&mv2dHistogramSeriesConfig::flags, ImPlotHistogramFlags_NoOutliers, true) },
+		{ "col_major", Keywords::flag(&mv2dHistogramSeriesConfig::flags, ImPlotHistogramFlags_ColMajor) },
 	};
 
-	auto reverse_flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags &= ~flag : flags |= flag;
-	};
-
-	// 2D histogram series flags
-	flagop("density", ImPlotHistogramFlags_Density, outConfig.flags);
-	reverse_flagop("outliers", ImPlotHistogramFlags_NoOutliers, outConfig.flags);
-	flagop("col_major", ImPlotHistogramFlags_ColMajor, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2950,19 +3068,18 @@ DearPyGui::set_configuration(PyObject* inDict, mvErrorSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "negative")) { (*outConfig.value)[2] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "positive")) { (*outConfig.value)[3] = ToDoubleVect(item); }
-	
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mvErrorSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mvErrorSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
+		{ "y", [](mvErrorSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[1]); } },
+		{ "negative", [](mvErrorSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[2]); } },
+		{ "positive", [](mvErrorSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[3]); } },
+
+		// error series flags
+		{ "horizontal", Keywords::flag(&mvErrorSeriesConfig::flags, ImPlotErrorBarsFlags_Horizontal) },
 	};
 
-	// error series flags
-	flagop("horizontal", ImPlotErrorBarsFlags_Horizontal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -2971,31 +3088,29 @@ DearPyGui::set_configuration(PyObject* inDict, mvHeatSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "rows")) outConfig.rows = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "cols")) outConfig.cols = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "bounds_min")) outConfig.bounds_min = ToPoint(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "bounds_max")) outConfig.bounds_max = ToPoint(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "scale_min")) outConfig.scale_min = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "scale_max")) outConfig.scale_max = ToDouble(item);
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
-	};
+	using Keywords = mvKeywordTable<mvHeatSeriesConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvHeatSeriesConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "rows", [](mvHeatSeriesConfig& config, PyObject* item) { config.rows = ToInt(item); } },
+		{ "cols", [](mvHeatSeriesConfig& config, PyObject* item) { config.cols = ToInt(item); } },
+		{ "bounds_min", [](mvHeatSeriesConfig& config, PyObject* item) { config.bounds_min = ToPoint(item); } },
+		{ "bounds_max", [](mvHeatSeriesConfig& config, PyObject* item) { config.bounds_max = ToPoint(item); } },
+		{ "scale_min", [](mvHeatSeriesConfig& config, PyObject* item) { config.scale_min = ToDouble(item); } },
+		{ "scale_max", [](mvHeatSeriesConfig& config, PyObject* item) { config.scale_max = ToDouble(item); } },
 
-	// flags
-	flagop("col_major", ImPlotHeatmapFlags_ColMajor, outConfig.flags);
+		// flags
+		{ "col_major", Keywords::flag(&mvHeatSeriesConfig::flags, ImPlotHeatmapFlags_ColMajor) },
 
-	bool valueChanged = false;
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { valueChanged = true; (*outConfig.value)[0] = ToDoubleVect(item); }
+		// runs after the bounds above, which it reads
+		{ "x", [](mvHeatSeriesConfig& config, PyObject* item)
+			{
+				ToDoubleVect(item, (*config.value)[0]);
+				(*config.value)[1].push_back(config.bounds_min.y);
+				(*config.value)[1].push_back(config.bounds_max.y);
+			} },
+	};
 
-	if (valueChanged)
-	{
-		(*outConfig.value)[1].push_back(outConfig.bounds_min.y);
-		(*outConfig.value)[1].push_back(outConfig.bounds_max.y);
-	}
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3004,8 +3119,12 @@ DearPyGui::set_configuration(PyObject* inDict, mvDigitalSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
+	static const mvKeywordTable<mvDigitalSeriesConfig> keywords = {
+		{ "x", [](mvDigitalSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
+		{ "y", [](mvDigitalSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[1]); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3014,28 +3133,22 @@ DearPyGui::set_configuration(PyObject* inDict, mvHistogramSeriesConfig& outConfi
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "bins")) { outConfig.bins = ToInt(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "bar_scale")) { outConfig.barScale = ToFloat(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "min_range")) { outConfig.min = ToDouble(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "max_range")) { outConfig.max = ToDouble(item); }
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
-	};
+	using Keywords = mvKeywordTable<mvHistogramSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mvHistogramSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
+		{ "bins", [](mvHistogramSeriesConfig& config, PyObject* item) { config.bins = ToInt(item); } },
+		{ "bar_scale", [](mvHistogramSeriesConfig& config, PyObject* item) { config.barScale = ToFloat(item); } },
+		{ "min_range", [](mvHistogramSeriesConfig& config, PyObject* item) { config.min = ToDouble(item); } },
+		{ "max_range", [](mvHistogramSeriesConfig& config, PyObject* item) { config.max = ToDouble(item); } },
 
-	auto reverse_flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags &= ~flag : flags |= flag;
+		// histogram series flags
+		{ "cumulative", Keywords::flag(&mvHistogramSeriesConfig::flags, ImPlotHistogramFlags_Cumulative) },
+		{ "density", Keywords::flag(&mvHistogramSeriesConfig::flags, ImPlotHistogramFlags_Density) },
+		{ "outliers", Keywords::flag(&mvHistogramSeriesConfig::flags, ImPlotHistogramFlags_NoOutliers, true) },
+		{ "horizontal", Keywords::flag(&mvHistogramSeriesConfig::flags, ImPlotHistogramFlags_Horizontal) },
 	};
 
-	// histogram series flags
-	flagop("cumulative", ImPlotHistogramFlags_Cumulative, outConfig.flags);
-	flagop("density", ImPlotHistogramFlags_Density, outConfig.flags);
-	reverse_flagop("outliers", ImPlotHistogramFlags_NoOutliers, outConfig.flags);
-	flagop("horizontal", ImPlotHistogramFlags_Horizontal, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3044,30 +3157,29 @@ DearPyGui::set_configuration(PyObject* inDict, mvPieSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "format")) outConfig.format = ToString(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) outConfig.x = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) outConfig.y = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "radius")) outConfig.radius = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "angle")) outConfig.angle = ToDouble(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "labels"))
-	{
-		outConfig.labels = ToStringVect(item);
-		outConfig.clabels.clear();
-		for (const auto& label : outConfig.labels)
-			outConfig.clabels.push_back(label.c_str());
-	}
+	using Keywords = mvKeywordTable<mvPieSeriesConfig>;
+	static const Keywords keywords = {
+		{ "format", [](mvPieSeriesConfig& config, PyObject* item) { config.format = ToString(item); } },
+		{ "x", [](mvPieSeriesConfig& config, PyObject* item) { config.x = ToDouble(item); } },
+		{ "y", [](mvPieSeriesConfig& config, PyObject* item) { config.y = ToDouble(item); } },
+		{ "radius", [](mvPieSeriesConfig& config, PyObject* item) { config.radius = ToDouble(item); } },
+		{ "angle", [](mvPieSeriesConfig& config, PyObject* item) { config.angle = ToDouble(item); } },
+		{ "labels", [](mvPieSeriesConfig& config, PyObject* item)
+			{
+				config.labels = ToStringVect(item);
+				config.clabels.clear();
+				for (const auto& label : config.labels)
+					config.clabels.push_back(label.c_str());
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "values")) { (*outConfig.value)[0] = ToDoubleVect(item); }
+		{ "values", [](mvPieSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// pie chart flags
+		{ "normalize", Keywords::flag(&mvPieSeriesConfig::flags, ImPlotPieChartFlags_Normalize) },
+		{ "ignore_hidden", Keywords::flag(&mvPieSeriesConfig::flags, ImPlotPieChartFlags_IgnoreHidden) },
 	};
 
-	// pie chart flags
-	flagop("normalize", ImPlotPieChartFlags_Normalize, outConfig.flags);
-	flagop("ignore_hidden", ImPlotPieChartFlags_IgnoreHidden, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3076,19 +3188,18 @@ DearPyGui::set_configuration(PyObject* inDict, mvLabelSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "offset")) outConfig.offset = ToVec2(item);
+	using Keywords = mvKeywordTable<mvLabelSeriesConfig>;
+	static const Keywords keywords = {
+		{ "offset", [](mvLabelSeriesConfig& config, PyObject* item) { config.offset = ToVec2(item); } },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = std::vector<double>{ToDouble(item)}; }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = std::vector<double>{ToDouble(item)}; }
+		{ "x", [](mvLabelSeriesConfig& config, PyObject* item) { (*config.value)[0] = std::vector<double>{ToDouble(item)}; } },
+		{ "y", [](mvLabelSeriesConfig& config, PyObject* item) { (*config.value)[1] = std::vector<double>{ToDouble(item)}; } },
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+		// plot text flags
+		{ "vertical", Keywords::flag(&mvLabelSeriesConfig::flags, ImPlotTextFlags_Vertical) },
 	};
 
-	// plot text flags
-	flagop("vertical", ImPlotTextFlags_Vertical, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 
 }
 
@@ -3098,36 +3209,40 @@ DearPyGui::set_configuration(PyObject* inDict, mvImageSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "uv_min")) outConfig.uv_min = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "uv_max")) outConfig.uv_max = ToVec2(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "tint_color")) outConfig.tintColor = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "bounds_min"))
-	{
-		auto result = ToPoint(item);
-		outConfig.bounds_min.x = result.x;
-		outConfig.bounds_min.y = result.y;
-	}
-	if (PyObject* item = PyDict_GetItemString(inDict, "bounds_max"))
-	{
-		auto result = ToPoint(item);
-		outConfig.bounds_max.x = result.x;
-		outConfig.bounds_max.y = result.y;
-	}
+	static const mvKeywordTable<mvImageSeriesConfig> keywords = {
+		{ "uv_min", [](mvImageSeriesConfig& config, PyObject* item) { config.uv_min = ToVec2(item); } },
+		{ "uv_max", [](mvImageSeriesConfig& config, PyObject* item) { config.uv_max = ToVec2(item); } },
+		{ "tint_color", [](mvImageSeriesConfig& config, PyObject* item) { config.tintColor = ToColor(item); } },
+		{ "bounds_min", [](mvImageSeriesConfig& config, PyObject* item)
+			{
+				auto result = ToPoint(item);
+				config.bounds_min.x = result.x;
+				config.bounds_min.y = result.y;
+			} },
+		{ "bounds_max", [](mvImageSeriesConfig& config, PyObject* item)
+			{
+				auto result = ToPoint(item);
+				config.bounds_max.x = result.x;
+				config.bounds_max.y = result.y;
+			} },
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "texture_tag"))
-	{
-		mvUUID textureUUID = GetIDFromPyObject(item);
-		if (textureUUID == MV_ATLAS_UUID)
-		{
-			outConfig._texture = std::make_shared<mvStaticTexture>(textureUUID);
-		}
-		else
-		{
-			outConfig._texture = GetRefItem(*GContext->itemRegistry, textureUUID);
-			if (!outConfig._texture)
-				mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(mvAppItemType::mvImageSeries), "Texture not found.", nullptr);
-		}
-	}
+		{ "texture_tag", [](mvImageSeriesConfig& config, PyObject* item)
+			{
+				mvUUID textureUUID = GetIDFromPyObject(item);
+				if (textureUUID == MV_ATLAS_UUID)
+				{
+					config._texture = std::make_shared<mvStaticTexture>(textureUUID);
+				}
+				else
+				{
+					config._texture = GetRefItem(*GContext->itemRegistry, textureUUID);
+					if (!config._texture)
+						mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(mvAppItemType::mvImageSeries), "Texture not found.", nullptr);
+				}
+			} },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3136,9 +3251,13 @@ DearPyGui::set_configuration(PyObject* inDict, mvAreaSeriesConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "fill")) outConfig.fill = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
+	static const mvKeywordTable<mvAreaSeriesConfig> keywords = {
+		{ "fill", [](mvAreaSeriesConfig& config, PyObject* item) { config.fill = ToColor(item); } },
+		{ "x", [](mvAreaSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
+		{ "y", [](mvAreaSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[1]); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3146,16 +3265,21 @@ DearPyGui::set_configuration(PyObject* inDict, mvCandleSeriesConfig& outConfig)
 {
 	if (inDict == nullptr)
 		return;
-	if (PyObject* item = PyDict_GetItemString(inDict, "bull_color")) outConfig.bullColor = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "bear_color")) outConfig.bearColor = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "weight")) outConfig.weight = ToFloat(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "tooltip")) outConfig.tooltip = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "dates")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "opens")) { (*outConfig.value)[1] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "closes")) { (*outConfig.value)[2] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "lows")) { (*outConfig.value)[3] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "highs")) { (*outConfig.value)[4] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "time_unit")) { outConfig.timeunit = ToInt(item); }
+
+	static const mvKeywordTable<mvCandleSeriesConfig> keywords = {
+		{ "bull_color", [](mvCandleSeriesConfig& config, PyObject* item) { config.bullColor = ToColor(item); } },
+		{ "bear_color", [](mvCandleSeriesConfig& config, PyObject* item) { config.bearColor = ToColor(item); } },
+		{ "weight", [](mvCandleSeriesConfig& config, PyObject* item) { config.weight = ToFloat(item); } },
+		{ "tooltip", [](mvCandleSeriesConfig& config, PyObject* item) { config.tooltip = ToBool(item); } },
+		{ "dates", [](mvCandleSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
+		{ "opens", [](mvCandleSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[1]); } },
+		{ "closes", [](mvCandleSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[2]); } },
+		{ "lows", [](mvCandleSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[3]); } },
+		{ "highs", [](mvCandleSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[4]); } },
+		{ "time_unit", [](mvCandleSeriesConfig& config, PyObject* item) { config.timeunit = ToInt(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3163,21 +3287,21 @@ DearPyGui::set_configuration(PyObject* inDict, mvCustomSeriesConfig& outConfig)
 {
 	if (inDict == nullptr)
 		return;
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y1")) { (*outConfig.value)[2] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y2")) { (*outConfig.value)[3] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y3")) { (*outConfig.value)[4] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "tooltip")) { outConfig.tooltip = ToBool(item); }
 
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mvCustomSeriesConfig>;
+	static const Keywords keywords = {
+		{ "x", [](mvCustomSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[0]); } },
+		{ "y", [](mvCustomSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[1]); } },
+		{ "y1", [](mvCustomSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[2]); } },
+		{ "y2", [](mvCustomSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[3]); } },
+		{ "y3", [](mvCustomSeriesConfig& config, PyObject* item) { ToDoubleVect(item, (*config.value)[4]); } },
+		{ "tooltip", [](mvCustomSeriesConfig& config, PyObject* item) { config.tooltip = ToBool(item); } },
+
+		// flags
+		{ "no_fit", Keywords::flag(&mvCustomSeriesConfig::flags, ImPlotItemFlags_NoFit) },
 	};
 
-	// flags
-	flagop("no_fit", ImPlotItemFlags_NoFit, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3186,9 +3310,13 @@ DearPyGui::set_configuration(PyObject* inDict, mvAnnotationConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "color")) outConfig.color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "clamped")) outConfig.clamped = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "offset")) outConfig.pixOffset = ToVec2(item);
+	static const mvKeywordTable<mvAnnotationConfig> keywords = {
+		{ "color", [](mvAnnotationConfig& config, PyObject* item) { config.color = ToColor(item); } },
+		{ "clamped", [](mvAnnotationConfig& config, PyObject* item) { config.clamped = ToBool(item); } },
+		{ "offset", [](mvAnnotationConfig& config, PyObject* item) { config.pixOffset = ToVec2(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3197,8 +3325,12 @@ DearPyGui::set_configuration(PyObject* inDict, mvAxisTagConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "color")) outConfig.color = ToColor(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "auto_rounding")) outConfig.auto_rounding = ToBool(item);
+	static const mvKeywordTable<mvAxisTagConfig> keywords = {
+		{ "color", [](mvAxisTagConfig& config, PyObject* item) { config.color = ToColor(item); } },
+		{ "auto_rounding", [](mvAxisTagConfig& config, PyObject* item) { config.auto_rounding = ToBool(item); } },
+	};
+
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3207,28 +3339,27 @@ DearPyGui::set_configuration(PyObject* inDict, mvSubPlotsConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "rows")) outConfig.rows = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "columns")) outConfig.cols = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "row_ratios")) outConfig.row_ratios = ToFloatVect(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "column_ratios")) outConfig.col_ratios = ToFloatVect(item);
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mvSubPlotsConfig>;
+	static const Keywords keywords = {
+		{ "rows", [](mvSubPlotsConfig& config, PyObject* item) { config.rows = ToInt(item); } },
+		{ "columns", [](mvSubPlotsConfig& config, PyObject* item) { config.cols = ToInt(item); } },
+		{ "row_ratios", [](mvSubPlotsConfig& config, PyObject* item) { config.row_ratios = ToFloatVect(item); } },
+		{ "column_ratios", [](mvSubPlotsConfig& config, PyObject* item) { config.col_ratios = ToFloatVect(item); } },
+
+		// subplot flags
+		{ "no_title", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_NoTitle) },
+		{ "no_menus", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_NoMenus) },
+		{ "no_resize", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_NoResize) },
+		{ "no_align", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_NoAlign) },
+		{ "share_series", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_ShareItems) },
+		{ "link_rows", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_LinkRows) },
+		{ "link_columns", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_LinkCols) },
+		{ "link_all_x", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_LinkAllX) },
+		{ "link_all_y", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_LinkAllY) },
+		{ "column_major", Keywords::flag(&mvSubPlotsConfig::flags, ImPlotSubplotFlags_ColMajor) },
 	};
 
-	// subplot flags
-	flagop("no_title", ImPlotSubplotFlags_NoTitle, outConfig.flags);
-	flagop("no_menus", ImPlotSubplotFlags_NoMenus, outConfig.flags);
-	flagop("no_resize", ImPlotSubplotFlags_NoResize, outConfig.flags);
-	flagop("no_align", ImPlotSubplotFlags_NoAlign, outConfig.flags);
-	flagop("share_series", ImPlotSubplotFlags_ShareItems, outConfig.flags);
-	flagop("link_rows", ImPlotSubplotFlags_LinkRows, outConfig.flags);
-	flagop("link_columns", ImPlotSubplotFlags_LinkCols, outConfig.flags);
-	flagop("link_all_x", ImPlotSubplotFlags_LinkAllX, outConfig.flags);
-	flagop("link_all_y", ImPlotSubplotFlags_LinkAllY, outConfig.flags);
-	flagop("column_major", ImPlotSubplotFlags_ColMajor, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 }
 
 void
@@ -3237,36 +3368,35 @@ DearPyGui::set_configuration(PyObject* inDict, mvPlotAxisConfig& outConfig, mvAp
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "scale")) outConfig.scale = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "tick_format")) outConfig.formatter = ToString(item);
-
-	// Legacy
-	if (PyObject* item = PyDict_GetItemString(inDict, "log_scale")) outConfig.scale = (ToBool(item) ? ImPlotScale_Log10 : outConfig.scale);
-	if (PyObject* item = PyDict_GetItemString(inDict, "time")) outConfig.scale = (ToBool(item) ? ImPlotScale_Time : outConfig.scale);
-
-	// helper for bit flipping
-	auto flagop = [inDict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(inDict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mvPlotAxisConfig>;
+	static const Keywords keywords = {
+		{ "scale", [](mvPlotAxisConfig& config, PyObject* item) { config.scale = ToInt(item); } },
+		{ "tick_format", [](mvPlotAxisConfig& config, PyObject* item) { config.formatter = ToString(item); } },
+
+		// Legacy
+		{ "log_scale", [](mvPlotAxisConfig& config, PyObject* item) { config.scale = (ToBool(item) ? ImPlotScale_Log10 : config.scale); } },
+		{ "time", [](mvPlotAxisConfig& config, PyObject* item) { config.scale = (ToBool(item) ? ImPlotScale_Time : config.scale); } },
+
+		// axis flags
+		{ "no_label", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_NoLabel) },
+		{ "no_gridlines", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_NoGridLines) },
+		{ "no_tick_marks", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_NoTickMarks) },
+		{ "no_tick_labels", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_NoTickLabels) },
+		{ "no_initial_fit", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_NoInitialFit) },
+		{ "no_menus", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_NoMenus) },
+		{ "no_side_switch", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_NoSideSwitch) },
+		{ "no_highlight", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_NoHighlight) },
+		{ "opposite", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_Opposite) },
+		{ "foreground_grid", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_Foreground) },
+		{ "invert", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_Invert) },
+		{ "auto_fit", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_AutoFit) },
+		{ "range_fit", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_RangeFit) },
+		{ "pan_stretch", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_PanStretch) },
+		{ "lock_min", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_LockMin) },
+		{ "lock_max", Keywords::flag(&mvPlotAxisConfig::flags, ImPlotAxisFlags_LockMax) },
 	};
 
-	// axis flags
-	flagop("no_label", ImPlotAxisFlags_NoLabel, outConfig.flags);
-	flagop("no_gridlines", ImPlotAxisFlags_NoGridLines, outConfig.flags);
-	flagop("no_tick_marks", ImPlotAxisFlags_NoTickMarks, outConfig.flags);
-	flagop("no_tick_labels", ImPlotAxisFlags_NoTickLabels, outConfig.flags);
-	flagop("no_initial_fit", ImPlotAxisFlags_NoInitialFit, outConfig.flags);
-	flagop("no_menus", ImPlotAxisFlags_NoMenus, outConfig.flags);
-	flagop("no_side_switch", ImPlotAxisFlags_NoSideSwitch, outConfig.flags);
-	flagop("no_highlight", ImPlotAxisFlags_NoHighlight, outConfig.flags);
-	flagop("opposite", ImPlotAxisFlags_Opposite, outConfig.flags);
-	flagop("foreground_grid", ImPlotAxisFlags_Foreground, outConfig.flags);
-	flagop("invert", ImPlotAxisFlags_Invert, outConfig.flags);
-	flagop("auto_fit", ImPlotAxisFlags_AutoFit, outConfig.flags);
-	flagop("range_fit", ImPlotAxisFlags_RangeFit, outConfig.flags);
-	flagop("pan_stretch", ImPlotAxisFlags_PanStretch, outConfig.flags);
-	flagop("lock_min", ImPlotAxisFlags_LockMin, outConfig.flags);
-	flagop("lock_max", ImPlotAxisFlags_LockMax, outConfig.flags);
+	keywords.apply(inDict, outConfig);
 
 	if (item.info.shownLastFrame)
 	{
@@ -3871,7 +4001,7 @@ mvDragPoint::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<double, 2>>(temp_array);
+		configData.value = mvAllocateShared<std::array<double, 2>>(temp_array);
 }
 
 void
@@ -3886,7 +4016,7 @@ mvDragRect::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<double, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<double, 4>>(temp_array);
 }
 
 void mvAnnotation::setPyValue(PyObject* value)
@@ -3900,5 +4030,5 @@ void mvAnnotation::setPyValue(PyObject* value)
 	if (configData.value)
 		*configData.value = temp_array;
 	else
-		configData.value = std::make_shared<std::array<double, 4>>(temp_array);
+		configData.value = mvAllocateShared<std::array<double, 4>>(temp_array);
 }
\ No newline at end of file
@@ -32,6 +32,7 @@ struct mvImageSeriesConfig;
 struct mvAreaSeriesConfig;
 struct mvCandleSeriesConfig;
 struct mvCustomSeriesConfig;
+struct _mvBasicSeriesConfig;
 
 namespace DearPyGui
 {
@@ -127,6 +128,13 @@ namespace DearPyGui
     void set_data_source(mvAppItem& item, mvUUID dataSource, mvDragRectConfig& outConfig);
     void set_data_source(mvAppItem& item, mvUUID dataSource, mvDragPointConfig& outConfig);
     void set_data_source(mvAppItem& item, mvUUID dataSource, std::shared_ptr<std::vector<std::vector<double>>>& outValue);
+    void set_data_source(mvAppItem& item, mvUUID dataSource, _mvBasicSeriesConfig& outConfig);
+
+    // zero-copy series storage (see `_mvBasicSeriesConfig::views`)
+    void      share_series_value(mvAppItem& source);  // copies views into `value` before it gets shared
+    void      set_series_column(PyObject* value, _mvBasicSeriesConfig& outConfig, int column);
+    void      set_series_value (PyObject* value, _mvBasicSeriesConfig& outConfig);
+    PyObject* get_series_value (const _mvBasicSeriesConfig& config, bool asBuffer = false);
 
     // draw commands
     void draw_plot              (ImDrawList* drawlist, mvAppItem& item, mvPlotConfig& config);
@@ -165,12 +173,20 @@ namespace DearPyGui
 
 struct _mvBasicSeriesConfig
 {
-    std::shared_ptr<std::vector<std::vector<double>>> value = std::make_shared<std::vector<std::vector<double>>>(
+    std::shared_ptr<std::vector<std::vector<double>>> value = mvAllocateShared<std::vector<std::vector<double>>>(
         std::vector<std::vector<double>>{ std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{} });
+
+    // Columns given as contiguous float64 buffers (i.e. numpy arrays) are
+    // referenced in place instead of being copied into `value`. A valid view
+    // takes precedence over the matching entry of `value`. Views are only
+    // touched while holding GContext->mutex, same as `value`.
+    // While `value` is shared with other items (through `source`), columns
+    // are always copied, since those items only read `value`.
+    std::shared_ptr<std::array<mvDoubleBufferView, 5>> views = mvAllocateShared<std::array<mvDoubleBufferView, 5>>();
 };
 
 struct mvLineSeriesConfig : _mvBasicSeriesConfig
@@ -203,7 +219,7 @@ struct mvBarGroupSeriesConfig
     // The config must be valid at all times.
     std::vector<std::string> label_ids { std::string() };
     int group_size = 1;
-    std::shared_ptr<std::vector<std::vector<double>>> value = std::make_shared<std::vector<std::vector<double>>>(
+    std::shared_ptr<std::vector<std::vector<double>>> value = mvAllocateShared<std::vector<std::vector<double>>>(
         std::vector<std::vector<double>>{ std::vector<double>{} });
 };
 
@@ -236,7 +252,7 @@ struct _mvDragItem {
 
 struct mvDragPointConfig : _mvDragItem
 {
-    std::shared_ptr<std::array<double, 2>> value = std::make_shared<std::array<double, 2>>(std::array<double, 2>{0.0, 0.0});
+    std::shared_ptr<std::array<double, 2>> value = mvAllocateShared<std::array<double, 2>>(std::array<double, 2>{0.0, 0.0});
     double                       disabled_value[2]{};
     bool                         show_label = true;
     float                        radius = 4.0f;
@@ -247,13 +263,13 @@ struct mvDragPointConfig : _mvDragItem
 
 struct mvDragRectConfig : _mvDragItem
 {
-    std::shared_ptr<std::array<double, 4>> value = std::make_shared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
+    std::shared_ptr<std::array<double, 4>> value = mvAllocateShared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
     double                       disabled_value[4]{};
 };
 
 struct mvDragLineConfig : _mvDragItem
 {
-    std::shared_ptr<double> value = std::make_shared<double>(0.0);
+    std::shared_ptr<double> value = mvAllocateShared<double>(0.0);
     float               disabled_value = 0.0;
     bool                show_label = true;
     float               thickness = 1.0f;
@@ -359,7 +375,7 @@ struct mvCustomSeriesConfig : _mvBasicSeriesConfig
 
 struct mvAnnotationConfig
 {
-    std::shared_ptr<std::array<double, 4>> value = std::make_shared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
+    std::shared_ptr<std::array<double, 4>> value = mvAllocateShared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
     double                       disabled_value[4]{};
     mvColor                      color = mvColor(0.0f, 0.0f, 0.0f, -1.0f);
     bool                         clamped = true;
@@ -368,7 +384,7 @@ struct mvAnnotationConfig
 
 struct mvAxisTagConfig
 {
-    std::shared_ptr<double>     value = std::make_shared<double>(0.0);
+    std::shared_ptr<double>     value = mvAllocateShared<double>(0.0);
     double                      disabled_value = 0.0;
     mvColor                     color = mvColor(0.0f, 0.0f, 0.0f, -1.0f);
     bool                        auto_rounding = false;
@@ -517,10 +533,11 @@ public:
     void draw(ImDrawList* drawlist, float x, float y) override { DearPyGui::draw_bar_series(drawlist, *this, configData); }
     void handleSpecificKeywordArgs(PyObject* dict) override { DearPyGui::set_configuration(dict, configData); }
     void getSpecificConfiguration(PyObject* dict) override { DearPyGui::fill_configuration_dict(configData, dict); }
-    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
+    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData); }
     void* getValue() override { return &configData.value; }
-    PyObject* getPyValue() override{ return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyValue() override { return DearPyGui::get_series_value(configData); }
+    PyObject* getPyBufferValue() override { return DearPyGui::get_series_value(configData, true); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_value(value, configData); }
 };
 
 class mvBarGroupSeries : public mvAppItem
@@ -535,7 +552,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override{ return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvInfLineSeries : public mvAppItem
@@ -550,7 +568,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override{ return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvLineSeries : public mvAppItem
@@ -562,10 +581,11 @@ public:
     void draw(ImDrawList* drawlist, float x, float y) override { DearPyGui::draw_line_series(drawlist, *this, configData); }
     void handleSpecificKeywordArgs(PyObject* dict) override { DearPyGui::set_configuration(dict, configData); }
     void getSpecificConfiguration(PyObject* dict) override { DearPyGui::fill_configuration_dict(configData, dict); }
-    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
+    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData); }
     void* getValue() override { return &configData.value; }
-    PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyValue() override { return DearPyGui::get_series_value(configData); }
+    PyObject* getPyBufferValue() override { return DearPyGui::get_series_value(configData, true); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_value(value, configData); }
 };
 
 class mvScatterSeries : public mvAppItem
@@ -577,10 +597,11 @@ public:
     void draw(ImDrawList* drawlist, float x, float y) override { DearPyGui::draw_scatter_series(drawlist, *this, configData); }
     void handleSpecificKeywordArgs(PyObject* dict) override { DearPyGui::set_configuration(dict, configData); }
     void getSpecificConfiguration(PyObject* dict) override { DearPyGui::fill_configuration_dict(configData, dict); }
-    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
+    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData); }
     void* getValue() override { return &configData.value; }
-    PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyValue() override { return DearPyGui::get_series_value(configData); }
+    PyObject* getPyBufferValue() override { return DearPyGui::get_series_value(configData, true); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_value(value, configData); }
 };
 
 class mvShadeSeries : public mvAppItem
@@ -592,10 +613,11 @@ public:
     void draw(ImDrawList* drawlist, float x, float y) override { DearPyGui::draw_shade_series(drawlist, *this, configData); }
     void handleSpecificKeywordArgs(PyObject* dict) override { DearPyGui::set_configuration(dict, configData); }
     void getSpecificConfiguration(PyObject* dict) override { DearPyGui::fill_configuration_dict(configData, dict); }
-    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
+    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData); }
     void* getValue() override { return &configData.value; }
-    PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyValue() override { return DearPyGui::get_series_value(configData); }
+    PyObject* getPyBufferValue() override { return DearPyGui::get_series_value(configData, true); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_value(value, configData); }
 };
 
 class mvStairSeries : public mvAppItem
@@ -607,10 +629,11 @@ public:
     void draw(ImDrawList* drawlist, float x, float y) override { DearPyGui::draw_stair_series(drawlist, *this, configData); }
     void handleSpecificKeywordArgs(PyObject* dict) override { DearPyGui::set_configuration(dict, configData); }
     void getSpecificConfiguration(PyObject* dict) override { DearPyGui::fill_configuration_dict(configData, dict); }
-    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
+    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData); }
     void* getValue() override { return &configData.value; }
-    PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyValue() override { return DearPyGui::get_series_value(configData); }
+    PyObject* getPyBufferValue() override { return DearPyGui::get_series_value(configData, true); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_value(value, configData); }
 };
 
 class mvStemSeries : public mvAppItem
@@ -622,10 +645,11 @@ public:
     void draw(ImDrawList* drawlist, float x, float y) override { DearPyGui::draw_stem_series(drawlist, *this, configData); }
     void handleSpecificKeywordArgs(PyObject* dict) override { DearPyGui::set_configuration(dict, configData); }
     void getSpecificConfiguration(PyObject* dict) override { DearPyGui::fill_configuration_dict(configData, dict); }
-    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
+    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData); }
     void* getValue() override { return &configData.value; }
-    PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyValue() override { return DearPyGui::get_series_value(configData); }
+    PyObject* getPyBufferValue() override { return DearPyGui::get_series_value(configData, true); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_value(value, configData); }
 };
 
 class mv2dHistogramSeries : public mvAppItem
@@ -640,7 +664,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvErrorSeries : public mvAppItem
@@ -655,7 +680,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvHeatSeries : public mvAppItem
@@ -670,7 +696,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvHistogramSeries : public mvAppItem
@@ -685,7 +712,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvDigitalSeries : public mvAppItem
@@ -700,7 +728,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvPieSeries : public mvAppItem
@@ -715,7 +744,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvLabelSeries : public mvAppItem
@@ -730,7 +760,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }  
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }  
 };
 
 class mvImageSeries : public mvAppItem
@@ -745,7 +776,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvAreaSeries : public mvAppItem
@@ -760,7 +792,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvCandleSeries : public mvAppItem
@@ -775,7 +808,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvCustomSeries : public mvAppItem
@@ -790,7 +824,8 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*configData.value); }
+    void setPyValue(PyObject* value) override { ToVectVectDouble(value, *configData.value); }
 };
 
 class mvAnnotation : public mvAppItem
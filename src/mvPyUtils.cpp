@@ -9,8 +9,14 @@
 #include <utility>
 #include <string>
 #include <ctime>
+#include <type_traits>
 #include <frameobject.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MV_BUFFER_SSE2
+#include <immintrin.h>
+#endif
+
 mvGlobalIntepreterLock::mvGlobalIntepreterLock()
 {
     _gstate = (int)PyGILState_Ensure();
@@ -55,6 +61,86 @@ mvPyObject::~mvPyObject()
     Py_XDECREF(m_rawObject);
 }
 
+mvPyCallback::mvPyCallback(PyObject* rawObject, bool borrowed)
+	:
+	mvPyObject(rawObject, borrowed),
+	m_argCount(GetCallableArgCount(rawObject))
+{
+}
+
+i32
+GetCallableArgCount(PyObject* callable)
+{
+    if (callable == nullptr || callable == Py_None)
+        return 0;
+
+    // for bound methods, __code__ is forwarded to the underlying function
+    mvPyObject code(PyObject_GetAttrString(callable, "__code__"));
+    if (!code.isOk())
+    {
+        PyErr_Clear();
+        return -1;
+    }
+
+    mvPyObject argCount(PyObject_GetAttrString(code, "co_argcount"));
+    if (!argCount.isOk())
+    {
+        PyErr_Clear();
+        return -1;
+    }
+
+    i32 count = (i32)PyLong_AsLong(argCount);
+    if (PyMethod_Check(callable))
+        count--;
+    return count;
+}
+
+mvDoubleBufferView::~mvDoubleBufferView()
+{
+    release();
+}
+
+bool
+mvDoubleBufferView::acquire(PyObject* obj)
+{
+    release();
+
+    if (obj == nullptr || PyTuple_Check(obj) || PyList_Check(obj) || !PyObject_CheckBuffer(obj))
+        return false;
+
+    if (PyObject_GetBuffer(obj, &m_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+    {
+        // not contiguous; let the caller fall back to copying
+        PyErr_Clear();
+        return false;
+    }
+
+    // native-order float64 only ("d" or "@d" / "=d" on little endian hosts)
+    const char* format = m_view.format ? m_view.format : "B";
+    if (*format == '@' || *format == '=')
+        format++;
+
+    if (strcmp(format, "d") != 0 || m_view.itemsize != (Py_ssize_t)sizeof(double))
+    {
+        PyBuffer_Release(&m_view);
+        return false;
+    }
+
+    m_valid = true;
+    return true;
+}
+
+void
+mvDoubleBufferView::release()
+{
+    if (!m_valid)
+        return;
+
+    mvGlobalIntepreterLock gil;
+    PyBuffer_Release(&m_view);
+    m_valid = false;
+}
+
 void
 mvThrowPythonError(mvErrorCode code, const std::string& message)
 {
@@ -838,6 +924,55 @@ ToPyFloatList(const double* value, int count)
     return result;
 }
 
+static PyObject*
+ToPyMemoryView(const void* value, Py_ssize_t size, const char* format)
+{
+    // The bytes object owns a private copy, so the view stays valid (and
+    // unchanged) no matter what the render thread does to the source later.
+    mvPyObject bytes(PyBytes_FromStringAndSize((const char*)value, size));
+    if (!bytes.isOk())
+        return nullptr;
+
+    mvPyObject view(PyMemoryView_FromObject(bytes));
+    if (!view.isOk())
+        return nullptr;
+
+    return PyObject_CallMethod(view, "cast", "s", format);
+}
+
+PyObject*
+ToPyMemoryView(const float* value, int count)
+{
+    return ToPyMemoryView(value, (Py_ssize_t)count * sizeof(float), "f");
+}
+
+PyObject*
+ToPyMemoryView(const double* value, int count)
+{
+    return ToPyMemoryView(value, (Py_ssize_t)count * sizeof(double), "d");
+}
+
+PyObject*
+ToPyMemoryViewList(const std::vector<std::vector<double>>& value)
+{
+    PyObject* result = PyList_New(value.size());
+    if (result == nullptr)
+        return nullptr;
+
+    for (size_t i = 0; i < value.size(); ++i)
+    {
+        PyObject* view = ToPyMemoryView(value[i].data(), (Py_ssize_t)value[i].size() * sizeof(double), "d");
+        if (view == nullptr)
+        {
+            Py_DECREF(result);
+            return nullptr;
+        }
+        PyList_SET_ITEM(result, i, view);
+    }
+
+    return result;
+}
+
 tm
 ToTime(PyObject* value, const std::string& message)
 {
@@ -1007,92 +1142,236 @@ ToString(PyObject* value, const std::string& message)
 
 }
 
-static std::function<float(Py_buffer&, Py_ssize_t index)>
-BufferViewFunctionsFloat(Py_buffer& bufferView)
-{
-    if (strcmp(bufferView.format, "f") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return *((float*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "d") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((double*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "i") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((int*)bufferView.buf + index); };
+//-----------------------------------------------------------------------------
+// buffer conversion kernels
+//   * one tight loop per (source format, destination type) pair
+//   * SSE2/AVX2 paths for the common numpy dtypes, scalar loop otherwise
+//-----------------------------------------------------------------------------
 
-    else if (strcmp(bufferView.format, "I") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((unsigned int*)bufferView.buf + index); };
+template<typename Dst>
+using mvBufferConverter = void(*)(const void* src, Dst* dst, Py_ssize_t count);
 
-    else if (strcmp(bufferView.format, "l") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((long*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "L") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((long long*)bufferView.buf + index); };
+template<typename Src, typename Dst>
+struct mvBufferKernel
+{
+    // floating point values headed for an integer go through long long first,
+    // so narrowing (i.e. to unsigned char) wraps instead of being undefined
+    using Intermediate = typename std::conditional<std::is_floating_point<Src>::value && std::is_integral<Dst>::value, long long, Src>::type;
 
-    else if (strcmp(bufferView.format, "k") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((unsigned long*)bufferView.buf + index); };
+    static void convert(const void* src, Dst* dst, Py_ssize_t count)
+    {
+        const Src* in = (const Src*)src;
 
-    else if (strcmp(bufferView.format, "K") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((unsigned long long*)bufferView.buf + index); };
+        if (std::is_same<Src, Dst>::value)
+        {
+            memcpy(dst, in, count * sizeof(Dst));
+            return;
+        }
 
-    else if (strcmp(bufferView.format, "B") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((unsigned char*)bufferView.buf + index); };
+        for (Py_ssize_t i = 0; i < count; ++i)
+            dst[i] = (Dst)(Intermediate)in[i];
+    }
+};
 
-    else if (strcmp(bufferView.format, "b") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((signed char*)bufferView.buf + index); };
+#if defined(MV_BUFFER_SSE2)
 
-    else if (strcmp(bufferView.format, "c") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((char*)bufferView.buf + index); };
-    else
+template<>
+struct mvBufferKernel<float, double>
+{
+    static void convert(const void* src, double* dst, Py_ssize_t count)
     {
-        mvThrowPythonError(mvErrorCode::mvWrongType, "Unknown buffer type.");
-        mvThrowPythonError(mvErrorCode::mvWrongType, bufferView.format);
-        mvThrowPythonError(mvErrorCode::mvWrongType, "Currently supported buffer types f, d, l, B");
-        return nullptr;
+        const float* in = (const float*)src;
+        Py_ssize_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4)
+            _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(in + i)));
+#endif
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 v = _mm_loadu_ps(in + i);
+            _mm_storeu_pd(dst + i, _mm_cvtps_pd(v));
+            _mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+        }
+        for (; i < count; ++i)
+            dst[i] = (double)in[i];
     }
-}
+};
 
-static std::function<int(Py_buffer&, Py_ssize_t index)>
-BufferViewFunctionsInt(Py_buffer& bufferView)
+template<>
+struct mvBufferKernel<double, float>
 {
-    if (strcmp(bufferView.format, "f") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((float*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "d") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((double*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "i") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((int*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "I") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((unsigned int*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "l") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((long*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "L") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((long long*)bufferView.buf + index); };
-
-    else if (strcmp(bufferView.format, "k") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((unsigned long*)bufferView.buf + index); };
+    static void convert(const void* src, float* dst, Py_ssize_t count)
+    {
+        const double* in = (const double*)src;
+        Py_ssize_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(in + i)));
+#endif
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(in + i));
+            __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(in + i + 2));
+            _mm_storeu_ps(dst + i, _mm_movelh_ps(lo, hi));
+        }
+        for (; i < count; ++i)
+            dst[i] = (float)in[i];
+    }
+};
 
-    else if (strcmp(bufferView.format, "K") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((unsigned long long*)bufferView.buf + index); };
+template<>
+struct mvBufferKernel<int, float>
+{
+    static void convert(const void* src, float* dst, Py_ssize_t count)
+    {
+        const int* in = (const int*)src;
+        Py_ssize_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(in + i))));
+#endif
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(in + i))));
+        for (; i < count; ++i)
+            dst[i] = (float)in[i];
+    }
+};
 
-    else if (strcmp(bufferView.format, "B") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((unsigned char*)bufferView.buf + index); };
+template<>
+struct mvBufferKernel<int, double>
+{
+    static void convert(const void* src, double* dst, Py_ssize_t count)
+    {
+        const int* in = (const int*)src;
+        Py_ssize_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4)
+            _mm256_storeu_pd(dst + i, _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*)(in + i))));
+#endif
+        for (; i + 2 <= count; i += 2)
+            _mm_storeu_pd(dst + i, _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i*)(in + i))));
+        for (; i < count; ++i)
+            dst[i] = (double)in[i];
+    }
+};
 
-    else if (strcmp(bufferView.format, "b") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((signed char*)bufferView.buf + index); };
+template<>
+struct mvBufferKernel<short, float>
+{
+    static void convert(const void* src, float* dst, Py_ssize_t count)
+    {
+        const short* in = (const short*)src;
+        Py_ssize_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(in + i)))));
+#endif
+        for (; i + 8 <= count; i += 8)
+        {
+            // sign extend by placing each value in the upper half, then shifting down
+            __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+            _mm_storeu_ps(dst + i,     _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)));
+            _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16)));
+        }
+        for (; i < count; ++i)
+            dst[i] = (float)in[i];
+    }
+};
 
-    else if (strcmp(bufferView.format, "c") == 0)
-        return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((char*)bufferView.buf + index); };
-    else
+template<>
+struct mvBufferKernel<unsigned char, float>
+{
+    static void convert(const void* src, float* dst, Py_ssize_t count)
+    {
+        const unsigned char* in = (const unsigned char*)src;
+        Py_ssize_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(in + i)))));
+#endif
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i v  = _mm_loadu_si128((const __m128i*)(in + i));
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_ps(dst + i,      _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)));
+            _mm_storeu_ps(dst + i + 4,  _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)));
+            _mm_storeu_ps(dst + i + 8,  _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)));
+            _mm_storeu_ps(dst + i + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)));
+        }
+        for (; i < count; ++i)
+            dst[i] = (float)in[i];
+    }
+};
+
+template<>
+struct mvBufferKernel<float, int>
+{
+    static void convert(const void* src, int* dst, Py_ssize_t count)
     {
-        mvThrowPythonError(mvErrorCode::mvWrongType, "Unknown buffer type.");
-        mvThrowPythonError(mvErrorCode::mvWrongType, bufferView.format);
-        mvThrowPythonError(mvErrorCode::mvWrongType, "Currently supported buffer types f, d, l, B");
-        return nullptr;
+        const float* in = (const float*)src;
+        Py_ssize_t i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_cvttps_epi32(_mm_loadu_ps(in + i)));
+        for (; i < count; ++i)
+            dst[i] = (int)in[i];
     }
+};
+
+#endif // MV_BUFFER_SSE2
+
+// Picks the kernel matching the buffer's format. Returns nullptr (with a
+// python error set) for formats we don't know how to read.
+template<typename Dst>
+static mvBufferConverter<Dst>
+BufferConverter(Py_buffer& bufferView)
+{
+    // '@' is native order/size, same as no prefix
+    const char* format = bufferView.format ? bufferView.format : "B";
+    if (*format == '@')
+        format++;
+
+    if (format[0] != 0 && format[1] == 0)
+    {
+        switch (format[0])
+        {
+        case 'f': return &mvBufferKernel<float, Dst>::convert;
+        case 'd': return &mvBufferKernel<double, Dst>::convert;
+        case 'h': return &mvBufferKernel<short, Dst>::convert;
+        case 'H': return &mvBufferKernel<unsigned short, Dst>::convert;
+        case 'i': return &mvBufferKernel<int, Dst>::convert;
+        case 'I': return &mvBufferKernel<unsigned int, Dst>::convert;
+        case 'l': return &mvBufferKernel<long, Dst>::convert;
+        case 'L': return &mvBufferKernel<unsigned long, Dst>::convert;
+        case 'q': return &mvBufferKernel<long long, Dst>::convert;
+        case 'Q': return &mvBufferKernel<unsigned long long, Dst>::convert;
+        case 'k': return &mvBufferKernel<unsigned long, Dst>::convert;
+        case 'K': return &mvBufferKernel<unsigned long long, Dst>::convert;
+        case 'B': return &mvBufferKernel<unsigned char, Dst>::convert;
+        case 'b': return &mvBufferKernel<signed char, Dst>::convert;
+        case 'c': return &mvBufferKernel<char, Dst>::convert;
+        default: break;
+        }
+    }
+
+    mvThrowPythonError(mvErrorCode::mvWrongType, std::string("Unknown buffer type: ") + bufferView.format
+        + ". Currently supported buffer types f, d, h, H, i, I, l, L, q, Q, b, B, c");
+    return nullptr;
+}
+
+// Converts a whole buffer into `items` in one pass.
+template<typename Dst>
+static void
+ConvertBuffer(Py_buffer& bufferView, std::vector<Dst>& items)
+{
+    mvBufferConverter<Dst> convert = BufferConverter<Dst>(bufferView);
+    if (convert == nullptr)
+        return;
+
+    const Py_ssize_t size = bufferView.len / bufferView.itemsize;
+    items.resize(size);
+    convert(bufferView.buf, items.data(), size);
 }
 
 std::vector<unsigned char>
@@ -1129,12 +1408,7 @@ ToUCharVect(PyObject* value, const std::string& message)
         if (!PyObject_GetBuffer(value, &buffer_info,
                                 PyBUF_CONTIG_RO | PyBUF_FORMAT))
         {
-            auto BufferViewer = BufferViewFunctionsInt(buffer_info);
-
-            for (Py_ssize_t i = 0; i < buffer_info.len / buffer_info.itemsize; ++i)
-            {
-                items.emplace_back((unsigned char)BufferViewer(buffer_info, i));
-            }
+            ConvertBuffer(buffer_info, items);
             PyBuffer_Release(&buffer_info);
         }
     }
@@ -1181,12 +1455,7 @@ ToIntVect(PyObject* value, const std::string& message)
         if (!PyObject_GetBuffer(value, &buffer_info,
                                 PyBUF_CONTIG_RO | PyBUF_FORMAT))
         {
-            auto BufferViewer = BufferViewFunctionsInt(buffer_info);
-
-            for (Py_ssize_t i = 0; i < buffer_info.len / buffer_info.itemsize; ++i)
-            {
-                items.emplace_back(BufferViewer(buffer_info, i));
-            }
+            ConvertBuffer(buffer_info, items);
             PyBuffer_Release(&buffer_info);
         }
     }
@@ -1232,14 +1501,12 @@ ToUUIDVect(PyObject* value, const std::string& message)
     return items;
 }
 
-std::vector<float>
-ToFloatVect(PyObject* value, const std::string& message)
+static void
+ConvertFloatVect(PyObject* value, std::vector<float>& items, const std::string& message)
 {
-
-    std::vector<float> items;
+    items.clear();
     if (value == nullptr)
-        return items;
-
+        return;
 
     if (PyTuple_Check(value))
     {
@@ -1266,33 +1533,38 @@ ToFloatVect(PyObject* value, const std::string& message)
         if (!PyObject_GetBuffer(value, &buffer_info,
                                 PyBUF_CONTIG_RO | PyBUF_FORMAT))
         {
-
-            auto BufferViewer = BufferViewFunctionsFloat(buffer_info);
-            items.reserve(buffer_info.len / buffer_info.itemsize);
-
-            for (Py_ssize_t i = 0; i < buffer_info.len / buffer_info.itemsize; ++i)
-            {
-                items.emplace_back(BufferViewer(buffer_info, i));
-            }
+            ConvertBuffer(buffer_info, items);
             PyBuffer_Release(&buffer_info);
         }
     }
 
     else
         mvThrowPythonError(mvErrorCode::mvWrongType, "Python value error. Must be List[float].");
+}
 
-
+std::vector<float>
+ToFloatVect(PyObject* value, const std::string& message)
+{
+    std::vector<float> items;
+    ConvertFloatVect(value, items, message);
     return items;
 }
 
-std::vector<double>
-ToDoubleVect(PyObject* value, const std::string& message)
+void
+ToFloatVect(PyObject* value, std::vector<float>& items, const std::string& message)
 {
+    const size_t capacity = items.capacity();
+    ConvertFloatVect(value, items, message);
+    if (items.capacity() != capacity)
+        mvItemPoolBase::GetStats().valueBufferAllocations++;
+}
 
-    std::vector<double> items;
+static void
+ConvertDoubleVect(PyObject* value, std::vector<double>& items, const std::string& message)
+{
+    items.clear();
     if (value == nullptr)
-        return items;
-
+        return;
 
     if (PyTuple_Check(value))
     {
@@ -1319,24 +1591,32 @@ ToDoubleVect(PyObject* value, const std::string& message)
         if (!PyObject_GetBuffer(value, &buffer_info,
                                 PyBUF_CONTIG_RO | PyBUF_FORMAT))
         {
-            auto BufferViewer = BufferViewFunctionsFloat(buffer_info);
-            const Py_ssize_t size = buffer_info.len / buffer_info.itemsize;
-            items.reserve(size);
-            for (Py_ssize_t i = 0; i < size; ++i)
-            {
-                items.emplace_back(BufferViewer(buffer_info, i));
-            }
+            ConvertBuffer(buffer_info, items);
             PyBuffer_Release(&buffer_info);
         }
     }
 
     else
         mvThrowPythonError(mvErrorCode::mvWrongType, "Python value error. Must be List[float].");
+}
 
-
+std::vector<double>
+ToDoubleVect(PyObject* value, const std::string& message)
+{
+    std::vector<double> items;
+    ConvertDoubleVect(value, items, message);
     return items;
 }
 
+void
+ToDoubleVect(PyObject* value, std::vector<double>& items, const std::string& message)
+{
+    const size_t capacity = items.capacity();
+    ConvertDoubleVect(value, items, message);
+    if (items.capacity() != capacity)
+        mvItemPoolBase::GetStats().valueBufferAllocations++;
+}
+
 std::vector<std::string>
 ToStringVect(PyObject* value, const std::string& message)
 {
@@ -1798,6 +2078,24 @@ ToVectVectDouble(PyObject* value, const std::string& message)
     return items;
 }
 
+void
+ToVectVectDouble(PyObject* value, std::vector<std::vector<double>>& items, const std::string& message)
+{
+    Py_ssize_t size = 0;
+    if (value != nullptr && PyTuple_Check(value))
+        size = PyTuple_Size(value);
+    else if (value != nullptr && PyList_Check(value))
+        size = PyList_Size(value);
+
+    const size_t capacity = items.capacity();
+    items.resize(size);
+    if (items.capacity() != capacity)
+        mvItemPoolBase::GetStats().valueBufferAllocations++;
+
+    for (Py_ssize_t i = 0; i < size; ++i)
+        ToDoubleVect(PyTuple_Check(value) ? PyTuple_GetItem(value, i) : PyList_GetItem(value, i), items[i], message);
+}
+
 
 
 static bool
@@ -1997,6 +2295,10 @@ FinalizeParser(const mvPythonParserSetup& setup, const std::vector<mvPythonDataE
             default:
                 parser.deprecated_elements.push_back(arg);
         }
+
+        // interned once here so VerifyKeywordArguments can match dict keys
+        // by pointer (parsers live for the lifetime of the module)
+        parser.interned_keywords.insert(PyUnicode_InternFromString(arg.name));
     }
 
     // build format string and keywords
@@ -2119,78 +2421,47 @@ VerifyKeywordArguments(const mvPythonParser& parser, PyObject* args)
     if (args == nullptr)
         return false;
 
-    if (!PyArg_ValidateKeywordArguments(args))
+    if (GContext->IO.skipKeywordValidation)
         return false;
 
-    PyObject* keys = PyDict_Keys(args);
+    if (!PyArg_ValidateKeywordArguments(args))
+        return false;
 
-    bool exists = false;
-    auto keycnt = PyList_Size(keys);
-    for (int i = 0; i < keycnt; i++)
+    PyObject* key = nullptr;
+    PyObject* value = nullptr;
+    Py_ssize_t pos = 0;
+    while (PyDict_Next(args, &pos, &key, &value))
     {
-        PyObject* item = PyList_GetItem(keys, i);
-        auto sitem = ToString(item);
-
-        bool found = false;
-        for (const auto& keyword : parser.keyword_elements)
-        {
-            if (sitem == keyword.name)
-            {
-                found = true;
-                break;
-            }
-        }
-
-        if (found)
+        // keyword names in call sites are interned by the compiler, so this
+        // is the common case
+        if (parser.interned_keywords.count(key) != 0)
             continue;
-        else
-        {
-            for (const auto& keyword : parser.optional_elements)
-            {
-                if (sitem == keyword.name)
-                {
-                    found = true;
-                    break;
-                }
-            }
 
-            if (found)
-                continue;
-        }
-
-        for (const auto& keyword : parser.required_elements)
-        {
-            if (sitem == keyword.name)
-            {
-                found = true;
-                break;
-            }
-        }
-
-        if (found)
-            continue;
-
-        for (const auto& keyword : parser.deprecated_elements)
-        {
-            if (sitem == keyword.name)
-            {
-                found = true;
-                break;
-            }
-        }
-
-        if (found)
+        // keys built at runtime (e.g. **dict(...)) may not be
+        if (parser.interned_keywords.count(ToInternedKey(key)) != 0)
             continue;
 
-        mvThrowPythonError(mvErrorCode::mvNone, sitem + " keyword does not exist.");
+        mvThrowPythonError(mvErrorCode::mvNone, ToString(key) + " keyword does not exist.");
         IM_ASSERT(false);
-        exists = false;
         break;
     }
 
-    Py_XDECREF(keys);
+    return false;
+}
 
-    return exists;
+PyObject*
+ToInternedKey(PyObject* key)
+{
+    if (!PyUnicode_Check(key) || PyUnicode_CHECK_INTERNED(key))
+        return key;
+
+    // interning hands back the canonical object if an equal string exists;
+    // that object is kept alive by whoever interned it first (e.g. a table)
+    PyObject* interned = key;
+    Py_INCREF(interned);
+    PyUnicode_InternInPlace(&interned);
+    Py_DECREF(interned);
+    return interned;
 }
 
 bool
@@ -3,11 +3,15 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
 #include <time.h>
 #include <functional>
 #include <cstring>
 #include <fstream>
 #include <assert.h>
+#include <mutex>
 #include "mvCore.h"
 
 #define PY_SSIZE_T_CLEAN
@@ -37,6 +41,31 @@ public:
     explicit mvPySafeLockGuard(MutexType &mutex)
         : _mutex(mutex)
     {
+        lock();
+    }
+
+    // Only tries to lock the mutex, like std::unique_lock with std::try_to_lock.
+    // If that fails and the caller wants to wait after all, it can call lock().
+    mvPySafeLockGuard(MutexType &mutex, std::try_to_lock_t)
+        : _mutex(mutex), _owns(mutex.try_lock())
+    {
+    }
+
+    ~mvPySafeLockGuard() noexcept
+    {
+        if (_owns)
+            _mutex.unlock();
+    }
+
+    mvPySafeLockGuard(const mvPySafeLockGuard&) = delete;
+    mvPySafeLockGuard &operator=(const mvPySafeLockGuard&) = delete;
+
+    bool owns_lock() const { return _owns; }
+
+    void lock()
+    {
+        assert(!_owns);
+
 #ifdef MV_NO_USER_THREADS
 
         // Technically, for MV_NO_USER_THREADS we could simply declare mvPySafeLockGuard
@@ -45,27 +74,27 @@ public:
         // deduction on alias templates was disallowed back then.  This would make
         // the code bulky, so let's just reimplement std::lock here so that MutexType
         // can be deduced.
-        mutex.lock();
+        _mutex.lock();
 
 #else // !MV_NO_USER_THREADS
 
-        Py_BEGIN_ALLOW_THREADS;
-        mutex.lock();
-        Py_END_ALLOW_THREADS;
+        // uncontended (or, for recursive mutexes, re-entrant) locking doesn't
+        // need to give up GIL
+        if (!_mutex.try_lock())
+        {
+            Py_BEGIN_ALLOW_THREADS;
+            _mutex.lock();
+            Py_END_ALLOW_THREADS;
+        }
 
 #endif // !MV_NO_USER_THREADS
-    }
 
-    ~mvPySafeLockGuard() noexcept
-    {
-        _mutex.unlock();
+        _owns = true;
     }
 
-    mvPySafeLockGuard(const mvPySafeLockGuard&) = delete;
-    mvPySafeLockGuard &operator=(const mvPySafeLockGuard&) = delete;
-
 private:
     MutexType& _mutex;
+    bool       _owns = false;
 };
 
 class mvPyObject
@@ -100,6 +129,60 @@ private:
 
 };
 
+// A callable along with the number of positional arguments it takes,
+// resolved once on assignment so that mvRunCallback doesn't have to look
+// into __code__ on every call.  An arity of -1 means it couldn't be
+// determined (e.g. functools.partial); such callables get all three of
+// sender, app_data and user_data.
+class mvPyCallback : public mvPyObject
+{
+
+public:
+
+	mvPyCallback(PyObject* rawObject, bool borrowed = false);
+	mvPyCallback(mvPyCallback&& other) = default;
+	mvPyCallback& operator=(mvPyCallback&& other) = default;
+
+	i32 argCount() const { return m_argCount; }
+
+private:
+
+	i32 m_argCount = 0;
+
+};
+
+// Read-only view into a Python object exporting C-contiguous float64 data.
+// The buffer export (and with it a reference to the exporter) is held until
+// the view is released, so the memory can be handed to ImPlot in place.
+// Releasing takes the GIL, so a view may be dropped from any thread.
+class mvDoubleBufferView
+{
+
+public:
+
+	mvDoubleBufferView() = default;
+	~mvDoubleBufferView();
+
+	mvDoubleBufferView(const mvDoubleBufferView& other) = delete;
+	mvDoubleBufferView& operator=(const mvDoubleBufferView& other) = delete;
+
+	// Releases the current view, then tries to export `obj`. Returns false
+	// (leaving the view empty) if the data would need a conversion or a
+	// gather, in which case the caller is expected to copy instead.
+	bool acquire(PyObject* obj);
+	void release();
+
+	bool          isValid() const { return m_valid; }
+	const double* data()    const { return m_valid ? (const double*)m_view.buf : nullptr; }
+	int           size()    const { return m_valid ? (int)(m_view.len / (Py_ssize_t)sizeof(double)) : 0; }
+
+private:
+
+	Py_buffer m_view = {};
+	bool      m_valid = false;
+
+};
+
 enum class mvErrorCode
 {
     mvNone                = 1000,
@@ -119,6 +202,10 @@ enum class mvErrorCode
 void mvThrowPythonError(mvErrorCode code, const std::string& message);
 void mvThrowPythonError(mvErrorCode code, const std::string& command, const std::string& message, mvAppItem* item);
 
+// number of positional parameters of `callable` (excluding a bound `self`),
+// or -1 if it has no __code__
+i32  GetCallableArgCount      (PyObject* callable);
+
 bool isPyObject_String        (PyObject* obj);
 bool isPyObject_Int           (PyObject* obj);
 bool isPyObject_Float         (PyObject* obj);
@@ -199,6 +286,11 @@ PyObject*   ToPyIntList  (const int* value, int count);
 PyObject*   ToPyFloatList(const float* value, int count);
 PyObject*   ToPyFloatList(const double* value, int count);
 
+// read-only memoryview over a snapshot (one memcpy, no per-element boxing)
+PyObject*   ToPyMemoryView    (const float* value, int count);
+PyObject*   ToPyMemoryView    (const double* value, int count);
+PyObject*   ToPyMemoryViewList(const std::vector<std::vector<double>>& value);
+
 // updates
 void        UpdatePyIntList         (PyObject* pyvalue, const std::vector<int>& value);
 void        UpdatePyFloatList       (PyObject* pyvalue, const std::vector<float>& value);
@@ -226,6 +318,10 @@ std::vector<mvUUID>                              ToUUIDVect           (PyObject*
 std::vector<unsigned char>                       ToUCharVect          (PyObject* value, const std::string& message = "Type must be a list or tuple of ints.");
 std::vector<float>                               ToFloatVect          (PyObject* value, const std::string& message = "Type must be a list or tuple of floats.");
 std::vector<double>                              ToDoubleVect         (PyObject* value, const std::string& message = "Type must be a list or tuple of doubles.");
+// Same, but converting into an item's value storage: the vector's capacity is
+// reused, and growing it counts as a value buffer allocation (get_allocation_stats).
+void                                             ToFloatVect          (PyObject* value, std::vector<float>& items, const std::string& message = "Type must be a list or tuple of floats.");
+void                                             ToDoubleVect         (PyObject* value, std::vector<double>& items, const std::string& message = "Type must be a list or tuple of doubles.");
 std::vector<std::string>                         ToStringVect         (PyObject* value, const std::string& message = "Type must be a list or tuple of strings.");
 std::vector<std::pair<int, int>>                 ToVectInt2           (PyObject* value, const std::string& message = "Type must be an list/tuple of integer.");
 std::vector<std::pair<std::string, std::string>> ToVectPairString     (PyObject* value, const std::string& message = "Type must be an list/tuple of string pairs.");
@@ -233,6 +329,7 @@ std::vector<std::vector<std::string>>            ToVectVectString     (PyObject*
 std::vector<std::vector<float>>                  ToVectVectFloat      (PyObject* value, const std::string& message = "Type must be an list/tuple of list/tuple of floats.");
 std::vector<std::vector<int>>                    ToVectVectInt        (PyObject* value, const std::string& message = "Type must be an list/tuple of list/tuple of ints.");
 std::vector<std::vector<double>>                 ToVectVectDouble     (PyObject* value, const std::string& message = "Type must be an list/tuple of list/tuple of doubles.");
+void                                             ToVectVectDouble     (PyObject* value, std::vector<std::vector<double>>& items, const std::string& message = "Type must be an list/tuple of list/tuple of doubles.");  // in place, see ToDoubleVect
 std::vector<std::pair<std::string, float>>       ToVectPairStringFloat(PyObject* value, const std::string& message = "Type must be an list/tuple of str,float pairs.");
 
 enum class mvPyDataType
@@ -301,6 +398,7 @@ struct mvPythonParser
     std::string                      about;
     mvPyDataType                     returnType = mvPyDataType::None;
     std::vector<std::string>         category;
+    std::unordered_set<PyObject*>    interned_keywords; // every argument name, interned by FinalizeParser
 };
 
 struct mvPythonParserSetup
@@ -324,6 +422,131 @@ bool VerifyPositionalArguments(const mvPythonParser& parser, PyObject* args);
 bool VerifyKeywordArguments   (const mvPythonParser& parser, PyObject* args);
 bool VerifyArgumentCount      (const mvPythonParser& parser, PyObject* args);
 
+// Returns the interned string equal to `key` (borrowed). Keyword names
+// spelled out at a Python call site are interned already, in which case
+// this is `key` itself.
+PyObject* ToInternedKey(PyObject* key);
+
+// Per-type table routing keyword arguments to setters. apply() costs
+// min(keys passed, keys understood) lookups: a dict smaller than the table
+// is walked once with PyDict_Next, a larger one (every item handler sees
+// the full kwargs of its add_* call) is probed with the table's interned
+// keys instead. Matched setters always run in table order, which keeps
+// dependencies such as "use_internal_label before label" intact, and
+// apply() returns how many of them ran.
+// Tables are meant to be function-local statics (built once, with GIL held)
+// and back every widget's set_configuration/handleSpecificKeywordArgs.
+template<typename T>
+class mvKeywordTable
+{
+
+public:
+
+    using Setter = std::function<void(T&, PyObject*)>;
+
+    mvKeywordTable(std::initializer_list<std::pair<const char*, Setter>> entries)
+    {
+        m_keys.reserve(entries.size());
+        m_setters.reserve(entries.size());
+        for (const auto& entry : entries)
+        {
+            PyObject* key = PyUnicode_InternFromString(entry.first);
+            m_index[key] = (int)m_setters.size();
+            m_keys.push_back(key);
+            m_setters.push_back(entry.second);
+        }
+    }
+
+    // Setter for a single bit of an ImGui/ImPlot flags member; `inverted`
+    // clears the bit for True (e.g. "outliers" vs. *_NoOutliers).
+    // The member may live in a base of T (e.g. _mvDragItem::flags).
+    template<typename Flags, typename Owner>
+    static Setter flag(Flags Owner::* member, int bit, bool inverted = false)
+    {
+        return [member, bit, inverted](T& target, PyObject* item)
+        {
+            if (ToBool(item) != inverted)
+                target.*member |= bit;
+            else
+                target.*member &= ~bit;
+        };
+    }
+
+    int apply(PyObject* dict, T& target) const
+    {
+        if (dict == nullptr)
+            return 0;
+
+        int applied = 0;
+        if (PyDict_Size(dict) > (Py_ssize_t)m_setters.size())
+        {
+            for (size_t i = 0; i < m_keys.size(); i++)
+            {
+                if (PyObject* value = PyDict_GetItem(dict, m_keys[i]))
+                {
+                    m_setters[i](target, value);
+                    applied++;
+                }
+            }
+            return applied;
+        }
+
+        // Matches are recorded by their position in the table, so walking the
+        // positions in order runs them in table order without sorting. Up to
+        // 64 entries this only takes a bit mask and a stack array.
+        if (m_setters.size() > 64)
+        {
+            std::vector<PyObject*> values(m_setters.size(), nullptr);
+            match(dict, [&](int index, PyObject* value) { values[index] = value; });
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                if (values[i])
+                {
+                    m_setters[i](target, values[i]);
+                    applied++;
+                }
+            }
+            return applied;
+        }
+
+        PyObject* values[64];
+        unsigned long long matched = 0;
+        match(dict, [&](int index, PyObject* value) { values[index] = value; matched |= 1ull << index; });
+        for (int i = 0; matched != 0; i++, matched >>= 1)
+        {
+            if (matched & 1)
+            {
+                m_setters[i](target, values[i]);
+                applied++;
+            }
+        }
+        return applied;
+    }
+
+private:
+
+    template<typename OnMatch>
+    void match(PyObject* dict, OnMatch&& onMatch) const
+    {
+        PyObject* key = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(dict, &pos, &key, &value))
+        {
+            auto it = m_index.find(key);
+            if (it == m_index.end())
+                it = m_index.find(ToInternedKey(key));
+            if (it != m_index.end())
+                onMatch(it->second, value);
+        }
+    }
+
+    std::unordered_map<PyObject*, int> m_index;
+    std::vector<PyObject*>             m_keys;
+    std::vector<Setter>                m_setters;
+
+};
+
 // file generation
 void GenerateStubFile        (const std::string& directory);
 void GenerateDearPyGuiFile   (const std::string& directory);
@@ -0,0 +1,329 @@
+#pragma once
+
+#include <Python.h>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <deque>
+#include <type_traits>
+#include "mvTypes.h"
+
+//-----------------------------------------------------------------------------
+// mvFunctionWrapper
+//     Move-only type-erased `void()` callable. Callables that fit into
+//     `InlineSize` bytes (std::packaged_task and typical lambdas do) are
+//     stored in place, so wrapping them doesn't allocate.
+//-----------------------------------------------------------------------------
+
+class mvFunctionWrapper
+{
+    struct impl_base {
+        virtual void call() = 0;
+        // move-constructs the callable into `buffer` (inline storage only)
+        virtual impl_base* move_to(void* buffer) = 0;
+        virtual ~impl_base() = default;
+    };
+
+    template<typename F>
+    struct impl_type : impl_base
+    {
+        F f;
+        explicit impl_type(F&& f) : f(std::move(f)) {}
+        void call() override { f(); }
+        impl_base* move_to(void* buffer) override { return new (buffer) impl_type(std::move(f)); }
+    };
+
+    static constexpr size_t InlineSize = 48;
+
+    template<typename F>
+    static constexpr bool fits_inline = sizeof(impl_type<F>) <= InlineSize
+        && alignof(impl_type<F>) <= alignof(std::max_align_t)
+        && std::is_nothrow_move_constructible<F>::value;
+
+public:
+
+    mvFunctionWrapper() = default;
+
+    template<typename F>
+    mvFunctionWrapper(F&& f)
+    {
+        using Fn = std::decay_t<F>;
+        if constexpr (fits_inline<Fn>)
+        {
+            m_impl = new (m_buffer) impl_type<Fn>(std::move(f));
+            m_inline = true;
+        }
+        else
+            m_impl = new impl_type<Fn>(std::move(f));
+    }
+
+    mvFunctionWrapper(mvFunctionWrapper&& other) noexcept
+    {
+        take(other);
+    }
+
+    mvFunctionWrapper& operator=(mvFunctionWrapper&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~mvFunctionWrapper()
+    {
+        reset();
+    }
+
+    // delete copy constructor and assignment operator
+    mvFunctionWrapper(const mvFunctionWrapper&) = delete;
+    mvFunctionWrapper(mvFunctionWrapper&) = delete;
+    mvFunctionWrapper& operator=(const mvFunctionWrapper&) = delete;
+
+    void operator()()
+    {
+        m_impl->call();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return m_impl != nullptr;
+    }
+
+private:
+
+    void take(mvFunctionWrapper& other) noexcept
+    {
+        if (other.m_impl == nullptr)
+            return;
+
+        if (other.m_inline)
+        {
+            m_impl = other.m_impl->move_to(m_buffer);
+            m_inline = true;
+            other.reset();
+        }
+        else
+        {
+            m_impl = other.m_impl;
+            other.m_impl = nullptr;
+        }
+    }
+
+    void reset() noexcept
+    {
+        if (m_impl == nullptr)
+            return;
+
+        if (m_inline)
+            m_impl->~impl_base();
+        else
+            delete m_impl;
+        m_impl = nullptr;
+        m_inline = false;
+    }
+
+private:
+
+    alignas(std::max_align_t) unsigned char m_buffer[InlineSize];
+    impl_base* m_impl = nullptr;
+    bool       m_inline = false;
+
+};
+
+//-----------------------------------------------------------------------------
+// mvQueue
+//     Bounded multi-producer/single-consumer ring (after D. Vyukov's bounded
+//     MPMC queue). Each cell carries a sequence number telling producers and
+//     the consumer whose turn it is, so push and try_pop are lock-free and
+//     values are stored in the cells themselves - no per-item allocation.
+//     The mutex/condvar pair is only touched when the consumer goes to sleep
+//     in wait_and_pop.
+//     When the ring is full, push waits for the consumer to catch up (giving
+//     up GIL while waiting, if it's held). The capacities are chosen well
+//     above what the callback limit and normal task traffic produce.
+//     The consumer can't wait for itself, so when it pushes into its own full
+//     ring (e.g. a task submitting tasks) the value goes to a locked overflow
+//     list instead, which try_pop drains once the ring is empty.
+//-----------------------------------------------------------------------------
+template<typename T>
+class mvQueue
+{
+
+    struct cell
+    {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+public:
+
+    // capacity must be a power of 2
+    explicit mvQueue(size_t capacity = 1024)
+        : m_cells(new cell[capacity]), m_mask(capacity - 1)
+    {
+        assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+        for (size_t i = 0; i < capacity; i++)
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    ~mvQueue()
+    {
+        T value;
+        while (try_pop(value)) {}
+    }
+
+    // copy assignment and constructor deleted
+    mvQueue(const mvQueue& other) = delete;
+    mvQueue& operator=(const mvQueue& other) = delete;
+
+    void push(T value)
+    {
+        b8 consumer = m_consumer.load(std::memory_order_relaxed) == std::this_thread::get_id();
+        // keep the consumer's own values in order once they've started to overflow
+        if (consumer && m_overflowing.load(std::memory_order_relaxed))
+        {
+            push_overflow(std::move(value));
+            return;
+        }
+
+        while (!try_push(value))
+        {
+            if (consumer)
+            {
+                push_overflow(std::move(value));
+                return;
+            }
+
+            if (Py_IsInitialized() && PyGILState_Check())
+            {
+                Py_BEGIN_ALLOW_THREADS;
+                std::this_thread::yield();
+                Py_END_ALLOW_THREADS;
+            }
+            else
+                std::this_thread::yield();
+        }
+
+        // Pairs with the fence in wait_and_pop: either the consumer sees the
+        // value on its re-check, or we see it sleeping and wake it up.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_sleeping.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lk(m_wait_mutex);
+            m_data_cond.notify_one();
+        }
+    }
+
+    bool try_pop(T& value)
+    {
+        std::thread::id self = std::this_thread::get_id();
+        if (m_consumer.load(std::memory_order_relaxed) != self)
+            m_consumer.store(self, std::memory_order_relaxed);
+
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        cell& c = m_cells[pos & m_mask];
+        if (c.sequence.load(std::memory_order_acquire) != pos + 1)
+            return m_overflowing.load(std::memory_order_acquire) && pop_overflow(value);
+
+        T* stored = std::launder(reinterpret_cast<T*>(c.storage));
+        value = std::move(*stored);
+        stored->~T();
+
+        c.sequence.store(pos + m_mask + 1, std::memory_order_release);
+        m_dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void wait_and_pop(T& value)
+    {
+        while (!try_pop(value))
+        {
+            std::unique_lock<std::mutex> lk(m_wait_mutex);
+            m_sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!empty())
+            {
+                m_sleeping.store(false, std::memory_order_relaxed);
+                continue;
+            }
+            m_data_cond.wait(lk);
+            m_sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    // consumer side only
+    bool empty() const
+    {
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        return m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1
+            && !m_overflowing.load(std::memory_order_acquire);
+    }
+
+private:
+
+    // Only the consumer ever pushes here, so it needn't wake anyone up.
+    void push_overflow(T value)
+    {
+        std::lock_guard<std::mutex> lk(m_overflow_mutex);
+        m_overflow.push_back(std::move(value));
+        m_overflowing.store(true, std::memory_order_release);
+    }
+
+    bool pop_overflow(T& value)
+    {
+        std::lock_guard<std::mutex> lk(m_overflow_mutex);
+        if (m_overflow.empty())
+            return false;
+        value = std::move(m_overflow.front());
+        m_overflow.pop_front();
+        if (m_overflow.empty())
+            m_overflowing.store(false, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool try_push(T& value)
+    {
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell& c = m_cells[pos & m_mask];
+            size_t seq = c.sequence.load(std::memory_order_acquire);
+            intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+            if (dif == 0)
+            {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    new (c.storage) T(std::move(value));
+                    c.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (dif < 0)
+                return false; // full
+            else
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+private:
+
+    std::unique_ptr<cell[]>          m_cells;
+    const size_t                     m_mask;
+    alignas(64) std::atomic<size_t>  m_enqueue_pos = 0;
+    alignas(64) std::atomic<size_t>  m_dequeue_pos = 0;
+    std::atomic<b8>                  m_sleeping = false;
+    std::mutex                       m_wait_mutex;
+    std::condition_variable          m_data_cond;
+    std::atomic<std::thread::id>     m_consumer{};     // the thread that last popped
+    std::atomic<b8>                  m_overflowing = false;
+    std::mutex                       m_overflow_mutex;
+    std::deque<T>                    m_overflow;
+
+};
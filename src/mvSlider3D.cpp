@@ -457,7 +457,7 @@ void mvSlider3D::setPyValue(PyObject* value)
 	if (_value)
 		*_value = temp_array;
 	else
-		_value = std::make_shared<std::array<float, 4>>(temp_array);
+		_value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void mvSlider3D::setDataSource(mvUUID dataSource)
@@ -486,13 +486,17 @@ void mvSlider3D::handleSpecificKeywordArgs(PyObject* dict)
     if (dict == nullptr)
         return;
 
-    if (PyObject* item = PyDict_GetItemString(dict, "max_x")) _maxX = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "max_y")) _maxY = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "max_z")) _maxZ = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "min_x")) _minX = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "min_y")) _minY = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "min_z")) _minZ = ToFloat(item);
-    if (PyObject* item = PyDict_GetItemString(dict, "scale")) _scale = ToFloat(item);
+    static const mvKeywordTable<mvSlider3D> keywords = {
+        { "max_x", [](mvSlider3D& self, PyObject* item) { self._maxX = ToFloat(item); } },
+        { "max_y", [](mvSlider3D& self, PyObject* item) { self._maxY = ToFloat(item); } },
+        { "max_z", [](mvSlider3D& self, PyObject* item) { self._maxZ = ToFloat(item); } },
+        { "min_x", [](mvSlider3D& self, PyObject* item) { self._minX = ToFloat(item); } },
+        { "min_y", [](mvSlider3D& self, PyObject* item) { self._minY = ToFloat(item); } },
+        { "min_z", [](mvSlider3D& self, PyObject* item) { self._minZ = ToFloat(item); } },
+        { "scale", [](mvSlider3D& self, PyObject* item) { self._scale = ToFloat(item); } },
+    };
+
+    keywords.apply(dict, *this);
 }
 
 void mvSlider3D::getSpecificConfiguration(PyObject* dict)
@@ -24,7 +24,7 @@ public:
 
 private:
 
-    std::shared_ptr<std::array<float, 4>> _value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
+    std::shared_ptr<std::array<float, 4>> _value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
     float                       _disabled_value[4]{};
     float                       _minX = 0.0f;
     float                       _minY = 0.0f;
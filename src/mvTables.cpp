@@ -59,32 +59,31 @@ void mvTableColumn::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "init_width_or_weight")) _init_width_or_weight = ToFloat(item);
-
-	// helper for bit flipping
-	auto flagop = [dict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(dict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	using Keywords = mvKeywordTable<mvTableColumn>;
+	static const Keywords keywords = {
+		{ "init_width_or_weight", [](mvTableColumn& self, PyObject* item) { self._init_width_or_weight = ToFloat(item); } },
+
+		{ "default_hide", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_DefaultHide) },
+		{ "default_sort", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_DefaultSort) },
+		{ "width_stretch", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_WidthStretch) },
+		{ "width_fixed", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_WidthFixed) },
+		{ "no_resize", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoResize) },
+		{ "no_reorder", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoReorder) },
+		{ "no_hide", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoHide) },
+		{ "no_clip", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoClip) },
+		{ "no_sort", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoSort) },
+		{ "no_sort_ascending", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoSortAscending) },
+		{ "no_sort_descending", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoSortDescending) },
+		{ "no_header_width", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoHeaderWidth) },
+		{ "prefer_sort_ascending", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_PreferSortAscending) },
+		{ "prefer_sort_descending", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_PreferSortDescending) },
+		{ "indent_enable", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_IndentEnable) },
+		{ "indent_disable", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_IndentDisable) },
+		{ "angled_header", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_AngledHeader) },
+		{ "no_header_label", Keywords::flag(&mvTableColumn::_flags, ImGuiTableColumnFlags_NoHeaderLabel) },
 	};
 
-	flagop("default_hide", ImGuiTableColumnFlags_DefaultHide, _flags);
-	flagop("default_sort", ImGuiTableColumnFlags_DefaultSort, _flags);
-	flagop("width_stretch", ImGuiTableColumnFlags_WidthStretch, _flags);
-	flagop("width_fixed", ImGuiTableColumnFlags_WidthFixed, _flags);
-	flagop("no_resize", ImGuiTableColumnFlags_NoResize, _flags);
-	flagop("no_reorder", ImGuiTableColumnFlags_NoReorder, _flags);
-	flagop("no_hide", ImGuiTableColumnFlags_NoHide, _flags);
-	flagop("no_clip", ImGuiTableColumnFlags_NoClip, _flags);
-	flagop("no_sort", ImGuiTableColumnFlags_NoSort, _flags);
-	flagop("no_sort_ascending", ImGuiTableColumnFlags_NoSortAscending, _flags);
-	flagop("no_sort_descending", ImGuiTableColumnFlags_NoSortDescending, _flags);
-	flagop("no_header_width", ImGuiTableColumnFlags_NoHeaderWidth, _flags);
-	flagop("prefer_sort_ascending", ImGuiTableColumnFlags_PreferSortAscending, _flags);
-	flagop("prefer_sort_descending", ImGuiTableColumnFlags_PreferSortDescending, _flags);
-	flagop("indent_enable", ImGuiTableColumnFlags_IndentEnable, _flags);
-	flagop("indent_disable", ImGuiTableColumnFlags_IndentDisable, _flags);
-	flagop("angled_header", ImGuiTableColumnFlags_AngledHeader, _flags);
-	flagop("no_header_label", ImGuiTableColumnFlags_NoHeaderLabel, _flags); 
+	keywords.apply(dict, *this);
 }
 
 void mvTableColumn::getSpecificConfiguration(PyObject* dict)
@@ -414,7 +413,8 @@ void mvTable::draw(ImDrawList* drawlist, float x, float y)
 
 			// TODO: maybe it should actually go after EndTable
 			handleDelayedScroll();
-			config.scrollXFlags = config.scrollYFlags = mvSetScrollFlags_None;
+			if (config.coldConfig)
+				config.coldConfig->scrollXFlags = config.coldConfig->scrollYFlags = mvSetScrollFlags_None;
 
 		    UpdateAppItemScrollInfo(state);
 
@@ -529,63 +529,62 @@ void mvTable::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "freeze_rows")) _freezeRows = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "freeze_columns")) _freezeColumns = ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "header_row")) _tableHeader = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "clipper")) _useClipper = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "inner_width")) _inner_width = (int)ToFloat(item);
-
-	// helper for bit flipping
-	auto flagop = [dict](const char* keyword, int flag, int& flags)
-	{
-		if (PyObject* item = PyDict_GetItemString(dict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
-	};
+	using Keywords = mvKeywordTable<mvTable>;
+	static const Keywords keywords = {
+		{ "freeze_rows", [](mvTable& self, PyObject* item) { self._freezeRows = ToInt(item); } },
+		{ "freeze_columns", [](mvTable& self, PyObject* item) { self._freezeColumns = ToInt(item); } },
+		{ "header_row", [](mvTable& self, PyObject* item) { self._tableHeader = ToBool(item); } },
+		{ "clipper", [](mvTable& self, PyObject* item) { self._useClipper = ToBool(item); } },
+		{ "inner_width", [](mvTable& self, PyObject* item) { self._inner_width = (int)ToFloat(item); } },
+
+		{ "resizable", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_Resizable) },
+		{ "reorderable", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_Reorderable) },
+		{ "hideable", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_Hideable) },
+		{ "sortable", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_Sortable) },
+		{ "context_menu_in_body", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_ContextMenuInBody) },
+		{ "row_background", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_RowBg) },
+		{ "borders_innerH", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_BordersInnerH) },
+		{ "borders_outerH", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_BordersOuterH) },
+		{ "borders_innerV", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_BordersInnerV) },
+		{ "borders_outerV", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_BordersOuterV) },
+		{ "no_host_extendX", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_NoHostExtendX) },
+		{ "no_host_extendY", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_NoHostExtendY) },
+		{ "no_keep_columns_visible", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_NoKeepColumnsVisible) },
+		{ "precise_widths", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_PreciseWidths) },
+		{ "no_clip", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_NoClip) },
+		{ "pad_outerX", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_PadOuterX) },
+		{ "no_pad_outerX", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_NoPadOuterX) },
+		{ "no_pad_innerX", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_NoPadInnerX) },
+		{ "scrollX", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_ScrollX) },
+		{ "scrollY", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_ScrollY) },
+		{ "sort_multi", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_SortMulti) },
+		{ "sort_tristate", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_SortTristate) },
+		{ "no_saved_settings", Keywords::flag(&mvTable::_flags, ImGuiTableFlags_NoSavedSettings) },
+
+		{ "policy", [](mvTable& self, PyObject* item)
+			{
 
-	flagop("resizable", ImGuiTableFlags_Resizable, _flags);
-	flagop("reorderable", ImGuiTableFlags_Reorderable, _flags);
-	flagop("hideable", ImGuiTableFlags_Hideable, _flags);
-	flagop("sortable", ImGuiTableFlags_Sortable, _flags);
-	flagop("context_menu_in_body", ImGuiTableFlags_ContextMenuInBody, _flags);
-	flagop("row_background", ImGuiTableFlags_RowBg, _flags);
-	flagop("borders_innerH", ImGuiTableFlags_BordersInnerH, _flags);
-	flagop("borders_outerH", ImGuiTableFlags_BordersOuterH, _flags);
-	flagop("borders_innerV", ImGuiTableFlags_BordersInnerV, _flags);
-	flagop("borders_outerV", ImGuiTableFlags_BordersOuterV, _flags);
-	flagop("no_host_extendX", ImGuiTableFlags_NoHostExtendX, _flags);
-	flagop("no_host_extendY", ImGuiTableFlags_NoHostExtendY, _flags);
-	flagop("no_keep_columns_visible", ImGuiTableFlags_NoKeepColumnsVisible, _flags);
-	flagop("precise_widths", ImGuiTableFlags_PreciseWidths, _flags);
-	flagop("no_clip", ImGuiTableFlags_NoClip, _flags);
-	flagop("pad_outerX", ImGuiTableFlags_PadOuterX, _flags);
-	flagop("no_pad_outerX", ImGuiTableFlags_NoPadOuterX, _flags);
-	flagop("no_pad_innerX", ImGuiTableFlags_NoPadInnerX, _flags);
-	flagop("scrollX", ImGuiTableFlags_ScrollX, _flags);
-	flagop("scrollY", ImGuiTableFlags_ScrollY, _flags);
-	flagop("sort_multi", ImGuiTableFlags_SortMulti, _flags);
-	flagop("sort_tristate", ImGuiTableFlags_SortTristate, _flags);
-	flagop("no_saved_settings", ImGuiTableFlags_NoSavedSettings, _flags);
-
-	if (PyObject* item = PyDict_GetItemString(dict, "policy"))
-	{
+				int policy = ToInt(item);
 
-		int policy = ToInt(item);
+				// remove old flags
+				self._flags &= ~ImGuiTableFlags_SizingFixedFit;
+				self._flags &= ~ImGuiTableFlags_SizingFixedSame;
+				self._flags &= ~ImGuiTableFlags_SizingStretchProp;
+				self._flags &= ~ImGuiTableFlags_SizingStretchSame;
 
-		// remove old flags
-		_flags &= ~ImGuiTableFlags_SizingFixedFit;
-		_flags &= ~ImGuiTableFlags_SizingFixedSame;
-		_flags &= ~ImGuiTableFlags_SizingStretchProp;
-		_flags &= ~ImGuiTableFlags_SizingStretchSame;
+				if (policy == ImGuiTableFlags_SizingFixedFit)
+					self._flags |= ImGuiTableFlags_SizingFixedFit;
+				else if (policy == ImGuiTableFlags_SizingFixedSame)
+					self._flags |= ImGuiTableFlags_SizingFixedSame;
+				else if (policy == ImGuiTableFlags_SizingStretchProp)
+					self._flags |= ImGuiTableFlags_SizingStretchProp;
+				else
+					self._flags |= ImGuiTableFlags_SizingStretchSame;
 
-		if (policy == ImGuiTableFlags_SizingFixedFit)
-			_flags |= ImGuiTableFlags_SizingFixedFit;
-		else if (policy == ImGuiTableFlags_SizingFixedSame)
-			_flags |= ImGuiTableFlags_SizingFixedSame;
-		else if (policy == ImGuiTableFlags_SizingStretchProp)
-			_flags |= ImGuiTableFlags_SizingStretchProp;
-		else
-			_flags |= ImGuiTableFlags_SizingStretchSame;
+			} },
+	};
 
-	}
+	keywords.apply(dict, *this);
 
 	//if (_flags & ImGuiTableFlags_BordersInnerV)
 	//	_flags &= ~ImGuiTableFlags_Resizable;
@@ -128,7 +128,7 @@ PyObject* mvDynamicTexture::getPyValue()
 
 void mvDynamicTexture::setPyValue(PyObject* value)
 {
-	*_value = ToFloatVect(value);
+	ToFloatVect(value, *_value);
 }
 
 void mvDynamicTexture::setDataSource(mvUUID dataSource)
@@ -172,7 +172,7 @@ void mvDynamicTexture::draw(ImDrawList* drawlist, float x, float y)
 
 void mvDynamicTexture::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_permWidth = ToInt(PyTuple_GetItem(dict, 0));
@@ -249,7 +249,7 @@ void mvRawTexture::draw(ImDrawList* drawlist, float x, float y)
 
 void mvRawTexture::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 	{
 		mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(type), "Texture data not valid", this);
 		return;
@@ -267,20 +267,24 @@ void mvRawTexture::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "format"))
-	{
-		int format = ToInt(item);
-		if (format == 0)
-		{
-			_components = 4;
-			_componentType = mvRawTexture::ComponentType::MV_FLOAT_COMPONENT;
-		}
-		else if (format == 1)
-		{
-			_components = 3;
-			_componentType = mvRawTexture::ComponentType::MV_FLOAT_COMPONENT;
-		}
-	}
+	static const mvKeywordTable<mvRawTexture> keywords = {
+		{ "format", [](mvRawTexture& self, PyObject* item)
+			{
+				int format = ToInt(item);
+				if (format == 0)
+				{
+					self._components = 4;
+					self._componentType = mvRawTexture::ComponentType::MV_FLOAT_COMPONENT;
+				}
+				else if (format == 1)
+				{
+					self._components = 3;
+					self._componentType = mvRawTexture::ComponentType::MV_FLOAT_COMPONENT;
+				}
+			} },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvRawTexture::getSpecificConfiguration(PyObject* dict)
@@ -324,7 +328,7 @@ void mvStaticTexture::draw(ImDrawList* drawlist, float x, float y)
 
 void mvStaticTexture::handleSpecificRequiredArgs(PyObject* dict)
 {
-	if (!VerifyRequiredArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyRequiredArguments(GetItemParser(type), dict))
 		return;
 
 	_permWidth = ToInt(PyTuple_GetItem(dict, 0));
@@ -341,7 +345,7 @@ PyObject* mvStaticTexture::getPyValue()
 
 void mvStaticTexture::setPyValue(PyObject* value)
 {
-	*_value = ToFloatVect(value);
+	ToFloatVect(value, *_value);
 }
 
 void mvStaticTexture::setDataSource(mvUUID dataSource)
@@ -52,13 +52,14 @@ public:
     void setDataSource(mvUUID dataSource) override;
     void* getValue() override { return &_value; }
     PyObject* getPyValue() override;
+    PyObject* getPyBufferValue() override { return ToPyMemoryView(_value->data(), (int)_value->size()); }
     void setPyValue(PyObject* value) override;
 
     void markDirty() { _dirty = true; }
 
 public:
 
-    std::shared_ptr<std::vector<float>> _value = std::make_shared<std::vector<float>>(std::vector<float>{0.0f});
+    std::shared_ptr<std::vector<float>> _value = mvAllocateShared<std::vector<float>>(std::vector<float>{0.0f});
     bool                      _dirty = true;
     int                       _permWidth = 0;
     int                       _permHeight = 0;
@@ -114,11 +115,12 @@ public:
     void setDataSource(mvUUID dataSource) override;
     void* getValue() override { return &_value; }
     PyObject* getPyValue() override;
+    PyObject* getPyBufferValue() override { return ToPyMemoryView(_value->data(), (int)_value->size()); }
     void setPyValue(PyObject* value) override;
 
 public:
 
-    std::shared_ptr<std::vector<float>> _value = std::make_shared<std::vector<float>>(std::vector<float>{0.0f});
+    std::shared_ptr<std::vector<float>> _value = mvAllocateShared<std::vector<float>>(std::vector<float>{0.0f});
     bool                      _dirty = true;
     int                       _permWidth = 0;
     int                       _permHeight = 0;
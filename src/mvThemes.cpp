@@ -153,7 +153,7 @@ void mvThemeColor::pop_theme_color()
 
 void mvThemeColor::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -180,8 +180,12 @@ void mvThemeColor::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "category")) _libType = (mvLibType)ToInt(item);
-	if (PyObject* item = PyDict_GetItemString(dict, "value")) setPyValue(item);
+	static const mvKeywordTable<mvThemeColor> keywords = {
+		{ "category", [](mvThemeColor& self, PyObject* item) { self._libType = (mvLibType)ToInt(item); } },
+		{ "value", [](mvThemeColor& self, PyObject* item) { self.setPyValue(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	if (_libType == mvLibType::MV_IMGUI)
 	{
@@ -250,7 +254,7 @@ void mvThemeColor::setPyValue(PyObject* value)
 	if (_value)
 		*_value = temp_array;
 	else
-		_value = std::make_shared<std::array<float, 4>>(temp_array);
+		_value = mvAllocateShared<std::array<float, 4>>(temp_array);
 
 	if (info.parentPtr)
 		info.parentPtr->info.triggerAlternativeAction = true;
@@ -310,7 +314,7 @@ void mvThemeComponent::pop_theme_items()
 
 void mvThemeComponent::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -336,7 +340,11 @@ void mvThemeComponent::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "enabled_state")) _specificEnabled = ToBool(item);
+	static const mvKeywordTable<mvThemeComponent> keywords = {
+		{ "enabled_state", [](mvThemeComponent& self, PyObject* item) { self._specificEnabled = ToBool(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvThemeComponent::getSpecificConfiguration(PyObject* dict)
@@ -511,7 +519,7 @@ void mvThemeStyle::setPyValue(PyObject* value)
 	if (_value)
 		*_value = temp_array;
 	else
-		_value = std::make_shared<std::array<float, 4>>(temp_array);
+		_value = mvAllocateShared<std::array<float, 4>>(temp_array);
 
 	if (info.parentPtr)
 		info.parentPtr->info.triggerAlternativeAction = true;
@@ -580,7 +588,7 @@ void mvThemeStyle::pop_theme_style()
 
 void mvThemeStyle::handleSpecificPositionalArgs(PyObject* dict)
 {
-	if (!VerifyPositionalArguments(GetParsers()[GetEntityCommand(type)], dict))
+	if (!VerifyPositionalArguments(GetItemParser(type), dict))
 		return;
 
 	for (int i = 0; i < PyTuple_Size(dict); i++)
@@ -613,7 +621,11 @@ void mvThemeStyle::handleSpecificKeywordArgs(PyObject* dict)
 	if (dict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(dict, "category")) _libType = (mvLibType)ToInt(item);
+	static const mvKeywordTable<mvThemeStyle> keywords = {
+		{ "category", [](mvThemeStyle& self, PyObject* item) { self._libType = (mvLibType)ToInt(item); } },
+	};
+
+	keywords.apply(dict, *this);
 
 	if (_libType == mvLibType::MV_IMGUI)
 	{
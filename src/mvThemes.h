@@ -52,7 +52,7 @@ public:
 
 private:
 
-    std::shared_ptr<std::array<float, 4>> _value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
+    std::shared_ptr<std::array<float, 4>> _value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
     ImGuiCol _targetColor = 0;
     mvLibType _libType = mvLibType::MV_IMGUI;
 
@@ -108,7 +108,7 @@ public:
 
 private:
 
-    std::shared_ptr<std::array<float, 4>> _value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, -1.0f, 0.0f, 0.0f});
+    std::shared_ptr<std::array<float, 4>> _value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, -1.0f, 0.0f, 0.0f});
     ImGuiStyleVar _targetStyle = 0;
     mvLibType _libType = mvLibType::MV_IMGUI;
 
@@ -110,8 +110,12 @@ void mvTimePicker::handleSpecificKeywordArgs(PyObject* dict)
 {
 	if (dict == nullptr)
 		return;
-		 
-	if (PyObject* item = PyDict_GetItemString(dict, "hour24")) _hour24 = ToBool(item);
+
+	static const mvKeywordTable<mvTimePicker> keywords = {
+		{ "hour24", [](mvTimePicker& self, PyObject* item) { self._hour24 = ToBool(item); } },
+	};
+
+	keywords.apply(dict, *this);
 }
 
 void mvTimePicker::getSpecificConfiguration(PyObject* dict)
@@ -21,8 +21,8 @@ public:
     void setPyValue(PyObject* value) override;
 
 private:
-    std::shared_ptr<tm>         _value = std::make_shared<tm>();
-    std::shared_ptr<ImPlotTime> _imvalue = std::make_shared<ImPlotTime>();
+    std::shared_ptr<tm>         _value = mvAllocateShared<tm>();
+    std::shared_ptr<ImPlotTime> _imvalue = mvAllocateShared<ImPlotTime>();
     bool              _hour24 = false;
 
 };
\ No newline at end of file
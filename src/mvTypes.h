@@ -5,6 +5,7 @@
 typedef bool b8;
 typedef std::int32_t b32;
 typedef std::int32_t i32;
+typedef std::int64_t i64;
 typedef std::uint32_t u32;
 typedef float f32;
 typedef unsigned long long mvUUID;
\ No newline at end of file
@@ -45,7 +45,7 @@ OutputFrameBufferArray(PymvBuffer* out)
     auto viewportData = (mvViewportData*)viewport->platformSpecifics;
 
     int display_w, display_h;
-    glfwGetFramebufferSize(viewportData->handle, &display_w, &display_h);
+    mvGetFramebufferSize(viewportData, &display_w, &display_h);
 
     stbi_flip_vertically_on_write(true);
     GLint ReadType = GL_UNSIGNED_BYTE;
@@ -79,7 +79,7 @@ OutputFrameBuffer(const char* filepath)
     auto viewportData = (mvViewportData*)viewport->platformSpecifics;
 
     int display_w, display_h;
-    glfwGetFramebufferSize(viewportData->handle, &display_w, &display_h);
+    mvGetFramebufferSize(viewportData, &display_w, &display_h);
 
     stbi_flip_vertically_on_write(true);
     GLint ReadType = GL_UNSIGNED_BYTE;
@@ -4,6 +4,7 @@
 #include "mvValues.h"
 
 #include "mvContext.h"
+#include "mvPlotting.h"
 
 #include <utility>
 #include <string>
@@ -62,7 +63,7 @@ void mvColorValue::setPyValue(PyObject* value)
 	if (_value)
 		*_value = temp_array;
 	else
-		_value = std::make_shared<std::array<float, 4>>(temp_array);
+		_value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void mvColorValue::setDataSource(mvUUID dataSource)
@@ -102,7 +103,7 @@ void mvDouble4Value::setPyValue(PyObject* value)
 	if (_value)
 		*_value = temp_array;
 	else
-		_value = std::make_shared<std::array<double, 4>>(temp_array);
+		_value = mvAllocateShared<std::array<double, 4>>(temp_array);
 }
 
 void mvDouble4Value::setDataSource(mvUUID dataSource)
@@ -173,7 +174,7 @@ void mvFloat4Value::setPyValue(PyObject* value)
 	if (_value)
 		*_value = temp_array;
 	else
-		_value = std::make_shared<std::array<float, 4>>(temp_array);
+		_value = mvAllocateShared<std::array<float, 4>>(temp_array);
 }
 
 void mvFloat4Value::setDataSource(mvUUID dataSource)
@@ -235,7 +236,7 @@ PyObject* mvFloatVectValue::getPyValue()
 
 void mvFloatVectValue::setPyValue(PyObject* value)
 {
-	*_value = ToFloatVect(value);
+	ToFloatVect(value, *_value);
 }
 
 void mvFloatVectValue::setDataSource(mvUUID dataSource)
@@ -275,7 +276,7 @@ void mvInt4Value::setPyValue(PyObject* value)
 	if (_value)
 		*_value = temp_array;
 	else
-		_value = std::make_shared<std::array<int, 4>>(temp_array);
+		_value = mvAllocateShared<std::array<int, 4>>(temp_array);
 }
 
 void mvInt4Value::setDataSource(mvUUID dataSource)
@@ -337,7 +338,7 @@ PyObject* mvSeriesValue::getPyValue()
 
 void mvSeriesValue::setPyValue(PyObject* value)
 {
-	*_value = ToVectVectDouble(value);
+	ToVectVectDouble(value, *_value);
 }
 
 void mvSeriesValue::setDataSource(mvUUID dataSource)
@@ -358,6 +359,7 @@ void mvSeriesValue::setDataSource(mvUUID dataSource)
 			"Values types do not match: " + std::to_string(dataSource), this);
 		return;
 	}
+	DearPyGui::share_series_value(*item);
 	_value = *static_cast<std::shared_ptr<std::vector<std::vector<double>>>*>(item->getValue());
 }
 
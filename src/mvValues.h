@@ -29,7 +29,7 @@ public:
 
 private:
 
-    std::shared_ptr<bool> _value = std::make_shared<bool>(false);
+    std::shared_ptr<bool> _value = mvAllocateShared<bool>(false);
     bool  _disabled_value = false;
 };
 
@@ -50,7 +50,7 @@ public:
 
 private:
 
-    std::shared_ptr<std::array<float, 4>> _value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
+    std::shared_ptr<std::array<float, 4>> _value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
     float  _disabled_value[4]{};
 
 };
@@ -72,7 +72,7 @@ public:
 
 protected:
 
-    std::shared_ptr<std::array<double, 4>> _value = std::make_shared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
+    std::shared_ptr<std::array<double, 4>> _value = mvAllocateShared<std::array<double, 4>>(std::array<double, 4>{0.0, 0.0, 0.0, 0.0});
     double  _disabled_value[4]{};
 };
 
@@ -93,7 +93,7 @@ public:
 
 private:
 
-    std::shared_ptr<double> _value = std::make_shared<double>(0.0);
+    std::shared_ptr<double> _value = mvAllocateShared<double>(0.0);
     float         _disabled_value = 0.0;
 
 };
@@ -115,7 +115,7 @@ public:
 
 private:
 
-    std::shared_ptr<std::array<float, 4>> _value = std::make_shared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
+    std::shared_ptr<std::array<float, 4>> _value = mvAllocateShared<std::array<float, 4>>(std::array<float, 4>{0.0f, 0.0f, 0.0f, 0.0f});
     float  _disabled_value[4]{};
 
 };
@@ -137,7 +137,7 @@ public:
 
 private:
 
-    std::shared_ptr<float> _value = std::make_shared<float>(0.0f);
+    std::shared_ptr<float> _value = mvAllocateShared<float>(0.0f);
     float  _disabled_value = 0.0f;
 
 };
@@ -155,11 +155,12 @@ public:
     void setDataSource(mvUUID dataSource) override;
     void* getValue() override { return &_value; }
     PyObject* getPyValue() override;
+    PyObject* getPyBufferValue() override { return ToPyMemoryView(_value->data(), (int)_value->size()); }
     void setPyValue(PyObject* value) override;
 
 private:
 
-    std::shared_ptr<std::vector<float>> _value = std::make_shared<std::vector<float>>(std::vector<float>{0.0f});
+    std::shared_ptr<std::vector<float>> _value = mvAllocateShared<std::vector<float>>(std::vector<float>{0.0f});
 
 };
 
@@ -180,7 +181,7 @@ public:
 
 private:
 
-    std::shared_ptr<std::array<int, 4>> _value = std::make_shared<std::array<int, 4>>(std::array<int, 4>{0, 0, 0, 0});
+    std::shared_ptr<std::array<int, 4>> _value = mvAllocateShared<std::array<int, 4>>(std::array<int, 4>{0, 0, 0, 0});
     int  _disabled_value[4]{};
 };
 
@@ -201,7 +202,7 @@ public:
 
 private:
 
-    std::shared_ptr<int> _value = std::make_shared<int>(0);
+    std::shared_ptr<int> _value = mvAllocateShared<int>(0);
     int        _disabled_value = 0;
 
 };
@@ -219,11 +220,12 @@ public:
     void setDataSource(mvUUID dataSource) override;
     void* getValue() override { return &_value; }
     PyObject* getPyValue() override;
+    PyObject* getPyBufferValue() override { return ToPyMemoryViewList(*_value); }
     void setPyValue(PyObject* value) override;
 
 private:
 
-    std::shared_ptr<std::vector<std::vector<double>>> _value = std::make_shared<std::vector<std::vector<double>>>(
+    std::shared_ptr<std::vector<std::vector<double>>> _value = mvAllocateShared<std::vector<std::vector<double>>>(
         std::vector<std::vector<double>>{ std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{},
@@ -249,6 +251,6 @@ public:
 
 private:
 
-    std::shared_ptr<std::string> _value = std::make_shared<std::string>("");
+    std::shared_ptr<std::string> _value = mvAllocateShared<std::string>("");
     std::string  _disabled_value = "";
 };
\ No newline at end of file
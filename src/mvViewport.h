@@ -20,6 +20,7 @@ struct mvViewport
 	b8 running = true;
 	b8 shown = false;
 	b8 resized = false;
+	b8 headless = false; // renders offscreen, without a window (Linux only)
 
 	std::string title = "Dear PyGui";
 	std::string small_icon;
@@ -30,6 +31,8 @@ struct mvViewport
 	b8 titleDirty  = false;
 	b8 modesDirty  = false;
 	b8 vsync       = true;
+	u32 maxFps     = 0;    // frame rate cap independent of vsync (0 = none)
+	f32 fixedDeltaTime = 0.0f; // simulated time per frame (0 = real time)
 	b8 resizable   = true;
 	b8 alwaysOnTop = false;
 	b8 decorated   = true;
@@ -62,6 +65,7 @@ void        mvMinimizeViewport(mvViewport& viewport);
 void        mvRestoreViewport (mvViewport& viewport);
 void        mvRenderFrame();
 void        mvToggleFullScreen(mvViewport& viewport);
+void        mvWakeViewport    (mvViewport& viewport);  // interrupts the wait_for_input wait; thread-safe
 
 static void mvOnResize()
 {
@@ -83,6 +87,7 @@ static void mvOnResize()
 			PyTuple_SetItem(dimensions, 2, PyLong_FromLong(clientWidth));
 			PyTuple_SetItem(dimensions, 3, PyLong_FromLong(clientHeight));
 			return dimensions;
-		}
+		},
+		true
 	);
 }
\ No newline at end of file
@@ -23,6 +23,7 @@ mvCreateViewport()
 static void
 window_close_callback(GLFWwindow* window)
 {
+    std::lock_guard lk(GContext->mutex);
     if (GContext->viewport->disableClose) {
         mvAddOwnerlessCallback(GContext->callbackRegistry->onCloseCallback, GContext->callbackRegistry->onCloseCallbackUserData);
     }
@@ -31,9 +32,51 @@ window_close_callback(GLFWwindow* window)
     }
 }
 
+// The ImGui backend's input callbacks write ImGui IO, which API calls read
+// with the mutex held, so they are installed wrapped in a lock. Events are
+// dispatched while waiting for them, too (glfwWaitEvents), and that wait
+// runs without the mutex.
+static void
+install_input_callbacks(GLFWwindow* window)
+{
+    glfwSetWindowFocusCallback(window, [](GLFWwindow* w, int focused) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_WindowFocusCallback(w, focused);
+    });
+    glfwSetCursorEnterCallback(window, [](GLFWwindow* w, int entered) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_CursorEnterCallback(w, entered);
+    });
+    glfwSetCursorPosCallback(window, [](GLFWwindow* w, double x, double y) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_CursorPosCallback(w, x, y);
+    });
+    glfwSetMouseButtonCallback(window, [](GLFWwindow* w, int button, int action, int mods) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_MouseButtonCallback(w, button, action, mods);
+    });
+    glfwSetScrollCallback(window, [](GLFWwindow* w, double xoffset, double yoffset) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_ScrollCallback(w, xoffset, yoffset);
+    });
+    glfwSetKeyCallback(window, [](GLFWwindow* w, int key, int scancode, int action, int mods) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_KeyCallback(w, key, scancode, action, mods);
+    });
+    glfwSetCharCallback(window, [](GLFWwindow* w, unsigned int c) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_CharCallback(w, c);
+    });
+    glfwSetMonitorCallback([](GLFWmonitor* monitor, int event) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_MonitorCallback(monitor, event);
+    });
+}
+
 static void
 window_size_callback(GLFWwindow* window, int width, int height)
 {
+    std::lock_guard lk(GContext->mutex);
     GContext->viewport->actualHeight = height;
     GContext->viewport->clientHeight = height;
     GContext->viewport->actualWidth = width;
@@ -129,9 +172,10 @@ mvShowViewport(mvViewport& viewport, bool minimized, bool maximized)
     ImGui::StyleColorsDark();
     SetDefaultTheme();
 
-    ImGui_ImplGlfw_InitForOpenGL(viewportData->handle, true);
+    ImGui_ImplGlfw_InitForOpenGL(viewportData->handle, false);
 
     // Setup callbacks
+    install_input_callbacks(viewportData->handle);
     glfwSetWindowSizeCallback(viewportData->handle, window_size_callback);
     //glfwSetFramebufferSizeCallback(m_window, window_size_callback);
     glfwSetWindowCloseCallback(viewportData->handle, window_close_callback);
@@ -158,6 +202,12 @@ mvRestoreViewport(mvViewport& viewport)
     glfwRestoreWindow(viewportData->handle);
 }
 
+ void
+mvWakeViewport(mvViewport& viewport)
+{
+    glfwPostEmptyEvent();
+}
+
  void
 mvRenderFrame()
 {
@@ -210,7 +260,19 @@ mvRenderFrame()
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
         if (GContext->IO.waitForInput)
-            glfwWaitEvents();
+        {
+            double timeout = mvTimeToNextFrame();
+            if (timeout < 0.0)
+                glfwWaitEvents();
+            else if (timeout > 0.0)
+                glfwWaitEventsTimeout(timeout);
+            else
+                glfwPollEvents();
+
+            // nothing has changed since the last frame
+            if (!mvFrameNeeded())
+                return;
+        }
         else
             glfwPollEvents();
 
@@ -251,6 +313,8 @@ mvRenderFrame()
             // Start the Dear ImGui frame
             ImGui_ImplMetal_NewFrame(graphicsData->renderPassDescriptor);
             ImGui_ImplGlfw_NewFrame();
+            if (GContext->viewport->fixedDeltaTime > 0.0f)
+                ImGui::GetIO().DeltaTime = GContext->viewport->fixedDeltaTime;
 
             // Note: ImGui::NewFrame can conflict with get_text_size() on fonts:
             // in particular, it can do SetCurrentFont() somewhere in the middle of
@@ -265,7 +329,11 @@ mvRenderFrame()
 
         // Rendering
         ImGui::Render();
-        ImGui_ImplMetal_RenderDrawData(ImGui::GetDrawData(), commandBuffer, renderEncoder);
+        mvRecordDrawStats(ImGui::GetDrawData());
+        if (!GContext->IO.nullRenderer)
+            ImGui_ImplMetal_RenderDrawData(ImGui::GetDrawData(), commandBuffer, renderEncoder);
+        else
+            mvSkipDrawData(ImGui::GetDrawData());
 
         [renderEncoder popDebugGroup];
         [renderEncoder endEncoding];
@@ -12,8 +12,14 @@
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl3.h"
 #include <stdio.h>
+#include <string.h>
+#include <dlfcn.h>
 #include <stb_image.h>
 
+#define EGL_NO_PROTOTYPES
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
 static void
 glfw_error_callback(int error, const char* description)
 {
@@ -23,6 +29,7 @@ glfw_error_callback(int error, const char* description)
 static void
 window_close_callback(GLFWwindow* window)
 {
+    std::lock_guard lk(GContext->mutex);
     if (GContext->viewport->disableClose) {
         mvAddOwnerlessCallback(GContext->callbackRegistry->onCloseCallback, GContext->callbackRegistry->onCloseCallbackUserData);
     }
@@ -31,9 +38,51 @@ window_close_callback(GLFWwindow* window)
     }
 }
 
+// The ImGui backend's input callbacks write ImGui IO, which API calls read
+// with the mutex held, so they are installed wrapped in a lock. Events are
+// dispatched while waiting for them, too (glfwWaitEvents), and that wait
+// runs without the mutex.
+static void
+install_input_callbacks(GLFWwindow* window)
+{
+    glfwSetWindowFocusCallback(window, [](GLFWwindow* w, int focused) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_WindowFocusCallback(w, focused);
+    });
+    glfwSetCursorEnterCallback(window, [](GLFWwindow* w, int entered) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_CursorEnterCallback(w, entered);
+    });
+    glfwSetCursorPosCallback(window, [](GLFWwindow* w, double x, double y) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_CursorPosCallback(w, x, y);
+    });
+    glfwSetMouseButtonCallback(window, [](GLFWwindow* w, int button, int action, int mods) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_MouseButtonCallback(w, button, action, mods);
+    });
+    glfwSetScrollCallback(window, [](GLFWwindow* w, double xoffset, double yoffset) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_ScrollCallback(w, xoffset, yoffset);
+    });
+    glfwSetKeyCallback(window, [](GLFWwindow* w, int key, int scancode, int action, int mods) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_KeyCallback(w, key, scancode, action, mods);
+    });
+    glfwSetCharCallback(window, [](GLFWwindow* w, unsigned int c) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_CharCallback(w, c);
+    });
+    glfwSetMonitorCallback([](GLFWmonitor* monitor, int event) {
+        std::lock_guard lk(GContext->mutex);
+        ImGui_ImplGlfw_MonitorCallback(monitor, event);
+    });
+}
+
 static void
 window_size_callback(GLFWwindow* window, int width, int height)
 {
+    std::lock_guard lk(GContext->mutex);
     GContext->viewport->actualHeight = height;
     GContext->viewport->clientHeight = height;
     GContext->viewport->actualWidth = width;
@@ -41,10 +90,302 @@ window_size_callback(GLFWwindow* window, int width, int height)
     GContext->viewport->resized = true;
 }
 
+static void
+window_refresh_callback(GLFWwindow* window)
+{
+    // the window contents were damaged (e.g. uncovered) and must be redrawn
+    mvRequestRedraw();
+}
+
+//-----------------------------------------------------------------------------
+// headless viewports
+//     - Rendered by an EGL context into a framebuffer object, without a
+//       window or a display server. Mesa's surfaceless platform works
+//       anywhere (using llvmpipe when there's no GPU); EGL devices cover
+//       the NVIDIA driver. libEGL is loaded at runtime, so it's only
+//       needed once a headless viewport is shown.
+//-----------------------------------------------------------------------------
+
+static struct
+{
+    PFNEGLGETPROCADDRESSPROC  GetProcAddress;
+    PFNEGLGETERRORPROC        GetError;
+    PFNEGLQUERYSTRINGPROC     QueryString;
+    PFNEGLGETDISPLAYPROC      GetDisplay;
+    PFNEGLINITIALIZEPROC      Initialize;
+    PFNEGLTERMINATEPROC       Terminate;
+    PFNEGLCHOOSECONFIGPROC    ChooseConfig;
+    PFNEGLBINDAPIPROC         BindAPI;
+    PFNEGLCREATECONTEXTPROC   CreateContext;
+    PFNEGLDESTROYCONTEXTPROC  DestroyContext;
+    PFNEGLCREATEPBUFFERSURFACEPROC CreatePbufferSurface;
+    PFNEGLDESTROYSURFACEPROC  DestroySurface;
+    PFNEGLMAKECURRENTPROC     MakeCurrent;
+} egl;
+
+static b8
+mvLoadEGL()
+{
+    if (egl.GetProcAddress)
+        return true;
+
+    // stays loaded; gl3w picks it up to load the GL functions as well
+    void* libegl = dlopen("libEGL.so.1", RTLD_LAZY | RTLD_LOCAL);
+    if (!libegl)
+        return false;
+
+    *(void**)&egl.GetProcAddress       = dlsym(libegl, "eglGetProcAddress");
+    *(void**)&egl.GetError             = dlsym(libegl, "eglGetError");
+    *(void**)&egl.QueryString          = dlsym(libegl, "eglQueryString");
+    *(void**)&egl.GetDisplay           = dlsym(libegl, "eglGetDisplay");
+    *(void**)&egl.Initialize           = dlsym(libegl, "eglInitialize");
+    *(void**)&egl.Terminate            = dlsym(libegl, "eglTerminate");
+    *(void**)&egl.ChooseConfig         = dlsym(libegl, "eglChooseConfig");
+    *(void**)&egl.BindAPI              = dlsym(libegl, "eglBindAPI");
+    *(void**)&egl.CreateContext        = dlsym(libegl, "eglCreateContext");
+    *(void**)&egl.DestroyContext       = dlsym(libegl, "eglDestroyContext");
+    *(void**)&egl.CreatePbufferSurface = dlsym(libegl, "eglCreatePbufferSurface");
+    *(void**)&egl.DestroySurface       = dlsym(libegl, "eglDestroySurface");
+    *(void**)&egl.MakeCurrent          = dlsym(libegl, "eglMakeCurrent");
+
+    if (!(egl.GetProcAddress && egl.GetError && egl.QueryString && egl.GetDisplay && egl.Initialize
+        && egl.Terminate && egl.ChooseConfig && egl.BindAPI && egl.CreateContext && egl.DestroyContext
+        && egl.CreatePbufferSurface && egl.DestroySurface && egl.MakeCurrent))
+    {
+        egl = {};
+        return false;
+    }
+    return true;
+}
+
+static EGLDisplay
+mvGetHeadlessDisplay()
+{
+    // client extensions, i.e. the platforms we can ask for
+    const char* extensions = egl.QueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)egl.GetProcAddress("eglGetPlatformDisplayEXT");
+
+    if (extensions && getPlatformDisplay)
+    {
+        if (strstr(extensions, "EGL_MESA_platform_surfaceless"))
+        {
+            EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY && egl.Initialize(display, nullptr, nullptr))
+                return display;
+        }
+
+        auto queryDevices = (PFNEGLQUERYDEVICESEXTPROC)egl.GetProcAddress("eglQueryDevicesEXT");
+        if (strstr(extensions, "EGL_EXT_platform_device") && queryDevices)
+        {
+            EGLDeviceEXT devices[8];
+            EGLint deviceCount = 0;
+            queryDevices(8, devices, &deviceCount);
+            for (EGLint i = 0; i < deviceCount; i++)
+            {
+                EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[i], nullptr);
+                if (display != EGL_NO_DISPLAY && egl.Initialize(display, nullptr, nullptr))
+                    return display;
+            }
+        }
+    }
+
+    EGLDisplay display = egl.GetDisplay(EGL_DEFAULT_DISPLAY);
+    if (display != EGL_NO_DISPLAY && egl.Initialize(display, nullptr, nullptr))
+        return display;
+    return EGL_NO_DISPLAY;
+}
+
+static void
+mvResizeHeadlessFramebuffer(mvViewportData& viewportData, int width, int height)
+{
+    if (viewportData.framebuffer == 0)
+    {
+        glGenFramebuffers(1, &viewportData.framebuffer);
+        glGenRenderbuffers(1, &viewportData.colorbuffer);
+    }
+
+    glBindRenderbuffer(GL_RENDERBUFFER, viewportData.colorbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+    // stays bound: everything renders into it, and output_frame_buffer reads from it
+    glBindFramebuffer(GL_FRAMEBUFFER, viewportData.framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, viewportData.colorbuffer);
+
+    viewportData.width = width;
+    viewportData.height = height;
+}
+
+static b8
+mvCreateHeadlessContext(mvViewport& viewport, mvViewportData& viewportData)
+{
+    if (!mvLoadEGL())
+    {
+        fprintf(stderr, "Headless viewport: libEGL.so.1 could not be loaded\n");
+        return false;
+    }
+
+    EGLDisplay display = mvGetHeadlessDisplay();
+    if (display == EGL_NO_DISPLAY)
+    {
+        fprintf(stderr, "Headless viewport: no EGL display available (error 0x%x)\n", egl.GetError());
+        return false;
+    }
+    viewportData.eglDisplay = display;
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+        EGL_NONE
+    };
+
+    // GL 3.0, same as the windowed viewport
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 0,
+        EGL_NONE
+    };
+
+    EGLConfig config;
+    EGLint configCount = 0;
+    if (!egl.ChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0
+        || !egl.BindAPI(EGL_OPENGL_API))
+    {
+        fprintf(stderr, "Headless viewport: no suitable EGL config (error 0x%x)\n", egl.GetError());
+        return false;
+    }
+
+    EGLContext context = egl.CreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT)
+    {
+        fprintf(stderr, "Headless viewport: EGL context creation failed (error 0x%x)\n", egl.GetError());
+        return false;
+    }
+    viewportData.eglContext = context;
+
+    // we render into our own framebuffer, so no surface is needed
+    // where EGL_KHR_surfaceless_context is supported
+    const char* extensions = egl.QueryString(display, EGL_EXTENSIONS);
+    if (!extensions || !strstr(extensions, "EGL_KHR_surfaceless_context"))
+    {
+        const EGLint surfaceAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        viewportData.eglSurface = egl.CreatePbufferSurface(display, config, surfaceAttribs);
+    }
+
+    EGLSurface surface = viewportData.eglSurface ? viewportData.eglSurface : EGL_NO_SURFACE;
+    if (!egl.MakeCurrent(display, surface, surface, context))
+    {
+        fprintf(stderr, "Headless viewport: making the EGL context current failed (error 0x%x)\n", egl.GetError());
+        return false;
+    }
+
+    if (gl3wInit() != GL3W_OK)
+    {
+        fprintf(stderr, "Headless viewport: loading OpenGL failed\n");
+        return false;
+    }
+
+    mvResizeHeadlessFramebuffer(viewportData, viewport.actualWidth, viewport.actualHeight);
+    viewportData.lastFrameTime = std::chrono::steady_clock::now();
+    return true;
+}
+
+static void
+mvDestroyHeadlessContext(mvViewportData& viewportData)
+{
+    if (viewportData.framebuffer)
+    {
+        glDeleteFramebuffers(1, &viewportData.framebuffer);
+        glDeleteRenderbuffers(1, &viewportData.colorbuffer);
+        viewportData.framebuffer = 0;
+        viewportData.colorbuffer = 0;
+    }
+
+    if (viewportData.eglDisplay)
+    {
+        egl.MakeCurrent(viewportData.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (viewportData.eglSurface)
+            egl.DestroySurface(viewportData.eglDisplay, viewportData.eglSurface);
+        if (viewportData.eglContext)
+            egl.DestroyContext(viewportData.eglDisplay, viewportData.eglContext);
+        egl.Terminate(viewportData.eglDisplay);
+    }
+
+    viewportData.eglDisplay = nullptr;
+    viewportData.eglSurface = nullptr;
+    viewportData.eglContext = nullptr;
+}
+
+static void
+mvWaitHeadless(mvViewportData& viewportData, double timeout)
+{
+    std::unique_lock lk(viewportData.wakeMutex);
+    auto woken = [&viewportData]() { return viewportData.woken; };
+
+    if (timeout < 0.0)
+        viewportData.wakeCondition.wait(lk, woken);
+    else if (timeout > 0.0)
+        viewportData.wakeCondition.wait_for(lk, std::chrono::duration<double>(timeout), woken);
+    viewportData.woken = false;
+}
+
+static void
+mvPrerenderHeadless()
+{
+    std::unique_lock lk(GContext->mutex);
+
+    mvViewport* viewport = GContext->viewport;
+    auto viewportData = (mvViewportData*)viewport->platformSpecifics;
+
+    if (viewport->sizeDirty)
+    {
+        viewport->actualWidth = std::clamp(viewport->actualWidth, (int)viewport->minwidth, (int)viewport->maxwidth);
+        viewport->actualHeight = std::clamp(viewport->actualHeight, (int)viewport->minheight, (int)viewport->maxheight);
+        viewport->clientWidth = viewport->actualWidth;
+        viewport->clientHeight = viewport->actualHeight;
+        mvResizeHeadlessFramebuffer(*viewportData, viewport->actualWidth, viewport->actualHeight);
+        viewport->resized = true;
+        viewport->sizeDirty = false;
+    }
+
+    // nothing to apply these to
+    viewport->posDirty = false;
+    viewport->modesDirty = false;
+    viewport->titleDirty = false;
+
+    if (GContext->IO.waitForInput)
+    {
+        lk.unlock();
+        mvWaitHeadless(*viewportData, mvTimeToNextFrame());
+
+        // nothing has changed since the last frame
+        if (!mvFrameNeeded())
+            return;
+        lk.lock();
+    }
+
+    mvToolManager::GetFontManager().updateAtlas();
+
+    // there's no platform backend, so we do its part of the new frame
+    auto now = std::chrono::steady_clock::now();
+    std::chrono::duration<float> elapsed = now - viewportData->lastFrameTime;
+    viewportData->lastFrameTime = now;
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2((float)viewportData->width, (float)viewportData->height);
+    io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
+    io.DeltaTime = elapsed.count() > 0.0f ? elapsed.count() : 1.0f / 60.0f;
+    if (viewport->fixedDeltaTime > 0.0f)
+        io.DeltaTime = viewport->fixedDeltaTime;
+
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui::NewFrame();
+}
+
 static void
 mvPrerender()
 {
-    std::lock_guard lk(GContext->mutex);
+    std::unique_lock lk(GContext->mutex);
 
     mvViewport* viewport = GContext->viewport;
     auto viewportData = (mvViewportData*)viewport->platformSpecifics;
@@ -78,6 +419,10 @@ mvPrerender()
         viewport->titleDirty = false;
     }
 
+    // API calls must not be blocked while we're waiting for events (the
+    // callbacks lock the mutex themselves, see install_input_callbacks)
+    lk.unlock();
+
     if (glfwGetWindowAttrib(viewportData->handle, GLFW_ICONIFIED))
     {
         glfwWaitEvents();
@@ -91,15 +436,29 @@ mvPrerender()
     // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
 
     if (GContext->IO.waitForInput)
-        glfwWaitEvents();
-    else
-        glfwPollEvents();
+    {
+        double timeout = mvTimeToNextFrame();
+        if (timeout < 0.0)
+            glfwWaitEvents();
+        else if (timeout > 0.0)
+            glfwWaitEventsTimeout(timeout);
+    }
+
+    // whatever arrived after the wait is handled with the mutex held
+    lk.lock();
+    glfwPollEvents();
+
+    // nothing has changed since the last frame
+    if (GContext->IO.waitForInput && !mvFrameNeeded())
+        return;
 
     mvToolManager::GetFontManager().updateAtlas();
 
     // Start the Dear ImGui frame
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
+    if (viewport->fixedDeltaTime > 0.0f)
+        ImGui::GetIO().DeltaTime = viewport->fixedDeltaTime;
     ImGui::NewFrame();
 
 }
@@ -119,21 +478,23 @@ mvCleanupViewport(mvViewport& viewport)
 
     // Cleanup
     ImGui_ImplOpenGL3_Shutdown();
-    ImGui_ImplGlfw_Shutdown();
-
-    glfwDestroyWindow(viewportData->handle);
-    glfwTerminate();
+    if (viewport.headless)
+        mvDestroyHeadlessContext(*viewportData);
+    else
+    {
+        ImGui_ImplGlfw_Shutdown();
+        glfwDestroyWindow(viewportData->handle);
+        glfwTerminate();
+    }
     StopRendering();
 
     delete viewportData;
     viewportData = nullptr;
 }
 
- void
-mvShowViewport(mvViewport& viewport, bool minimized, bool maximized)
+static void
+mvCreateWindow(mvViewport& viewport, mvViewportData* viewportData, bool minimized, bool maximized)
 {
-    auto viewportData = (mvViewportData*)viewport.platformSpecifics;
-
     // Setup window
     glfwSetErrorCallback(glfw_error_callback);
     glfwInit();
@@ -188,6 +549,26 @@ mvShowViewport(mvViewport& viewport, bool minimized, bool maximized)
 
     glfwMakeContextCurrent(viewportData->handle);
     gl3wInit();
+}
+
+ void
+mvShowViewport(mvViewport& viewport, bool minimized, bool maximized)
+{
+    auto viewportData = (mvViewportData*)viewport.platformSpecifics;
+
+    if (viewport.headless)
+    {
+        if (!mvCreateHeadlessContext(viewport, *viewportData))
+        {
+            mvDestroyHeadlessContext(*viewportData);
+            mvThrowPythonError(mvErrorCode::mvNone, "show_viewport", "Headless viewport could not be created (no usable EGL/OpenGL).", nullptr);
+            return;
+        }
+        viewport.clientWidth = viewport.actualWidth;
+        viewport.clientHeight = viewport.actualHeight;
+    }
+    else
+        mvCreateWindow(viewport, viewportData, minimized, maximized);
 
     ImGuiIO& io = ImGui::GetIO(); (void)io;
     io.ConfigWindowsMoveFromTitleBarOnly = true;
@@ -219,40 +600,67 @@ mvShowViewport(mvViewport& viewport, bool minimized, bool maximized)
     ImGui::StyleColorsDark();
     SetDefaultTheme();
 
+    if (viewport.headless)
+        return;
+
     // Setup Platform/Renderer bindings
-    ImGui_ImplGlfw_InitForOpenGL(viewportData->handle, true);
+    ImGui_ImplGlfw_InitForOpenGL(viewportData->handle, false);
         
 
     // Setup callbacks
+    install_input_callbacks(viewportData->handle);
     glfwSetWindowSizeCallback(viewportData->handle, window_size_callback);
     glfwSetWindowCloseCallback(viewportData->handle, window_close_callback);
+    glfwSetWindowRefreshCallback(viewportData->handle, window_refresh_callback);
 }
     
  void
 mvMaximizeViewport(mvViewport& viewport)
 {
     auto viewportData = (mvViewportData*)viewport.platformSpecifics;
-    glfwMaximizeWindow(viewportData->handle);
+    if (viewportData->handle)
+        glfwMaximizeWindow(viewportData->handle);
 }
 
  void
 mvMinimizeViewport(mvViewport& viewport)
 {
     auto viewportData = (mvViewportData*)viewport.platformSpecifics;
-    glfwIconifyWindow(viewportData->handle);
+    if (viewportData->handle)
+        glfwIconifyWindow(viewportData->handle);
 }
 
  void
 mvRestoreViewport(mvViewport& viewport)
 {
     auto viewportData = (mvViewportData*)viewport.platformSpecifics;
-    glfwRestoreWindow(viewportData->handle);
+    if (viewportData->handle)
+        glfwRestoreWindow(viewportData->handle);
+}
+
+ void
+mvWakeViewport(mvViewport& viewport)
+{
+    if (viewport.headless)
+    {
+        auto viewportData = (mvViewportData*)viewport.platformSpecifics;
+        {
+            std::lock_guard lk(viewportData->wakeMutex);
+            viewportData->woken = true;
+        }
+        viewportData->wakeCondition.notify_one();
+    }
+    else
+        glfwPostEmptyEvent();
 }
 
  void
 mvRenderFrame()
 {
-    mvPrerender();
+    if (GContext->viewport->headless)
+        mvPrerenderHeadless();
+    else
+        mvPrerender();
 
     if (GImGui->CurrentWindow == nullptr)
         return;
@@ -271,6 +679,8 @@ mvToggleFullScreen(mvViewport& viewport)
     static int    storedYPos = 0;
 
     auto viewportData = (mvViewportData*)viewport.platformSpecifics;
+    if (viewport.headless)
+        return;
 
     GLFWmonitor* monitor = glfwGetPrimaryMonitor();
     const GLFWvidmode* mode = glfwGetVideoMode(monitor);
@@ -1,4 +1,5 @@
 #include "mvWindowsSpecifics.h"
+#include <cmath>
 
 
 static BYTE gprevious_ime_char;
@@ -90,6 +91,8 @@ StartNewFrame()
 	// Start the Dear ImGui frame
 	ImGui_ImplDX11_NewFrame();
 	ImGui_ImplWin32_NewFrame();
+	if (GContext->viewport->fixedDeltaTime > 0.0f)
+		ImGui::GetIO().DeltaTime = GContext->viewport->fixedDeltaTime;
 
 	// Note: ImGui::NewFrame can conflict with get_text_size() on fonts:
 	// in particular, it can do SetCurrentFont() somewhere in the middle of
@@ -120,7 +123,13 @@ mvPrerender(mvViewport& viewport)
 	// Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
 
 	if (GContext->IO.waitForInput)
-		::WaitMessage();
+	{
+		double timeout = mvTimeToNextFrame();
+		if (timeout < 0.0)
+			::WaitMessage();
+		else if (timeout > 0.0)
+			::MsgWaitForMultipleObjects(0, nullptr, FALSE, (DWORD)std::ceil(timeout * 1000.0), QS_ALLINPUT);
+	}
 
 	while (::PeekMessage(&viewportData->msg, nullptr, 0U, 0U, PM_REMOVE))
 	{
@@ -136,6 +145,10 @@ mvPrerender(mvViewport& viewport)
 		}
 	}
 
+	// nothing has changed since the last frame
+	if (GContext->IO.waitForInput && !mvFrameNeeded())
+		return false;
+
 	StartNewFrame();
 	return true;
 }
@@ -145,8 +158,13 @@ const UINT_PTR resizeTimerID = 1;
 static LRESULT
 mvHandleMsg(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) noexcept
 {
-	if (ImGui_ImplWin32_WndProcHandler(hWnd, msg, wParam, lParam))
-		return true;
+	{
+		// The handler writes ImGui IO, which API calls read with the mutex held.
+		// Only the handlers lock it: WaitMessage() in mvPrerender must not.
+		std::lock_guard lk(GContext->mutex);
+		if (ImGui_ImplWin32_WndProcHandler(hWnd, msg, wParam, lParam))
+			return true;
+	}
 
 	mvViewport* viewport = GContext->viewport;
 	mvGraphics& graphics = GContext->graphics;
@@ -283,6 +301,7 @@ mvHandleMsg(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) noexcept
 	case WM_IME_CHAR:
 		if (glang_id == 0x0412)
 			break;
+		std::lock_guard lk(GContext->mutex);
 		auto& io = ImGui::GetIO();
 		DWORD wChar = (DWORD)wParam;
 		if (wChar <= 127)
@@ -456,6 +475,13 @@ mvCleanupViewport(mvViewport& viewport)
 	::UnregisterClass(viewportData->wc.lpszClassName, viewportData->wc.hInstance);
 }
 
+void
+mvWakeViewport(mvViewport& viewport)
+{
+	mvViewportData* viewportData = (mvViewportData*)viewport.platformSpecifics;
+	::PostMessage(viewportData->handle, WM_NULL, 0, 0);
+}
+
 void
 mvRenderFrame()
 {
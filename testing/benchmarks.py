@@ -0,0 +1,171 @@
+"""Benchmarks of Dear PyGui internals, timed through the Python API.
+
+Usage: python benchmarks.py [name ...]   (all of them without names)
+
+Timings include the cost of the Python call itself, so compare the rows of
+one benchmark with each other rather than with numbers taken elsewhere.
+"""
+import random
+import sys
+import threading
+import time
+import dearpygui.dearpygui as dpg
+
+
+benchmarks = {}
+
+def benchmark(func):
+    benchmarks[func.__name__] = func
+    return func
+
+def report(label, seconds, count):
+    print(f"  {label:<40} {seconds*1e9/count:10.1f} ns/op")
+
+def start_rendering():
+    # a headless viewport needs no display (Linux only)
+    dpg.create_viewport(width=400, height=300, vsync=False, headless=sys.platform.startswith("linux"))
+    dpg.setup_dearpygui()
+    dpg.show_viewport()
+
+
+@benchmark
+def item_registry():
+    """Item creation and lookup by UUID at 10k, 100k and 1M items. Generated
+    UUIDs go through the registry's slots. Items tagged with generate_uuid()
+    go through the taggedItems map, the same unordered_map the registry used
+    for every item before the slots (allItems), so the "tagged" rows are the
+    baseline. Only API older than the slots is used, so running this file
+    with a released dearpygui installed gives the before numbers as well."""
+
+    lookups = 1_000_000
+    for count in (10_000, 100_000, 1_000_000):
+        dpg.create_context()
+        tags = [dpg.generate_uuid() for _ in range(count)]
+
+        print(f"{count} items")
+        with dpg.value_registry():
+            start = time.perf_counter()
+            generated = [dpg.add_int_value() for _ in range(count)]
+            report("create, generated (slots)", time.perf_counter() - start, count)
+
+            start = time.perf_counter()
+            tagged = [dpg.add_int_value(tag=tag) for tag in tags]
+            report("create, tagged (map, baseline)", time.perf_counter() - start, count)
+
+        for label, uuids in (("lookup, generated (slots)", generated), ("lookup, tagged (map, baseline)", tagged)):
+            sample = random.choices(uuids, k=lookups)
+            start = time.perf_counter()
+            for uuid in sample:
+                dpg.does_item_exist(uuid)
+            report(label, time.perf_counter() - start, lookups)
+
+        dpg.destroy_context()
+
+
+@benchmark
+def child_deletion():
+    """Deleting every child of a window, one delete_item call per child, in
+    order and at random. Runs of sibling deletions are unlinked in one pass,
+    so both should scale linearly, like a single delete_items call."""
+
+    for count in (10_000, 100_000):
+        print(f"{count} children")
+        for label in ("delete_item, in order", "delete_item, random order", "delete_items"):
+            dpg.create_context()
+            with dpg.window() as window:
+                children = dpg.add_items([("add_text", None, None)] * count)
+            if label.endswith("random order"):
+                random.shuffle(children)
+
+            start = time.perf_counter()
+            if label == "delete_items":
+                dpg.delete_items(children)
+            else:
+                for child in children:
+                    dpg.delete_item(child)
+            dpg.get_item_children(window, 1)  # unlinks what is still batched
+            report(label, time.perf_counter() - start, count)
+
+            dpg.destroy_context()
+
+
+@benchmark
+def command_queue_contention():
+    """Threads calling set_value while frames are being rendered. With
+    command_buffer=True the calls are pushed onto the item command queue
+    (a multi-producer ring), so this is the queue under contention. The
+    threads only truly run in parallel on a free-threaded Python. The task
+    and callback queues are benchmarked by queue_benchmark.cpp."""
+
+    calls = 200_000
+    for threads in (1, 2, 4, 8):
+        dpg.create_context()
+        dpg.configure_app(command_buffer=True)
+        with dpg.window():
+            items = [dpg.add_input_int() for _ in range(threads)]
+        start_rendering()
+
+        def produce(item):
+            for value in range(calls // threads):
+                dpg.set_value(item, value)
+        producers = [threading.Thread(target=produce, args=(item,)) for item in items]
+        start = time.perf_counter()
+        for producer in producers:
+            producer.start()
+        # frames are rendered on this thread (viewports want the main thread)
+        while any(producer.is_alive() for producer in producers):
+            dpg.render_dearpygui_frame()
+        elapsed = time.perf_counter() - start
+
+        report(f"{threads} producer thread(s)", elapsed, calls)
+        dpg.destroy_context()
+
+
+@benchmark
+def buffer_conversion():
+    """set_value with 10M-element numpy arrays of each supported format,
+    which converts them with one bulk kernel per format, against the same
+    values passed as a list, which converts them one PyObject at a time (the
+    per-element path buffers used to take as well). Results are checked
+    against numpy's own conversion."""
+
+    import numpy as np
+
+    size = 10_000_000
+    repeats = 5
+    dpg.create_context()
+    with dpg.value_registry():
+        floats = dpg.add_float_vect_value()
+        series = dpg.add_series_value()
+
+    def time_set_value(item, value):
+        start = time.perf_counter()
+        for _ in range(repeats):
+            dpg.set_value(item, value)
+        return time.perf_counter() - start
+
+    source = np.random.default_rng(0).uniform(-100.0, 100.0, size)
+    for dtype in ("float64", "float32", "int64", "int32", "int16", "uint8"):
+        array = source.astype(dtype) if dtype.startswith("float") else np.abs(source).astype(dtype)
+        elements = array.tolist()
+        for label, item, target, wrap in (("-> float", floats, "float32", lambda a: a),
+                                          ("-> double", series, "float64", lambda a: [a])):
+            per_element = time_set_value(item, wrap(elements))
+            report(f"{dtype:<8} {label}, list (baseline)", per_element, repeats*size)
+            bulk = time_set_value(item, wrap(array))
+            report(f"{dtype:<8} {label}, buffer", bulk, repeats*size)
+            print(f"  {'':<40} {per_element/bulk:10.1f}x")
+
+            value = dpg.get_value(item, as_buffer=True)
+            converted = np.frombuffer(value[0] if isinstance(value, list) else value, dtype=target)
+            if not np.array_equal(converted, array.astype(target)):
+                print(f"  {dtype} {label}: conversion MISMATCH")
+        del elements
+
+    dpg.destroy_context()
+
+
+if __name__ == '__main__':
+    for name in sys.argv[1:] or benchmarks:
+        print(f"--- {name}")
+        benchmarks[name]()
@@ -0,0 +1,165 @@
+// Contention benchmark of mvQueue, the ring behind mvSubmitTask (`tasks`,
+// drained by the render thread with try_pop) and mvSubmitCallback (`calls`,
+// drained by the handler thread with wait_and_pop). Producer threads push
+// std::packaged_task-wrapped lambdas the way both submit functions do, while
+// one consumer runs them. The same traffic also goes through the two-mutex
+// linked queue mvQueue used to be (mvLockedQueue below), as the baseline.
+//
+// The Python benchmarks can't get at these queues from several threads
+// without the context mutex in the way, hence a standalone program:
+//
+//   c++ -O2 -std=c++17 -I../src $(python3-config --includes) -o queue_benchmark
+//       queue_benchmark.cpp $(python3-config --embed --ldflags) -lpthread
+//   ./queue_benchmark
+
+#include "mvQueue.h"
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <vector>
+
+// mvQueue before the ring: a linked list with a head and a tail mutex, and a
+// node plus a shared_ptr allocated per push.
+template<typename T>
+class mvLockedQueue
+{
+
+    struct node
+    {
+        std::shared_ptr<T>    data;
+        std::unique_ptr<node> next;
+    };
+
+public:
+
+    mvLockedQueue() : m_head(new node), m_tail(m_head.get()) {}
+
+    void push(T value)
+    {
+        std::shared_ptr<T> new_data = std::make_shared<T>(std::move(value));
+        auto p = std::make_unique<node>();
+        {
+            std::lock_guard<std::mutex> tail_lock(m_tail_mutex);
+            m_tail->data = std::move(new_data);
+            node* const new_tail = p.get();
+            m_tail->next = std::move(p);
+            m_tail = new_tail;
+        }
+        m_data_cond.notify_one();
+    }
+
+    bool try_pop(T& value)
+    {
+        std::lock_guard<std::mutex> head_lock(m_head_mutex);
+        if (m_head.get() == get_tail())
+            return false;
+        value = std::move(*m_head->data);
+        pop_head();
+        return true;
+    }
+
+    void wait_and_pop(T& value)
+    {
+        std::unique_lock<std::mutex> head_lock(m_head_mutex);
+        m_data_cond.wait(head_lock, [&] {return m_head.get() != get_tail(); });
+        value = std::move(*m_head->data);
+        pop_head();
+    }
+
+private:
+
+    node* get_tail()
+    {
+        std::lock_guard<std::mutex> tail_lock(m_tail_mutex);
+        return m_tail;
+    }
+
+    void pop_head()
+    {
+        std::unique_ptr<node> old_head = std::move(m_head);
+        m_head = std::move(old_head->next);
+    }
+
+private:
+
+    std::mutex              m_head_mutex;
+    std::mutex              m_tail_mutex;
+    std::unique_ptr<node>   m_head;
+    node*                   m_tail;
+    std::condition_variable m_data_cond;
+
+};
+
+static constexpr i32 calls = 1'000'000;
+
+// what mvSubmitTask/mvSubmitCallback push
+static mvFunctionWrapper
+MakeCall(std::atomic<i64>& sum, i32 value)
+{
+    std::packaged_task<void()> task([&sum, value]() { sum.fetch_add(value, std::memory_order_relaxed); });
+    return mvFunctionWrapper(std::move(task));
+}
+
+template<typename Queue>
+static double
+Run(Queue& queue, i32 producers, b8 waiting)
+{
+    std::atomic<i64> sum = 0;
+    const i32 perProducer = calls / producers;
+    const i32 total = perProducer * producers;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread consumer([&]() {
+        mvFunctionWrapper call;
+        for (i32 done = 0; done < total; ++done)
+        {
+            if (waiting)
+                queue.wait_and_pop(call);
+            else
+                while (!queue.try_pop(call))
+                    std::this_thread::yield();
+            call();
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (i32 i = 0; i < producers; ++i)
+        threads.emplace_back([&]() {
+            for (i32 value = 0; value < perProducer; ++value)
+                queue.push(MakeCall(sum, 1));
+        });
+    for (auto& thread : threads)
+        thread.join();
+    consumer.join();
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (sum != total)
+        std::printf("  checksum MISMATCH: %lld of %d calls ran\n", (long long)sum.load(), total);
+    return elapsed * 1e9 / total;
+}
+
+static void
+Report(const char* label, i32 producers, double ring, double locked)
+{
+    std::printf("  %-16s %d producer thread(s) %10.1f ns/op %10.1f ns/op (locked, baseline) %6.1fx\n",
+        label, producers, ring, locked, locked / ring);
+}
+
+int main()
+{
+    for (i32 producers : { 1, 2, 4, 8 })
+    {
+        {
+            mvQueue<mvFunctionWrapper> ring;
+            mvLockedQueue<mvFunctionWrapper> locked;
+            Report("tasks (try_pop)", producers, Run(ring, producers, false), Run(locked, producers, false));
+        }
+        {
+            mvQueue<mvFunctionWrapper> ring{ 4096 };
+            mvLockedQueue<mvFunctionWrapper> locked;
+            Report("calls (wait)", producers, Run(ring, producers, true), Run(locked, producers, true));
+        }
+    }
+    return 0;
+}
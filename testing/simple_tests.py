@@ -1,3 +1,9 @@
+import array
+import asyncio
+import importlib.util
+import math
+import threading
+import time
 import unittest
 import dearpygui.dearpygui as dpg
 
@@ -46,7 +52,94 @@ def test_moving_items(self):
         self.assertTrue(children[3] == self.item4)
         self.assertTrue(children[4] == self.item3)
 
+    def test_stale_uuids(self):
 
+        dpg.delete_item(self.item3)
+        item6 = dpg.add_button(label="item6", parent=self.window_id)
+
+        # the new item may reuse item3's storage, but not its uuid
+        self.assertNotEqual(item6, self.item3)
+        self.assertFalse(dpg.does_item_exist(self.item3))
+        self.assertTrue(dpg.does_item_exist(item6))
+
+        # a stale uuid can still be claimed explicitly
+        item7 = dpg.add_button(label="item7", parent=self.window_id, tag=self.item3)
+        self.assertEqual(item7, self.item3)
+        self.assertEqual(dpg.get_item_label(self.item3), "item7")
+        self.assertEqual(dpg.get_item_label(item6), "item6")
+
+    def test_memory_stats(self):
+
+        buttons = dpg.get_memory_stats()["types"]["mvAppItemType::mvButton"]
+        self.assertEqual(buttons["count"], 5)
+        self.assertEqual(buttons["cold_configs"], 0)
+
+        dpg.configure_item(self.item1, drop_callback=lambda: None)
+        buttons = dpg.get_memory_stats()["types"]["mvAppItemType::mvButton"]
+        self.assertEqual(buttons["cold_configs"], 1)
+        self.assertEqual(dpg.get_item_configuration(self.item2)["payload_type"], "$$DPG_PAYLOAD")
+
+    def test_delete_items(self):
+
+        dpg.delete_items([self.item4, self.item1, self.item2])
+
+        children = dpg.get_item_children(self.window_id, 1)
+        self.assertEqual(children, [self.item3, self.item5])
+        self.assertFalse(dpg.does_item_exist(self.item1))
+
+        # locations are kept up to date, so moves still work
+        dpg.move_item_up(self.item5)
+        children = dpg.get_item_children(self.window_id, 1)
+        self.assertEqual(children, [self.item5, self.item3])
+
+    def test_delete_item_siblings(self):
+
+        # deleting siblings one by one is batched until the tree is read
+        dpg.add_button(label="item6", parent=self.window_id, tag="item6")
+        dpg.delete_item(self.item2)
+        dpg.delete_item("item6")
+        dpg.delete_item(self.item4)
+        self.assertFalse(dpg.does_item_exist(self.item2))
+        self.assertFalse(dpg.does_item_exist("item6"))
+
+        # the alias is free right away
+        item6 = dpg.add_button(label="item6", parent=self.window_id, tag="item6")
+        children = dpg.get_item_children(self.window_id, 1)
+        self.assertEqual(children, [self.item1, self.item3, self.item5, item6])
+
+        dpg.move_item_up(self.item5)
+        children = dpg.get_item_children(self.window_id, 1)
+        self.assertEqual(children, [self.item1, self.item5, self.item3, item6])
+
+        # deleting the parent ends the batch
+        dpg.delete_item(self.item1)
+        dpg.delete_item(self.window_id)
+        self.assertFalse(dpg.does_item_exist(self.item3))
+
+    def test_add_items_bad_entry(self):
+
+        children = dpg.get_item_children(self.window_id, 1)
+
+        # a missing required argument is found before anything is created
+        with self.assertRaises(Exception):
+            dpg.add_items([("add_button", self.window_id, None),
+                           ("add_static_texture", None, {"width": 1, "height": 1}),
+                           ("add_button", self.window_id, None)])
+        self.assertEqual(dpg.get_item_children(self.window_id, 1), children)
+
+        # a button can't be a parent; the items created before it are deleted
+        with self.assertRaises(Exception):
+            dpg.add_items([("add_group", self.window_id, {"tag": "batch_group"}),
+                           ("add_button", "batch_group", None),
+                           ("add_button", self.item1, None),
+                           ("add_button", self.window_id, None)])
+        self.assertEqual(dpg.get_item_children(self.window_id, 1), children)
+        self.assertFalse(dpg.does_item_exist("batch_group"))
+
+        # required arguments are taken by name
+        with dpg.texture_registry():
+            texture = dpg.add_items([("add_static_texture", None, {"width": 1, "height": 1, "default_value": [1, 1, 1, 1]})])[0]
+        self.assertEqual(dpg.get_item_configuration(texture)["width"], 1)
 
     def test_zelete_items(self):
 
@@ -257,5 +350,657 @@ def tearDown(self):
         dpg.destroy_context()
 
 
+class TestSeriesDataSource(unittest.TestCase):
+
+    # series fed with float64 buffers are referenced in place; items using
+    # them as a data source must still see the data
+
+    def setUp(self):
+        dpg.create_context()
+
+    def tearDown(self):
+        dpg.destroy_context()
+
+    @unittest.skipIf(importlib.util.find_spec("numpy") is None, "needs numpy")
+    def test_buffer_series_as_source(self):
+
+        import numpy as np
+        x = np.arange(4, dtype=np.float64)
+        y = x * 2.0
+
+        with dpg.window():
+            with dpg.plot():
+                axis = dpg.add_plot_axis(dpg.mvYAxis)
+                source = dpg.add_line_series(x, y, parent=axis)
+                consumer = dpg.add_scatter_series([], [], parent=axis, source=source)
+        with dpg.value_registry():
+            value = dpg.add_series_value(source=source)
+
+        self.assertEqual(dpg.get_value(consumer)[:2], [list(x), list(y)])
+        self.assertEqual(dpg.get_value(value)[:2], [list(x), list(y)])
+
+        # still shared after the source gets new buffers
+        dpg.set_value(source, [y, x])
+        self.assertEqual(dpg.get_value(consumer)[:2], [list(y), list(x)])
+
+
+class TestBufferValues(unittest.TestCase):
+
+    # get_value(as_buffer=True) reads values back through the buffer protocol
+
+    def setUp(self):
+        dpg.create_context()
+
+    def tearDown(self):
+        dpg.destroy_context()
+
+    def test_float_buffers(self):
+
+        data = array.array('f', [0.5, 1.5, 2.5, 3.5])
+        with dpg.value_registry():
+            floats = dpg.add_float_vect_value(default_value=data)
+        with dpg.texture_registry():
+            texture = dpg.add_dynamic_texture(1, 1, data)
+
+        for item in (floats, texture):
+            view = dpg.get_value(item, as_buffer=True)
+            self.assertIsInstance(view, memoryview)
+            self.assertEqual(view.format, 'f')
+            self.assertEqual(view.tolist(), data.tolist())
+
+    def test_double_buffer_lists(self):
+
+        x = array.array('d', [1.0, 2.0, 3.0])
+        y = array.array('d', [4.0, 5.0, 6.0])
+        with dpg.value_registry():
+            series = dpg.add_series_value(default_value=[x, y])
+        with dpg.window():
+            with dpg.plot():
+                axis = dpg.add_plot_axis(dpg.mvYAxis)
+                line = dpg.add_line_series(x, y, parent=axis)
+
+        for item in (series, line):
+            views = dpg.get_value(item, as_buffer=True)
+            self.assertIsInstance(views, list)
+            self.assertTrue(all(view.format == 'd' for view in views))
+            self.assertEqual([view.tolist() for view in views[:2]], [x.tolist(), y.tolist()])
+
+        # the views are copies, later values don't show through
+        views = dpg.get_value(series, as_buffer=True)
+        dpg.set_value(series, [y, x])
+        self.assertEqual(views[0].tolist(), x.tolist())
+
+
+class TestAllocationStats(unittest.TestCase):
+
+    def setUp(self):
+        dpg.create_context()
+
+    def tearDown(self):
+        dpg.destroy_context()
+
+    def test_steady_state_values(self):
+
+        with dpg.value_registry():
+            floats = dpg.add_float_vect_value()
+            series = dpg.add_series_value()
+        with dpg.window():
+            with dpg.plot():
+                axis = dpg.add_plot_axis(dpg.mvYAxis)
+                line = dpg.add_line_series([], [], parent=axis)
+        with dpg.texture_registry():
+            texture = dpg.add_dynamic_texture(2, 2, [0.0]*16)
+
+        def update(step):
+            data = [float(step + i) for i in range(1000)]
+            dpg.set_value(floats, data)
+            dpg.set_value(series, [data, data])
+            dpg.set_value(line, [data, data])
+            dpg.set_value(texture, [step/10.0]*16)
+
+        update(0)
+        warm = dpg.get_allocation_stats()
+        for step in range(1, 10):
+            update(step)
+        stats = dpg.get_allocation_stats()
+
+        # same-sized values are converted into the existing storage
+        self.assertEqual(stats["pool_allocations"], warm["pool_allocations"])
+        self.assertEqual(stats["value_buffer_allocations"], warm["value_buffer_allocations"])
+        self.assertEqual(dpg.get_value(floats)[999], 1008.0)
+
+        # a larger value has to grow it
+        dpg.set_value(floats, [0.0]*2000)
+        self.assertGreater(dpg.get_allocation_stats()["value_buffer_allocations"], stats["value_buffer_allocations"])
+
+
+class TestHeadless(unittest.TestCase):
+
+    # rendering into an offscreen framebuffer and reading it back
+
+    width, height = 200, 150
+
+    def setUp(self):
+
+        dpg.create_context()
+
+        with dpg.theme() as theme:
+            with dpg.theme_component(dpg.mvAll):
+                dpg.add_theme_color(dpg.mvThemeCol_WindowBg, (255, 0, 0, 255))
+        with dpg.window() as window:
+            dpg.add_text("headless")
+        dpg.bind_item_theme(window, theme)
+        dpg.set_primary_window(window, True)
+
+        dpg.create_viewport(width=self.width, height=self.height, vsync=False, headless=True)
+        dpg.setup_dearpygui()
+        dpg.show_viewport()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_output_frame_buffer(self):
+
+        frames = []
+        dpg.render_dearpygui_frame()
+        dpg.output_frame_buffer(callback=lambda sender, buffer: frames.append(buffer))
+        for frame in range(50):
+            dpg.render_dearpygui_frame()
+            if frames:
+                break
+            time.sleep(0.01)
+
+        self.assertEqual(len(frames), 1)
+        buffer = frames[0]
+        self.assertEqual((buffer.get_width(), buffer.get_height()), (self.width, self.height))
+        self.assertEqual(len(buffer), self.width*self.height*4)
+
+        # the primary window's background fills the middle of the frame
+        middle = ((self.height//2)*self.width + self.width//2)*4
+        self.assertEqual([round(component, 2) for component in memoryview(buffer)[middle:middle + 4]], [1.0, 0.0, 0.0, 1.0])
+
+
+class TestCallbackQueue(unittest.TestCase):
+
+    # what happens to callbacks while the handler thread is busy
+
+    capacity, frames = 5, 12
+
+    def setUp(self):
+
+        dpg.create_context()
+        dpg.configure_app(callback_queue_capacity=self.capacity)
+
+        self.started = threading.Event()
+        self.release = threading.Event()
+        self.delivered = []
+
+        def gate():
+            self.started.set()
+            self.release.wait(10)
+
+        # blocks the handler thread until release is set
+        dpg.set_frame_callback(1, gate)
+
+        with dpg.window():
+            self.button = dpg.add_button(width=10)
+
+        dpg.create_viewport(width=200, height=200, vsync=False, headless=True)
+        dpg.setup_dearpygui()
+        dpg.show_viewport()
+
+        for frame in range(100):
+            dpg.render_dearpygui_frame()
+            if self.started.wait(0.01):
+                break
+
+    def tearDown(self):
+        self.release.set()
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def drain(self):
+        self.release.set()
+        for attempt in range(1000):
+            if dpg.get_callback_queue_stats()["pending"] == 0:
+                break
+            time.sleep(0.001)
+        return dpg.get_callback_queue_stats()
+
+    def submit_frame_callbacks(self):
+        # one callback per frame, with the frame number as the sender
+        first = dpg.get_frame_count() + 1
+        for frame in range(first, first + self.frames):
+            dpg.set_frame_callback(frame, lambda sender: self.delivered.append(sender))
+        for frame in range(self.frames):
+            dpg.render_dearpygui_frame()
+        return list(range(first, first + self.frames))
+
+    def test_capacity(self):
+
+        self.assertTrue(self.started.is_set())
+        self.assertEqual(dpg.get_app_configuration()["callback_queue_capacity"], self.capacity)
+        self.assertEqual(dpg.get_callback_queue_stats()["capacity"], self.capacity)
+
+    def test_drop_newest(self):
+
+        submitted = self.submit_frame_callbacks()
+        self.assertEqual(dpg.get_callback_queue_stats()["pending"], self.capacity)
+        stats = self.drain()
+
+        # the gate takes one place in the queue
+        self.assertEqual(self.delivered, submitted[:self.capacity - 1])
+        self.assertEqual(stats["dropped"], self.frames - (self.capacity - 1))
+        self.assertEqual(stats["coalesced"], 0)
+
+    def test_drop_oldest(self):
+
+        dpg.configure_app(callback_queue_policy=dpg.mvCallbackQueue_DropOldest)
+        submitted = self.submit_frame_callbacks()
+        stats = self.drain()
+
+        self.assertEqual(self.delivered, submitted[-(self.capacity - 1):])
+        self.assertEqual(stats["dropped"], self.frames - (self.capacity - 1))
+        self.assertEqual(stats["coalesced"], 0)
+
+    def resize_calls(self, coalesce):
+
+        dpg.configure_app(coalesce_callbacks=coalesce, callback_queue_capacity=100)
+        calls = []
+        with dpg.item_handler_registry() as registry:
+            dpg.add_item_resize_handler(callback=lambda: calls.append(dpg.get_item_width(self.button)))
+        dpg.bind_item_handler_registry(self.button, registry)
+
+        # the button is resized every frame
+        for frame in range(self.frames):
+            dpg.configure_item(self.button, width=20 + frame)
+            dpg.render_dearpygui_frame()
+        return calls, self.drain()
+
+    def test_without_coalescing(self):
+
+        calls, stats = self.resize_calls(False)
+        self.assertGreaterEqual(len(calls), self.frames - 1)
+        self.assertEqual(stats["coalesced"], 0)
+
+    def test_coalesce_callbacks(self):
+
+        calls, stats = self.resize_calls(True)
+
+        # one pending call at a time, and it sees the latest state
+        self.assertEqual(calls, [20 + self.frames - 1])
+        self.assertGreaterEqual(stats["coalesced"], self.frames - 2)
+        self.assertEqual(stats["dropped"], 0)
+
+
+class TestCallbackQueueColumns(unittest.TestCase):
+
+    # get_callback_queue_columns with manual callback management
+
+    def setUp(self):
+
+        dpg.create_context()
+        dpg.configure_app(manual_callback_management=True)
+
+        with dpg.window():
+            self.button = dpg.add_button(label="button")
+        with dpg.item_handler_registry() as registry:
+            dpg.add_item_visible_handler(callback=lambda: None, user_data="visible")
+        dpg.bind_item_handler_registry(self.button, registry)
+        dpg.set_frame_callback(2, lambda: None, user_data="frame")
+
+        dpg.create_viewport(width=200, height=200, vsync=False, headless=True)
+        dpg.setup_dearpygui()
+        dpg.show_viewport()
+
+        for frame in range(3):
+            dpg.render_dearpygui_frame()
+        # its callback gets the frame buffer as app_data
+        dpg.output_frame_buffer(callback=lambda: None)
+        dpg.render_dearpygui_frame()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_columns(self):
+
+        pending = dpg.get_callback_queue_stats()["pending"]
+        count, senders, types, values, objects, callbacks, user_data = dpg.get_callback_queue_columns()
+
+        self.assertEqual(count, pending)
+        self.assertEqual(len(senders), count)
+        self.assertEqual(len(callbacks), count)
+        self.assertEqual(dpg.get_callback_queue_stats()["pending"], 0)
+        self.assertIn("frame", user_data)
+        self.assertIn(None, user_data)
+
+        for row in range(count):
+            if user_data[row] == "visible":
+                # an item handler; app_data is the item it's bound to
+                self.assertGreaterEqual(types[row], 0)
+                self.assertEqual(values[row], self.button)
+                self.assertNotIn(row, objects)
+            elif user_data[row] == "frame":
+                self.assertEqual(senders[row], 2)
+                self.assertEqual(types[row], -1)
+                self.assertTrue(math.isnan(values[row]))
+                self.assertNotIn(row, objects)
+            else:
+                self.assertEqual(types[row], -1)
+                self.assertTrue(math.isnan(values[row]))
+                self.assertEqual(objects[row].get_width(), 200)
+
+    def test_columns_into_buffers(self):
+
+        pending = dpg.get_callback_queue_stats()["pending"]
+        senders, types, values = array.array('Q', [0]*2), array.array('i', [0]*2), array.array('d', [0.0]*2)
+
+        # only as many jobs as the buffers hold are taken
+        count, *columns = dpg.get_callback_queue_columns(senders=senders, types=types, values=values)
+        self.assertEqual(count, 2)
+        self.assertIs(columns[0], senders)
+        self.assertEqual(dpg.get_callback_queue_stats()["pending"], pending - 2)
+
+        count = dpg.get_callback_queue_columns()[0]
+        self.assertEqual(count, pending - 2)
+
+    def test_wrong_buffer_format(self):
+
+        pending = dpg.get_callback_queue_stats()["pending"]
+        with self.assertRaises(Exception):
+            dpg.get_callback_queue_columns(values=array.array('q', [0]*8))
+        self.assertEqual(dpg.get_callback_queue_stats()["pending"], pending)
+
+
+class TestTimers(unittest.TestCase):
+
+    # set_timer_callback/delete_timer_callback on a headless viewport
+
+    def setUp(self):
+
+        dpg.create_context()
+        self.fired = []
+
+        dpg.create_viewport(width=200, height=200, vsync=False, headless=True)
+        dpg.setup_dearpygui()
+        dpg.show_viewport()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def on_timer(self, sender):
+        self.fired.append(sender)
+
+    def render_for(self, seconds):
+        end = time.perf_counter() + seconds
+        while time.perf_counter() < end:
+            dpg.render_dearpygui_frame()
+            time.sleep(0.005)
+        for attempt in range(1000):
+            if dpg.get_callback_queue_stats()["pending"] == 0:
+                break
+            time.sleep(0.001)
+
+    def test_fire_and_rearm(self):
+
+        repeating = dpg.set_timer_callback(20, self.on_timer)
+        once = dpg.set_timer_callback(20, self.on_timer, repeat=False)
+        self.render_for(0.3)
+
+        self.assertGreaterEqual(self.fired.count(repeating), 3)
+        self.assertEqual(self.fired.count(once), 1)
+
+    def test_delete(self):
+
+        timer = dpg.set_timer_callback(20, self.on_timer)
+        self.render_for(0.1)
+        dpg.delete_timer_callback(timer)
+        fired = self.fired.count(timer)
+        self.assertGreater(fired, 0)
+
+        self.render_for(0.1)
+        self.assertEqual(self.fired.count(timer), fired)
+
+    def test_delete_many(self):
+
+        # deleted timers that would only come up much later
+        for timer in [dpg.set_timer_callback(60000, self.on_timer) for _ in range(100)]:
+            dpg.delete_timer_callback(timer)
+        kept = dpg.set_timer_callback(60000, self.on_timer)
+        timer = dpg.set_timer_callback(20, self.on_timer, repeat=False)
+        self.render_for(0.1)
+
+        self.assertEqual(self.fired, [timer])
+        dpg.delete_timer_callback(kept)
+
+
+class TestCallbackWorkers(unittest.TestCase):
+
+    # thousands of handlers firing every frame on a callback worker pool
+
+    columns, rows, frames = 40, 50, 10
+
+    def setUp(self):
+
+        dpg.create_context()
+        dpg.configure_app(callback_workers=8, callback_queue_capacity=4000)
+
+        self.lock = threading.Lock()
+        self.busy = {}
+        self.calls = {}
+        self.overlaps = 0
+
+        def on_visible(sender, app_data, user_data):
+            # callbacks from the same sender must never overlap
+            busy = self.busy[sender]
+            if not busy.acquire(blocking=False):
+                with self.lock:
+                    self.overlaps += 1
+                return
+            time.sleep(0)
+            self.calls[sender] += 1
+            busy.release()
+
+        with dpg.window() as self.window_id:
+            for row in range(self.rows):
+                with dpg.group(horizontal=True, horizontal_spacing=2):
+                    for col in range(self.columns):
+                        button = dpg.add_button(width=8, height=8)
+                        with dpg.item_handler_registry() as registry:
+                            handler = dpg.add_item_visible_handler(callback=on_visible)
+                        dpg.bind_item_handler_registry(button, registry)
+                        self.busy[handler] = threading.Lock()
+                        self.calls[handler] = 0
+
+        dpg.set_primary_window(self.window_id, True)
+        dpg.create_viewport(width=800, height=800, vsync=False, headless=True)
+        dpg.setup_dearpygui()
+        dpg.show_viewport()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_per_sender_ordering(self):
+
+        for frame in range(self.frames):
+            dpg.render_dearpygui_frame()
+            while dpg.get_callback_queue_stats()["pending"] > 0:
+                time.sleep(0.001)
+
+        stats = dpg.get_callback_queue_stats()
+        self.assertEqual(stats["dropped"], 0)
+        self.assertEqual(self.overlaps, 0)
+        fired = [count for count in self.calls.values() if count > 0]
+        self.assertEqual(len(fired), self.columns*self.rows)
+        self.assertTrue(all(count == fired[0] for count in fired))
+
+
+class TestRetiredItems(unittest.TestCase):
+
+    # callbacks of deleted items are dropped even while the items are still
+    # being destroyed over several frames
+
+    def setUp(self):
+
+        dpg.create_context()
+        dpg.configure_app(manual_callback_management=True, deferred_deletion_threshold=2)
+
+        self.calls = 0
+
+        def on_visible():
+            self.calls += 1
+
+        with dpg.window() as self.window_id:
+            self.button = dpg.add_button(label="button")
+        with dpg.item_handler_registry() as self.registry:
+            dpg.add_item_visible_handler(callback=on_visible)
+        dpg.bind_item_handler_registry(self.button, self.registry)
+
+        dpg.create_viewport(width=200, height=200, vsync=False, headless=True)
+        dpg.setup_dearpygui()
+        dpg.show_viewport()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_queued_callback_of_deleted_item(self):
+
+        for frame in range(3):
+            dpg.render_dearpygui_frame()
+        self.assertGreater(dpg.get_callback_queue_stats()["pending"], 0)
+
+        dpg.delete_item(self.registry)
+        self.assertGreater(dpg.get_pending_deletions(), 0)
+
+        dpg.run_callbacks(dpg.get_callback_queue())
+        self.assertEqual(self.calls, 0)
+
+
+class TestAsyncCallbacks(unittest.TestCase):
+
+    # callbacks returning awaitables are scheduled on the callback_loop
+
+    def setUp(self):
+
+        dpg.create_context()
+
+        self.results = []
+
+        async def on_visible(sender):
+            await asyncio.sleep(0)
+            self.results.append("coroutine")
+
+        class Awaitable:
+            def __await__(awaitable):
+                yield from asyncio.sleep(0).__await__()
+                self.results.append("awaitable")
+
+        with dpg.window():
+            button = dpg.add_button(label="button")
+        with dpg.item_handler_registry() as registry:
+            dpg.add_item_visible_handler(callback=on_visible)
+            dpg.add_item_visible_handler(callback=lambda: Awaitable())
+        dpg.bind_item_handler_registry(button, registry)
+
+        dpg.create_viewport(width=200, height=200, vsync=False, headless=True)
+        dpg.setup_dearpygui()
+        dpg.show_viewport()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_async_callbacks_on_running_loop(self):
+
+        async def main():
+            dpg.configure_app(callback_loop=asyncio.get_running_loop())
+            for frame in range(50):
+                dpg.render_dearpygui_frame()
+                await asyncio.sleep(0.01)
+                if "coroutine" in self.results and "awaitable" in self.results:
+                    break
+            dpg.configure_app(callback_loop=None)
+
+        asyncio.run(main())
+        self.assertIn("coroutine", self.results)
+        self.assertIn("awaitable", self.results)
+
+
+class TestCommandBuffer(unittest.TestCase):
+
+    # set_value/get_value from another thread while frames are being rendered
+
+    frames = 60
+
+    def setUp(self):
+
+        dpg.create_context()
+        dpg.configure_app(command_buffer=True)
+
+        with dpg.window() as self.window_id:
+            self.slider = dpg.add_slider_int(max_value=1000000)
+            self.button = dpg.add_button()
+
+        dpg.create_viewport(width=200, height=200, vsync=False, headless=True)
+        dpg.setup_dearpygui()
+        dpg.show_viewport()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_read_after_write(self):
+
+        done = threading.Event()
+        stale = []
+
+        def writer():
+            value = 0
+            while not done.is_set():
+                value += 1
+                dpg.set_value(self.slider, value)
+                if dpg.get_value(self.slider) != value:
+                    stale.append(value)
+
+        thread = threading.Thread(target=writer)
+        thread.start()
+        for frame in range(self.frames):
+            dpg.render_dearpygui_frame()
+        done.set()
+        thread.join()
+
+        self.assertEqual(stale, [])
+
+    def test_other_reads_after_write(self):
+
+        done = threading.Event()
+        stale = []
+
+        def writer():
+            value = 0
+            while not done.is_set():
+                value += 1
+                dpg.set_value(self.slider, value)
+                if dpg.get_values([self.slider]) != [value]:
+                    stale.append(("get_values", value))
+                dpg.configure_item(self.button, label=str(value))
+                if dpg.get_item_configuration(self.button)["label"] != str(value):
+                    stale.append(("get_item_configuration", value))
+
+        thread = threading.Thread(target=writer)
+        thread.start()
+        for frame in range(self.frames):
+            dpg.render_dearpygui_frame()
+        done.set()
+        thread.join()
+
+        self.assertEqual(stale, [])
+
+
 if __name__ == '__main__':
     unittest.main(argv=['first-arg-is-ignored'], verbosity=2, exit=should_exit)